@@ -1,6 +1,5 @@
 #include "carrier_ac.h"
-// Includes are now in the .h file, but <vector> is needed here
-#include <vector> 
+#include "carrier_ac_codebook.h"
 
 namespace esphome {
 namespace carrier_ac {
@@ -18,111 +17,73 @@ static const int32_t PULSE_DURATION_US = 650;
 static const int32_t SPACE_ZERO_US = -500;
 static const int32_t SPACE_ONE_US = -1600;
 static const int32_t FINAL_PULSE_US = 650;
-
-// Tolerances for receiving
-static const int32_t SPACE_ZERO_MAX_US = 700;
-static const int32_t SPACE_ONE_MIN_US = 1300;
+// The same timings as a table: encoded in place by ir_common::encode_line,
+// and the reference ir_common::measure_signal grades received frames against
+static const ir_common::LineCoding CODING = {ir_common::LINE_PULSE_DISTANCE, HEADER_PULSE_US, -HEADER_SPACE_US,
+                                             PULSE_DURATION_US, -SPACE_ZERO_US, -SPACE_ONE_US, FINAL_PULSE_US,
+                                             false, false};
 
 
 // ======================================================================
-// ===                PASTE YOUR HEX "CODE BOOK" HERE                 ===
+// ===                        HEX "CODE BOOK"                         ===
 // ======================================================================
-// Use 'ULL' (Unsigned Long Long) for 64-bit constants.
-// 
-// TODO: You MUST define all the hex codes for the commands you are
-// using in the 'control' function below.
-//
-// Example:
-static const uint64_t CODE_OFF                 = 0x2049000000090700ULL; 
-static const uint64_t CODE_COOL_22_AUTO = 0x2847000000a90700ULL;
-static const uint64_t CODE_COOL_23_AUTO = 0x2848000000990700ULL;
-static const uint64_t CODE_COOL_24_AUTO = 0x2849000000890700ULL;
-static const uint64_t CODE_COOL_25_AUTO = 0x284a000000790700ULL;
-static const uint64_t CODE_COOL_26_AUTO = 0x284b000000690700ULL;
-static const uint64_t CODE_COOL_27_AUTO = 0x284c000000590700ULL;
-static const uint64_t CODE_COOL_22_LOW = 0x2877000000790007ULL;
-static const uint64_t CODE_COOL_23_LOW = 0x2878000000690007ULL;
-static const uint64_t CODE_COOL_24_LOW = 0x2879000000590007ULL;
-static const uint64_t CODE_COOL_25_LOW = 0x287a000000490007ULL;
-static const uint64_t CODE_COOL_26_LOW = 0x287b000000390007ULL;
-static const uint64_t CODE_COOL_27_LOW = 0x287c000000290007ULL;
-static const uint64_t CODE_COOL_22_MEDIUM = 0x2869000000690106ULL;
-static const uint64_t CODE_COOL_23_MEDIUM = 0x2868000000790106ULL;
-static const uint64_t CODE_COOL_24_MEDIUM = 0x2869000000690106ULL;
-static const uint64_t CODE_COOL_25_MEDIUM = 0x286a000000590106ULL;
-static const uint64_t CODE_COOL_26_MEDIUM = 0x286b000000490106ULL;
-static const uint64_t CODE_COOL_27_MEDIUM = 0x286c000000390106ULL;
-static const uint64_t CODE_COOL_22_HIGH = 0x2857000000990205ULL;
-static const uint64_t CODE_COOL_23_HIGH = 0x2858000000890205ULL;
-static const uint64_t CODE_COOL_24_HIGH = 0x2859000000790205ULL;
-static const uint64_t CODE_COOL_25_HIGH = 0x285a000000690205ULL;
-static const uint64_t CODE_COOL_26_HIGH = 0x285b000000590205ULL;
-static const uint64_t CODE_COOL_27_HIGH = 0x285c000000490205ULL;
-static const uint64_t CODE_FAN_ONLY_LOW = 0x2839000000990007ULL;
-static const uint64_t CODE_FAN_ONLY_MEDIUM = 0x2829000000a90106ULL;
-static const uint64_t CODE_FAN_ONLY_HIGH = 0x2819000000b90205ULL;
-static const uint64_t CODE_FAN_ONLY_AUTO= 0x2819000000b90205ULL;
+// Codes live in codebooks/carrier_ac.json and are packed into
+// carrier_ac_codebook.cpp by tools/gen_codebook.py. Each record is the
+// 8-byte frame, MSB first, looked up by (mode, fan, temperature).
+static const ir_common::Codebook CODEBOOK(CARRIER_AC_CODEBOOK, CARRIER_AC_CODEBOOK_SIZE);
 
 // ======================================================================
 // ===                NEW ENCODER / DECODER FUNCTIONS                 ===
 // ======================================================================
 
+/**
+ * @brief Frame integrity: the 16 nibbles of a valid frame sum to 0xF (mod 16).
+ */
+static bool nibble_checksum_ok(const uint8_t *bytes, size_t len) {
+  uint8_t sum = 0;
+  for (size_t i = 0; i < len; i++) {
+    sum += (bytes[i] >> 4) + (bytes[i] & 0x0F);
+  }
+  return (sum & 0x0F) == 0x0F;
+}
+
 /**
  * @brief Decodes raw IR timings into a 64-bit integer.
+ * Spaces between the 0 and 1 durations are read as the nearer one; if the
+ * checksum then fails, the least certain bits are flipped until it passes.
  */
-static std::optional<uint64_t> decode_to_uint64(remote_base::RemoteReceiveData data) {
+static std::optional<uint64_t> decode_to_uint64(remote_base::RemoteReceiveData data,
+                                                ir_common::SignalQuality *quality) {
   if (data.size() < 131) {
     return std::nullopt;
   }
 
-  uint64_t decoded_data = 0;
-  int bit_count = 0;
-
-  for (size_t i = 2; i < data.size() - 1 && bit_count < 64; i += 2) {
-    int32_t space_duration = std::abs(data[i + 1]);
-    decoded_data <<= 1;
-
-    if (space_duration >= SPACE_ONE_MIN_US) {
-      decoded_data |= 1;
-    } else if (space_duration < SPACE_ZERO_MAX_US) {
-      // It's a '0' bit.
-    } else {
-      ESP_LOGW(TAG, "Ambiguous space timing at index %d: %d", (int)i + 1, space_duration);
-      return std::nullopt;
-    }
-    bit_count++;
+  // Header mark/space, then one mark/space pair per bit: spaces from index 3
+  const auto &raw = data.get_raw_data();
+  ir_common::SoftBits bits;
+  if (ir_common::decode_soft_bits(raw.data(), raw.size(), 3, 64, -SPACE_ZERO_US, -SPACE_ONE_US, &bits) != 64) {
+    return std::nullopt;
   }
 
-  if (bit_count == 64) {
-    return decoded_data;
+  int repaired = ir_common::repair_bits(&bits, nibble_checksum_ok);
+  if (repaired < 0) {
+    ESP_LOGW(TAG, "Checksum failed, %u uncertain bits could not repair it", (unsigned) bits.weak_count());
+    return std::nullopt;
   }
-  return std::nullopt;
-}
+  if (repaired > 0) {
+    ESP_LOGD(TAG, "Repaired %d weak bit(s) using the checksum", repaired);
+  }
+  *quality = ir_common::measure_signal(CODING, raw.data(), raw.size(), 64);
 
-/**
- * @brief Encodes a 64-bit hex code into a raw IR timing vector.
- */
-static std::vector<int32_t> encode_hex_to_raw(uint64_t hex_data) {
-  std::vector<int32_t> raw_data;
-  raw_data.reserve(131);
-
-  raw_data.push_back(HEADER_PULSE_US);
-  raw_data.push_back(HEADER_SPACE_US);
-
-  for (int i = 63; i >= 0; i--) {
-    raw_data.push_back(PULSE_DURATION_US);
-    if ((hex_data >> i) & 1) {
-      raw_data.push_back(SPACE_ONE_US);
-    } else {
-      raw_data.push_back(SPACE_ZERO_US);
-    }
+  uint64_t decoded_data = 0;
+  for (size_t i = 0; i < 8; i++) {
+    decoded_data = (decoded_data << 8) | bits.bytes[i];
   }
-  
-  raw_data.push_back(FINAL_PULSE_US);
-  return raw_data;
+  return decoded_data;
 }
 
 
+
 // ======================================================================
 // ===                CLIMATE COMPONENT FUNCTIONS                     ===
 // ======================================================================
@@ -143,6 +104,15 @@ void CarrierACClimate::setup() {
   this->mode = climate::CLIMATE_MODE_OFF;
   this->target_temperature = 25.0f; // Or any other default you prefer
   this->fan_mode = climate::CLIMATE_FAN_AUTO;
+
+  // Last state from RTC (warm boot) or the delayed flash copy (cold boot)
+  this->state_store_.setup(this->get_object_id_hash() ^ ir_common::STATE_STORE_KEY);
+  ir_common::AcState restored;
+  if (this->state_store_.load(&restored))
+    restored.apply_to(this);
+  this->state_store_.attach(this);
+  this->set_interval("persist", this->state_store_.poll_interval(),
+                     [this]() { this->state_store_.commit_if_due(millis()); });
   //// If you use a receiver, you must register the listener
   // if (this->receiver_ != nullptr) {
   //   this->receiver_->add_listener(this);
@@ -152,32 +122,14 @@ void CarrierACClimate::setup() {
 void CarrierACClimate::dump_config() {
   ESP_LOGCONFIG(TAG, "Carrier AC Climate:");
   LOG_CLIMATE("", "Carrier AC", this);
+  ESP_LOGCONFIG(TAG, "  Codebook: %u codes%s", CODEBOOK.size(), CODEBOOK.is_valid() ? "" : " (INVALID BLOB)");
+  LOG_SENSOR("  ", "Signal Quality", this->signal_quality_sensor_);
 }
 
 
 climate::ClimateTraits CarrierACClimate::traits() {
-  auto traits = climate::ClimateTraits();
-  traits.set_supports_current_temperature(false);
-  
-  traits.set_supported_modes({
-      climate::CLIMATE_MODE_OFF,
-      climate::CLIMATE_MODE_COOL,
-      climate::CLIMATE_MODE_FAN_ONLY,
-  });
-  
-  traits.set_supported_fan_modes({
-      climate::CLIMATE_FAN_AUTO,
-      climate::CLIMATE_FAN_LOW,
-      climate::CLIMATE_FAN_MEDIUM,
-      climate::CLIMATE_FAN_HIGH,
-  });
-  // traits.set_supported_swing_modes({
-  //     // climate::CLIMATE_SWING_VERTICAL,
-  // });
-  traits.set_visual_min_temperature(22.0f);
-  traits.set_visual_max_temperature(27.0f);
-  traits.set_visual_temperature_step(1.0f);
-  return traits;
+  // Modes, fans and range come from YAML (supported_modes, ...); built once
+  return this->cached_traits_(false);
 }
 
 
@@ -185,40 +137,36 @@ climate::ClimateTraits CarrierACClimate::traits() {
 // ===                TRANSMITTER FUNCTIONS (MODIFIED)                ===
 // ======================================================================
 
-void CarrierACClimate::transmit_raw_code_(const int32_t *data, size_t len) {
+/**
+ * @brief Encodes the 64-bit code straight into the transmitter's buffer.
+ */
+void CarrierACClimate::transmit_hex(uint64_t hex_data) {
   if (this->transmitter_ == nullptr) {
     ESP_LOGE(TAG, "Transmitter not set up!");
     return;
   }
-  if (len == 0 || data == nullptr) {
-      ESP_LOGE(TAG, "Invalid raw code data provided!");
-      return;
+  uint8_t frame[8];
+  for (int i = 7; i >= 0; i--, hex_data >>= 8) {
+    frame[i] = hex_data & 0xFF;
   }
-
-  std::vector<int32_t> data_vec(data, data + len);
   auto call = this->transmitter_->transmit();
-  auto *raw_obj = call.get_data();
-  raw_obj->set_carrier_frequency(IR_FREQUENCY);
-  raw_obj->set_data(data_vec);
+  call.get_data()->set_carrier_frequency(IR_FREQUENCY);
+  ir_common::encode_line(CODING, frame, 64, call.get_data());
   call.perform();
 }
 
-
-/**
- * @brief This is our NEW hex helper function.
- * It converts hex to raw, then calls your working transmit_raw_code_ function.
- */
-void CarrierACClimate::transmit_hex(uint64_t hex_data) {
-  std::vector<int32_t> raw_vector = encode_hex_to_raw(hex_data);
-  // Call your original, working function with the new data
-  this->transmit_raw_code_(raw_vector.data(), raw_vector.size());
-}
-
 /**
  * @brief Transmit a command to the AC.
  * This is now updated to call transmit_hex().
  */
+static ir_common::AllocSite CONTROL_SITE{"carrier_ac.control"};
+static ir_common::BudgetSite CONTROL_BUDGET{"carrier_ac.control"};
+static ir_common::AllocSite RECEIVE_SITE{"carrier_ac.on_receive"};
+static ir_common::BudgetSite RECEIVE_BUDGET{"carrier_ac.on_receive"};
+
 void CarrierACClimate::control(const climate::ClimateCall &call) {
+  ir_common::AllocGuard alloc_guard(CONTROL_SITE);
+  ir_common::BudgetGuard budget_guard(CONTROL_BUDGET);
   // Update internal state from the call
   if (call.get_mode().has_value()) {
     this->mode = *call.get_mode();
@@ -230,78 +178,24 @@ void CarrierACClimate::control(const climate::ClimateCall &call) {
     this->fan_mode = *call.get_fan_mode();
   }
 
-  // Call new helper function
+  // Look the state up in the codebook. OFF ignores fan and temperature,
+  // FAN_ONLY ignores temperature.
+  auto state = ir_common::AcState::from_climate(*this);
   if (this->mode == climate::CLIMATE_MODE_OFF) {
-    this->transmit_hex(CODE_OFF);
-  } 
-  // --- AUTO FAN ---
-  else if (this->mode == climate::CLIMATE_MODE_COOL && this->target_temperature == 22.0f && this->fan_mode == climate::CLIMATE_FAN_AUTO) {
-    this->transmit_hex(CODE_COOL_22_AUTO);
-  } else if (this->mode == climate::CLIMATE_MODE_COOL && this->target_temperature == 23.0f && this->fan_mode == climate::CLIMATE_FAN_AUTO) {
-    this->transmit_hex(CODE_COOL_23_AUTO);
-  } else if (this->mode == climate::CLIMATE_MODE_COOL && this->target_temperature == 24.0f && this->fan_mode == climate::CLIMATE_FAN_AUTO) {
-    this->transmit_hex(CODE_COOL_24_AUTO);
-  } else if (this->mode == climate::CLIMATE_MODE_COOL && this->target_temperature == 25.0f && this->fan_mode == climate::CLIMATE_FAN_AUTO) {
-    this->transmit_hex(CODE_COOL_25_AUTO);
-  } else if (this->mode == climate::CLIMATE_MODE_COOL && this->target_temperature == 26.0f && this->fan_mode == climate::CLIMATE_FAN_AUTO) {
-    this->transmit_hex(CODE_COOL_26_AUTO);
-  } else if (this->mode == climate::CLIMATE_MODE_COOL && this->target_temperature == 27.0f && this->fan_mode == climate::CLIMATE_FAN_AUTO) {
-    this->transmit_hex(CODE_COOL_27_AUTO);
-  }
-  // --- LOW FAN ---
-  else if (this->mode == climate::CLIMATE_MODE_COOL && this->target_temperature == 22.0f && this->fan_mode == climate::CLIMATE_FAN_LOW) {
-    this->transmit_hex(CODE_COOL_22_LOW);
-  } else if (this->mode == climate::CLIMATE_MODE_COOL && this->target_temperature == 23.0f && this->fan_mode == climate::CLIMATE_FAN_LOW) {
-    this->transmit_hex(CODE_COOL_23_LOW);
-  } else if (this->mode == climate::CLIMATE_MODE_COOL && this->target_temperature == 24.0f && this->fan_mode == climate::CLIMATE_FAN_LOW) {
-    this->transmit_hex(CODE_COOL_24_LOW);
-  } else if (this->mode == climate::CLIMATE_MODE_COOL && this->target_temperature == 25.0f && this->fan_mode == climate::CLIMATE_FAN_LOW) {
-    this->transmit_hex(CODE_COOL_25_LOW);
-  } else if (this->mode == climate::CLIMATE_MODE_COOL && this->target_temperature == 26.0f && this->fan_mode == climate::CLIMATE_FAN_LOW) {
-    this->transmit_hex(CODE_COOL_26_LOW);
-  } else if (this->mode == climate::CLIMATE_MODE_COOL && this->target_temperature == 27.0f && this->fan_mode == climate::CLIMATE_FAN_LOW) {
-    this->transmit_hex(CODE_COOL_27_LOW);
-  }
-  // --- MEDIUM FAN ---
-  else if (this->mode == climate::CLIMATE_MODE_COOL && this->target_temperature == 22.0f && this->fan_mode == climate::CLIMATE_FAN_MEDIUM) {
-    this->transmit_hex(CODE_COOL_22_MEDIUM);
-  } else if (this->mode == climate::CLIMATE_MODE_COOL && this->target_temperature == 23.0f && this->fan_mode == climate::CLIMATE_FAN_MEDIUM) {
-    this->transmit_hex(CODE_COOL_23_MEDIUM);
-  } else if (this->mode == climate::CLIMATE_MODE_COOL && this->target_temperature == 24.0f && this->fan_mode == climate::CLIMATE_FAN_MEDIUM) {
-    this->transmit_hex(CODE_COOL_24_MEDIUM);
-  } else if (this->mode == climate::CLIMATE_MODE_COOL && this->target_temperature == 25.0f && this->fan_mode == climate::CLIMATE_FAN_MEDIUM) {
-    this->transmit_hex(CODE_COOL_25_MEDIUM);
-  } else if (this->mode == climate::CLIMATE_MODE_COOL && this->target_temperature == 26.0f && this->fan_mode == climate::CLIMATE_FAN_MEDIUM) {
-    this->transmit_hex(CODE_COOL_26_MEDIUM);
-  } else if (this->mode == climate::CLIMATE_MODE_COOL && this->target_temperature == 27.0f && this->fan_mode == climate::CLIMATE_FAN_MEDIUM) {
-    this->transmit_hex(CODE_COOL_27_MEDIUM);
+    state = ir_common::AcState(climate::CLIMATE_MODE_OFF, ir_common::CODEBOOK_ANY, 0);
+  } else if (this->mode == climate::CLIMATE_MODE_FAN_ONLY) {
+    state = state.with_temperature(0);
   }
-  // --- HIGH FAN ---
-  else if (this->mode == climate::CLIMATE_MODE_COOL && this->target_temperature == 22.0f && this->fan_mode == climate::CLIMATE_FAN_HIGH) {
-    this->transmit_hex(CODE_COOL_22_HIGH);
-  } else if (this->mode == climate::CLIMATE_MODE_COOL && this->target_temperature == 23.0f && this->fan_mode == climate::CLIMATE_FAN_HIGH) {
-    this->transmit_hex(CODE_COOL_23_HIGH);
-  } else if (this->mode == climate::CLIMATE_MODE_COOL && this->target_temperature == 24.0f && this->fan_mode == climate::CLIMATE_FAN_HIGH) {
-    this->transmit_hex(CODE_COOL_24_HIGH);
-  } else if (this->mode == climate::CLIMATE_MODE_COOL && this->target_temperature == 25.0f && this->fan_mode == climate::CLIMATE_FAN_HIGH) {
-    this->transmit_hex(CODE_COOL_25_HIGH);
-  } else if (this->mode == climate::CLIMATE_MODE_COOL && this->target_temperature == 26.0f && this->fan_mode == climate::CLIMATE_FAN_HIGH) {
-    this->transmit_hex(CODE_COOL_26_HIGH);
-  } else if (this->mode == climate::CLIMATE_MODE_COOL && this->target_temperature == 27.0f && this->fan_mode == climate::CLIMATE_FAN_HIGH) {
-    this->transmit_hex(CODE_COOL_27_HIGH);
-  }
-  // --- FAN ONLY ---
-  else if (this->mode == climate::CLIMATE_MODE_FAN_ONLY && this->fan_mode == climate::CLIMATE_FAN_LOW) {
-    this->transmit_hex(CODE_FAN_ONLY_LOW);
-  } else if (this->mode == climate::CLIMATE_MODE_FAN_ONLY && this->fan_mode == climate::CLIMATE_FAN_MEDIUM) {
-    this->transmit_hex(CODE_FAN_ONLY_MEDIUM);
-  } else if (this->mode == climate::CLIMATE_MODE_FAN_ONLY && this->fan_mode == climate::CLIMATE_FAN_HIGH) {
-    this->transmit_hex(CODE_FAN_ONLY_HIGH);
-  } else if (this->mode == climate::CLIMATE_MODE_FAN_ONLY && this->fan_mode == climate::CLIMATE_FAN_AUTO) {
-    this->transmit_hex(CODE_FAN_ONLY_AUTO);
-  }
-  
-  else {
+
+  ir_common::CodebookRecord record;
+  uint8_t frame[8];
+  if (CODEBOOK.find(state.packed(), &record) && ir_common::Codebook::read_bytes(record, frame, sizeof(frame)) == sizeof(frame)) {
+    uint64_t hex_code = 0;
+    for (uint8_t b : frame) {
+      hex_code = (hex_code << 8) | b;
+    }
+    this->transmit_hex(hex_code);
+  } else {
     ESP_LOGW(TAG, "No matching hex code found to transmit for current state.");
   }
 
@@ -319,12 +213,19 @@ void CarrierACClimate::control(const climate::ClimateCall &call) {
  * This is now updated to decode hex and use the smart logic.
  */
 bool CarrierACClimate::on_receive(remote_base::RemoteReceiveData data) {
+  ir_common::AllocGuard alloc_guard(RECEIVE_SITE);
+  ir_common::BudgetGuard budget_guard(RECEIVE_BUDGET);
   // Try to decode the raw data into our 64-bit hex format
-  auto decoded_hex = decode_to_uint64(data);
+  ir_common::SignalQuality quality;
+  auto decoded_hex = decode_to_uint64(data, &quality);
 
   if (!decoded_hex.has_value()) {
     return false; // Not a valid Carrier 64-bit code
   }
+  ESP_LOGD(TAG, "Signal quality %u%% (bit margin %uus, mark error %uus, header error %uus)", quality.score,
+           quality.bit_margin_us, quality.fixed_error_us, quality.header_error_us);
+  if (this->signal_quality_sensor_ != nullptr)
+    this->signal_quality_sensor_->publish_state(quality.score);
 
   uint64_t hex_code = decoded_hex.value();
   ESP_LOGD(TAG, "Received IR code. HEX: 0x%016llX", hex_code);
@@ -336,8 +237,8 @@ bool CarrierACClimate::on_receive(remote_base::RemoteReceiveData data) {
   // --- Rule 1: Check Power (B0) ---
   if (b0 == 0x20) {
     ESP_LOGD(TAG, "Matched OFF code (B0=0x20)");
-    this->mode = climate::CLIMATE_MODE_OFF;
-    this->publish_state();
+    if (ir_common::AcState(climate::CLIMATE_MODE_OFF, ir_common::CODEBOOK_ANY, 0).apply_to(this))
+      this->publish_state();
     return true;
   }
 
@@ -352,38 +253,40 @@ bool CarrierACClimate::on_receive(remote_base::RemoteReceiveData data) {
   // --- Rule 2: Get Mode & Fan from B1 High Nibble ---
   uint8_t b1_high_nibble = (b1 >> 4) & 0x0F;
   
+  climate::ClimateMode mode;
+  climate::ClimateFanMode fan;
   switch (b1_high_nibble) {
     case 0x1:
-      this->mode = climate::CLIMATE_MODE_FAN_ONLY;
-      this->fan_mode = climate::CLIMATE_FAN_HIGH;
+      mode = climate::CLIMATE_MODE_FAN_ONLY;
+      fan = climate::CLIMATE_FAN_HIGH;
       break;
     case 0x2:
-      this->mode = climate::CLIMATE_MODE_FAN_ONLY;
-      this->fan_mode = climate::CLIMATE_FAN_MEDIUM;
+      mode = climate::CLIMATE_MODE_FAN_ONLY;
+      fan = climate::CLIMATE_FAN_MEDIUM;
       break;
     case 0x3:
-      this->mode = climate::CLIMATE_MODE_FAN_ONLY;
-      this->fan_mode = climate::CLIMATE_FAN_LOW;
+      mode = climate::CLIMATE_MODE_FAN_ONLY;
+      fan = climate::CLIMATE_FAN_LOW;
       break;
     case 0x4:
-      this->mode = climate::CLIMATE_MODE_COOL;
-      this->fan_mode = climate::CLIMATE_FAN_AUTO;
+      mode = climate::CLIMATE_MODE_COOL;
+      fan = climate::CLIMATE_FAN_AUTO;
       break;
     case 0x5:
-      this->mode = climate::CLIMATE_MODE_COOL;
-      this->fan_mode = climate::CLIMATE_FAN_HIGH;
+      mode = climate::CLIMATE_MODE_COOL;
+      fan = climate::CLIMATE_FAN_HIGH;
       break;
     case 0x6:
-      this->mode = climate::CLIMATE_MODE_COOL;
-      this->fan_mode = climate::CLIMATE_FAN_MEDIUM;
+      mode = climate::CLIMATE_MODE_COOL;
+      fan = climate::CLIMATE_FAN_MEDIUM;
       break;
     case 0x7:
-      this->mode = climate::CLIMATE_MODE_COOL;
-      this->fan_mode = climate::CLIMATE_FAN_LOW;
+      mode = climate::CLIMATE_MODE_COOL;
+      fan = climate::CLIMATE_FAN_LOW;
       break;
     case 0xB:
-      this->mode = climate::CLIMATE_MODE_DRY;
-      this->fan_mode = climate::CLIMATE_FAN_AUTO; // DRY mode fan is usually fixed
+      mode = climate::CLIMATE_MODE_DRY;
+      fan = climate::CLIMATE_FAN_AUTO; // DRY mode fan is usually fixed
       break;
     default:
       ESP_LOGW(TAG, "Unknown B1 High Nibble: 0x%X", b1_high_nibble);
@@ -391,18 +294,17 @@ bool CarrierACClimate::on_receive(remote_base::RemoteReceiveData data) {
   }
 
   // --- Rule 3: Get Temperature from B1 Low Nibble ---
-  // This only applies if we are NOT in FAN_ONLY mode
-  if (this->mode == climate::CLIMATE_MODE_COOL || this->mode == climate::CLIMATE_MODE_DRY) {
+  // This only applies if we are NOT in FAN_ONLY mode (0 leaves the setpoint alone)
+  float temperature = 0;
+  if (mode == climate::CLIMATE_MODE_COOL || mode == climate::CLIMATE_MODE_DRY) {
     uint8_t b1_low_nibble = b1 & 0x0F;
-    this->target_temperature = 15.0f + b1_low_nibble;
-    ESP_LOGD(TAG, "Decoded: Mode: %d, Fan: %d, Temp: %.1f", this->mode, this->fan_mode, this->target_temperature);
-  } else {
-    // FAN_ONLY mode, temperature is irrelevant
-    ESP_LOGD(TAG, "Decoded: Mode: %d, Fan: %d", this->mode, this->fan_mode);
+    temperature = 15.0f + b1_low_nibble;
   }
+  ESP_LOGD(TAG, "Decoded: Mode: %d, Fan: %d, Temp: %.1f", mode, fan, temperature);
 
-  // Publish the new state
-  this->publish_state();
+  // Remotes repeat frames; only publish what changed
+  if (ir_common::AcState(mode, fan, temperature).apply_to(this))
+    this->publish_state();
   return true;
 }
 
@@ -5,12 +5,18 @@
 #include "esphome/components/remote_transmitter/remote_transmitter.h"
 #include "esphome/components/sensor/sensor.h"
 #include "esphome/components/remote_receiver/remote_receiver.h"
+#include "esphome/components/ir_common/configured_traits.h"
+#include "esphome/components/ir_common/ac_state.h"
+#include "esphome/components/ir_common/alloc_stats.h"
+#include "esphome/components/ir_common/loop_budget.h"
+#include "esphome/components/ir_common/codebook.h"
+#include "esphome/components/ir_common/line_coding.h"
+#include "esphome/components/ir_common/soft_bits.h"
+#include "esphome/components/ir_common/state_store.h"
+#include "esphome/components/ir_common/signal_quality.h"
 // --- New Includes for Hex support ---
 #include "esphome/core/log.h"
 #include <string>
-#include <vector>
-#include <sstream>
-#include <iomanip>
 #include <cstdint>
 #include <optional>
 // --- End New Includes ---
@@ -19,13 +25,16 @@ namespace esphome {
 namespace carrier_ac {
 
 class CarrierACClimate : public climate::Climate, public Component,
-                         public remote_base::RemoteReceiverListener {
+                         public remote_base::RemoteReceiverListener,
+                         public ir_common::ConfiguredTraits {
  public:
   // --- Setter functions (Unchanged) ---
   void set_transmitter(remote_transmitter::RemoteTransmitterComponent *transmitter) {
     this->transmitter_ = transmitter;
   }
   void set_sensor(sensor::Sensor *sensor) { this->sensor_ = sensor; }
+  void set_flash_write_delay(uint32_t delay) { this->state_store_.set_flash_delay(delay); }
+  void set_signal_quality_sensor(sensor::Sensor *sensor) { this->signal_quality_sensor_ = sensor; }
 
   // --- Overridden functions (Unchanged)---
   climate::ClimateTraits traits() override;
@@ -38,12 +47,9 @@ class CarrierACClimate : public climate::Climate, public Component,
  protected:
   // --- Helper Functions (MODIFIED) ---
   
-  // This is our new helper function
+  // Encodes in place into the transmitter's buffer (no per-send vector)
   void transmit_hex(uint64_t hex_data);
   
-  // This function is still used by transmit_hex
-  void transmit_raw_code_(const int32_t *data, size_t len);
-  
   // These are no longer needed
   // void send_ir_code_();
   // bool compare_raw_code_(...);
@@ -52,6 +58,8 @@ class CarrierACClimate : public climate::Climate, public Component,
   // --- Member Variables (Unchanged) ---
   remote_transmitter::RemoteTransmitterComponent *transmitter_{nullptr};
   sensor::Sensor *sensor_{nullptr};
+  sensor::Sensor *signal_quality_sensor_{nullptr};
+  ir_common::StateStore state_store_;
 };
 
 }  // namespace carrier_ac
@@ -0,0 +1,45 @@
+// Generated by tools/gen_codebook.py from codebooks/carrier_ac.json -- do not edit.
+// 29 codes, 496 bytes.
+#include "carrier_ac_codebook.h"
+#include "esphome/core/hal.h"
+
+namespace esphome {
+namespace carrier_ac {
+
+const uint8_t CARRIER_AC_CODEBOOK[] PROGMEM = {
+    0x49, 0x52, 0x43, 0x42, 0x01, 0x01, 0x1D, 0x00, 0x08, 0x00, 0x10, 0x00, 0x26, 0x00, 0x08, 0x00,
+    0x45, 0x00, 0x0F, 0x00, 0x56, 0x00, 0x05, 0x00, 0x32, 0x00, 0x07, 0x00, 0x01, 0x00, 0x6E, 0x00,
+    0x02, 0x02, 0x32, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x28, 0x4A, 0x00, 0x00, 0x00, 0x79, 0x07, 0x00,
+    0x00, 0xFF, 0x00, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x20, 0x49, 0x00, 0x00, 0x00, 0x09, 0x07, 0x00,
+    0x02, 0x04, 0x2E, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x28, 0x68, 0x00, 0x00, 0x00, 0x79, 0x01, 0x06,
+    0x02, 0x04, 0x2C, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x28, 0x69, 0x00, 0x00, 0x00, 0x69, 0x01, 0x06,
+    0x02, 0x02, 0x2C, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x28, 0x47, 0x00, 0x00, 0x00, 0xA9, 0x07, 0x00,
+    0x02, 0x03, 0x2E, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x28, 0x78, 0x00, 0x00, 0x00, 0x69, 0x00, 0x07,
+    0x02, 0x05, 0x30, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x28, 0x59, 0x00, 0x00, 0x00, 0x79, 0x02, 0x05,
+    0x02, 0x03, 0x30, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x28, 0x79, 0x00, 0x00, 0x00, 0x59, 0x00, 0x07,
+    0x02, 0x04, 0x36, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x28, 0x6C, 0x00, 0x00, 0x00, 0x39, 0x01, 0x06,
+    0x02, 0x02, 0x2E, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x28, 0x48, 0x00, 0x00, 0x00, 0x99, 0x07, 0x00,
+    0x02, 0x03, 0x34, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x28, 0x7B, 0x00, 0x00, 0x00, 0x39, 0x00, 0x07,
+    0x02, 0x05, 0x34, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x28, 0x5B, 0x00, 0x00, 0x00, 0x59, 0x02, 0x05,
+    0x02, 0x02, 0x30, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x28, 0x49, 0x00, 0x00, 0x00, 0x89, 0x07, 0x00,
+    0x04, 0x04, 0x00, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x28, 0x29, 0x00, 0x00, 0x00, 0xA9, 0x01, 0x06,
+    0x02, 0x05, 0x32, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x28, 0x5A, 0x00, 0x00, 0x00, 0x69, 0x02, 0x05,
+    0x02, 0x04, 0x34, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x28, 0x6B, 0x00, 0x00, 0x00, 0x49, 0x01, 0x06,
+    0x02, 0x04, 0x30, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x28, 0x69, 0x00, 0x00, 0x00, 0x69, 0x01, 0x06,
+    0x04, 0x05, 0x00, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x28, 0x19, 0x00, 0x00, 0x00, 0xB9, 0x02, 0x05,
+    0x02, 0x05, 0x2C, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x28, 0x57, 0x00, 0x00, 0x00, 0x99, 0x02, 0x05,
+    0x04, 0x03, 0x00, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x28, 0x39, 0x00, 0x00, 0x00, 0x99, 0x00, 0x07,
+    0x02, 0x03, 0x36, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x28, 0x7C, 0x00, 0x00, 0x00, 0x29, 0x00, 0x07,
+    0x02, 0x05, 0x2E, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x28, 0x58, 0x00, 0x00, 0x00, 0x89, 0x02, 0x05,
+    0x02, 0x03, 0x2C, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x28, 0x77, 0x00, 0x00, 0x00, 0x79, 0x00, 0x07,
+    0x02, 0x04, 0x32, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x28, 0x6A, 0x00, 0x00, 0x00, 0x59, 0x01, 0x06,
+    0x02, 0x02, 0x36, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x28, 0x4C, 0x00, 0x00, 0x00, 0x59, 0x07, 0x00,
+    0x04, 0x02, 0x00, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x28, 0x19, 0x00, 0x00, 0x00, 0xB9, 0x02, 0x05,
+    0x02, 0x02, 0x34, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x28, 0x4B, 0x00, 0x00, 0x00, 0x69, 0x07, 0x00,
+    0x02, 0x03, 0x32, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x28, 0x7A, 0x00, 0x00, 0x00, 0x49, 0x00, 0x07,
+    0x02, 0x05, 0x36, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x28, 0x5C, 0x00, 0x00, 0x00, 0x49, 0x02, 0x05,
+};
+const size_t CARRIER_AC_CODEBOOK_SIZE = sizeof(CARRIER_AC_CODEBOOK);
+
+}  // namespace carrier_ac
+}  // namespace esphome
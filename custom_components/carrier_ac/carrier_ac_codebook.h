@@ -0,0 +1,15 @@
+#pragma once
+
+// Generated by tools/gen_codebook.py from codebooks/carrier_ac.json -- do not edit.
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace carrier_ac {
+
+extern const uint8_t CARRIER_AC_CODEBOOK[];
+extern const size_t CARRIER_AC_CODEBOOK_SIZE;
+
+}  // namespace carrier_ac
+}  // namespace esphome
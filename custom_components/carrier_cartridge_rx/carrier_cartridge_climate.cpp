@@ -0,0 +1,176 @@
+#include "carrier_cartridge_climate.h"
+#include "esphome/components/ir_common/alloc_stats.h"
+#include "esphome/components/ir_common/hex_format.h"
+#include "esphome/components/ir_common/loop_budget.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+#include <cmath>
+
+namespace esphome {
+namespace carrier_cartridge_rx {
+
+static const char *const TAG = "carrier_cartridge_rx.climate";
+
+// ======================================================================
+// ===                CLIMATE COMPONENT FUNCTIONS                     ===
+// ======================================================================
+void CarrierCartridgeClimate::setup() {
+  this->publish_gate_.attach(this);
+  if (this->sensor_ != nullptr) {
+    this->sensor_->add_on_state_callback([this](float state) {
+      this->current_temperature = state;
+      this->publish_changes_();
+    });
+    this->current_temperature = this->sensor_->state;
+  } else {
+    this->current_temperature = NAN;
+  }
+
+  this->mode = climate::CLIMATE_MODE_OFF;
+  this->target_temperature = 25.0f;
+  this->fan_mode = climate::CLIMATE_FAN_AUTO;
+  this->swing_mode = climate::CLIMATE_SWING_OFF;
+
+  // Last state from RTC (warm boot) or the delayed flash copy (cold boot);
+  // nodes upgraded from the stock climate restore fall back to it once
+  this->state_store_.setup(this->get_object_id_hash() ^ ir_common::STATE_STORE_KEY);
+  ir_common::AcState restored;
+  if (this->state_store_.load(&restored)) {
+    restored.apply_to(this);
+  } else {
+    auto restore = this->restore_state_();
+    if (restore.has_value())
+      restore->apply(this);
+  }
+  this->state_store_.attach(this);
+  this->set_interval("persist", this->state_store_.poll_interval(),
+                     [this]() { this->state_store_.commit_if_due(millis()); });
+  this->set_interval("publish", this->publish_gate_.poll_interval(), [this]() {
+    if (this->publish_gate_.take_due(millis()))
+      this->publish_changes_();
+  });
+}
+
+// Sensor callbacks and held-back publishes
+static ir_common::BudgetSite PUBLISH_BUDGET{"carrier_cartridge_rx.publish"};
+
+void CarrierCartridgeClimate::publish_changes_() {
+  ir_common::BudgetGuard budget_guard(PUBLISH_BUDGET);
+  uint32_t now = millis();
+  uint32_t wait = this->publish_gate_.wait_ms(*this, now);
+  if (wait == 0) {
+    this->publish_state();
+  } else if (wait != ir_common::PUBLISH_NOT_NEEDED) {
+    // Re-checked then, so only the latest reading goes out
+    this->publish_gate_.hold(now, wait);
+  }
+}
+
+void CarrierCartridgeClimate::dump_config() {
+  ESP_LOGCONFIG(TAG, "Carrier Cartridge Climate:");
+  LOG_CLIMATE("", "Carrier Cartridge", this);
+  LOG_SENSOR("  ", "Signal Quality", this->signal_quality_sensor_);
+}
+
+climate::ClimateTraits CarrierCartridgeClimate::traits() {
+  // Modes, fans, swing and range come from YAML (supported_modes, ...); built once
+  return this->cached_traits_(this->sensor_ != nullptr);
+}
+
+// ======================================================================
+// ===                      TRANSMITTER                               ===
+// ======================================================================
+void CarrierCartridgeClimate::transmit_frame_(const uint8_t *frame, size_t length) {
+  if (this->transmitter_ == nullptr) {
+    ESP_LOGE(TAG, "Transmitter not set up!");
+    return;
+  }
+  char hex[ir_common::hex_buffer_size(MAX_FRAME_BYTES)];
+  ESP_LOGD(TAG, "Transmitting: %s", ir_common::format_hex_to(hex, sizeof(hex), frame, length));
+  auto call = this->transmitter_->transmit();
+  encode_timings(frame, length, call.get_data());
+  call.perform();
+}
+
+static ir_common::AllocSite CONTROL_SITE{"carrier_cartridge_rx.control"};
+static ir_common::BudgetSite CONTROL_BUDGET{"carrier_cartridge_rx.control"};
+static ir_common::AllocSite RECEIVE_SITE{"carrier_cartridge_rx.climate_receive"};
+static ir_common::BudgetSite RECEIVE_BUDGET{"carrier_cartridge_rx.climate_receive"};
+
+void CarrierCartridgeClimate::control(const climate::ClimateCall &call) {
+  ir_common::AllocGuard alloc_guard(CONTROL_SITE);
+  ir_common::BudgetGuard budget_guard(CONTROL_BUDGET);
+  auto before = ir_common::AcState::from_climate(*this);
+  if (call.get_mode().has_value()) {
+    this->mode = *call.get_mode();
+  }
+  if (call.get_target_temperature().has_value()) {
+    this->target_temperature = this->clamp_temperature_(*call.get_target_temperature());
+  }
+  if (call.get_fan_mode().has_value()) {
+    this->fan_mode = *call.get_fan_mode();
+  }
+  auto after = ir_common::AcState::from_climate(*this);
+
+  uint8_t frame[MAX_FRAME_BYTES];
+  // Swing is a separate frame that toggles the louvre only; the remote never
+  // sends it together with a state frame, so neither do we.
+  if (call.get_swing_mode().has_value()) {
+    this->swing_mode = *call.get_swing_mode();
+    this->transmit_frame_(frame, encode_swing_frame(this->swing_mode != climate::CLIMATE_SWING_OFF, frame));
+  }
+  // A call that only repeats the current state (e.g. alongside a swing
+  // change) sends nothing more; a call with nothing else resends it.
+  if (after != before || !call.get_swing_mode().has_value()) {
+    CartridgeState state{after, COMMAND_STATE, 0x00};
+    this->transmit_frame_(frame, encode_state_frame(state, frame));
+  }
+  this->publish_state();
+}
+
+// ======================================================================
+// ===                        RECEIVER                                ===
+// ======================================================================
+// A frame from the physical remote is applied locally and published; it is
+// not retransmitted, since the unit has already acted on it.
+bool CarrierCartridgeClimate::on_receive(remote_base::RemoteReceiveData data) {
+  ir_common::AllocGuard alloc_guard(RECEIVE_SITE);
+  ir_common::BudgetGuard budget_guard(RECEIVE_BUDGET);
+  uint8_t frame[MAX_FRAME_BYTES];
+  ir_common::SignalQuality quality;
+  size_t length = decode_capture(data.get_raw_data(), frame, &quality);
+  if (length == 0) {
+    return false;
+  }
+  ESP_LOGD(TAG, "Signal quality %u%% (bit margin %uus, mark error %uus, header error %uus)", quality.score,
+           quality.bit_margin_us, quality.fixed_error_us, quality.header_error_us);
+  if (this->signal_quality_sensor_ != nullptr)
+    this->signal_quality_sensor_->publish_state(quality.score);
+
+  bool swing_on;
+  if (parse_swing_frame(frame, length, &swing_on)) {
+    ESP_LOGD(TAG, "Received SWING %s", swing_on ? "ON" : "OFF");
+    auto swing = swing_on ? climate::CLIMATE_SWING_VERTICAL : climate::CLIMATE_SWING_OFF;
+    if (this->swing_mode != swing) {
+      this->swing_mode = swing;
+      this->publish_state();
+    }
+    return true;
+  }
+
+  CartridgeState state;
+  if (!parse_state_frame(frame, length, &state)) {
+    return false;
+  }
+
+  // OFF and FAN_ONLY frames carry no usable temperature, so the setpoint is
+  // kept. A frame that repeats the current state is not published again.
+  ESP_LOGD(TAG, "Received state: mode %d, fan %d, temp %.1f", state.ac.mode(), state.ac.fan(),
+           state.ac.temperature());
+  if (state.ac.apply_to(this))
+    this->publish_state();
+  return true;
+}
+
+}  // namespace carrier_cartridge_rx
+}  // namespace esphome
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/components/climate/climate.h"
+#include "esphome/components/remote_base/remote_base.h"
+#include "esphome/components/remote_transmitter/remote_transmitter.h"
+#include "esphome/components/sensor/sensor.h"
+#include "esphome/components/ir_common/configured_traits.h"
+#include "esphome/components/ir_common/publish_gate.h"
+#include "esphome/components/ir_common/state_store.h"
+#include "esphome/components/ir_common/signal_quality.h"
+#include "cartridge_protocol.h"
+
+namespace esphome {
+namespace carrier_cartridge_rx {
+
+// Native climate entity for the cartridge unit. Transmits its own frames and,
+// with a receiver attached, applies frames from the physical remote directly
+// to its state, so the entity follows the remote without an HA round trip.
+class CarrierCartridgeClimate : public climate::Climate, public Component,
+                                public remote_base::RemoteReceiverListener,
+                                public ir_common::ConfiguredTraits {
+ public:
+  void set_transmitter(remote_transmitter::RemoteTransmitterComponent *transmitter) {
+    this->transmitter_ = transmitter;
+  }
+  void set_sensor(sensor::Sensor *sensor) { this->sensor_ = sensor; }
+  void set_flash_write_delay(uint32_t delay) { this->state_store_.set_flash_delay(delay); }
+  void set_signal_quality_sensor(sensor::Sensor *sensor) { this->signal_quality_sensor_ = sensor; }
+  void set_min_publish_interval(uint32_t interval) { this->publish_gate_.set_min_interval(interval); }
+  void set_current_temperature_deadband(float deadband) { this->publish_gate_.set_temperature_deadband(deadband); }
+
+  climate::ClimateTraits traits() override;
+  void control(const climate::ClimateCall &call) override;
+  void setup() override;
+  void dump_config() override;
+  bool on_receive(remote_base::RemoteReceiveData data) override;
+
+ protected:
+  void transmit_frame_(const uint8_t *frame, size_t length);
+  // Publishes now, after the rate limit, or not at all (see PublishGate)
+  void publish_changes_();
+
+  remote_transmitter::RemoteTransmitterComponent *transmitter_{nullptr};
+  sensor::Sensor *sensor_{nullptr};
+  sensor::Sensor *signal_quality_sensor_{nullptr};
+  ir_common::StateStore state_store_;
+  ir_common::PublishGate publish_gate_;
+};
+
+}  // namespace carrier_cartridge_rx
+}  // namespace esphome
@@ -1,9 +1,16 @@
 #include "carrier_cartridge_rx.h"
+#include "cartridge_protocol.h"
+#include "esphome/components/ir_common/ac_state.h"
+#include "esphome/components/ir_common/alloc_stats.h"
+#include "esphome/components/ir_common/hex_format.h"
+#include "esphome/components/ir_common/loop_budget.h"
 #include "esphome/core/log.h"
 #include "esphome/components/climate/climate.h"
 // Include remote_base.h BEFORE remote_receiver.h
 #include "esphome/components/remote_base/remote_base.h"
 #include "esphome/components/remote_receiver/remote_receiver.h"
+#include "esphome/core/helpers.h"
+#include <cstring>
 #include <vector>
 #include <optional>
 #include <cmath> 
@@ -15,48 +22,8 @@ namespace carrier_cartridge_rx {
 
 static const char *const TAG = "carrier_cartridge_rx";
 
-// ======================================================================
-// ===               IR PROTOCOL TIMING DEFINITIONS                   ===
-// ======================================================================
-static const int32_t HEADER_PULSE_US = 9000;
-static const int32_t HEADER_SPACE_US = -4500;
-static const int32_t PULSE_DURATION_US = 650;
-static const int32_t SPACE_ZERO_US = -500;
-static const int32_t SPACE_ONE_US = -1600;
-static const int32_t FINAL_PULSE_US = 650;
-static const int32_t SPACE_ZERO_MAX_US = 700;
-static const int32_t SPACE_ONE_MIN_US = 1300;
-
-// ======================================================================
-// ===                HEX "CODE BOOK" FOR SPECIAL CODES               ===
-// ======================================================================
-static const uint64_t CODE_SWING_ON  = 0xF20D01FE210120FCULL; // Rule 6
-static const uint64_t CODE_SWING_OFF = 0xF20D01FE210223FCULL; // Rule 7
-
-// ======================================================================
-// ===                DECODER FUNCTION (Keep This)                    ===
-// ======================================================================
-static std::optional<uint64_t> decode_to_uint64(remote_base::RemoteReceiveData data) {
-  if (data.size() < 171) { return std::nullopt; }
-  uint64_t decoded_data = 0;
-  int bit_count = 0;
-  for (size_t i = 2; i < data.size() - 1 && bit_count < 64; i += 2) {
-    int32_t space_duration = std::abs(data[i + 1]);
-    decoded_data <<= 1;
-    if (space_duration >= SPACE_ONE_MIN_US) { // Uses constant
-      decoded_data |= 1;
-    } else if (space_duration < SPACE_ZERO_MAX_US) { /* 0 bit */ } // Uses constant
-    else {
-      return std::nullopt;
-     }
-    bit_count++;
-  }
-  if (bit_count == 64) { return decoded_data; }
-  return std::nullopt;
-}
-
-// Renamed helper functions
-std::string rx_climate_mode_to_string(climate::ClimateMode mode) {
+// Renamed helper functions. Literals, so a receive builds no strings.
+const char *rx_climate_mode_to_string(climate::ClimateMode mode) {
     switch (mode) {
         case climate::CLIMATE_MODE_OFF: return "OFF";
         case climate::CLIMATE_MODE_COOL: return "COOL";
@@ -68,7 +35,7 @@ std::string rx_climate_mode_to_string(climate::ClimateMode mode) {
     }
 }
 
-std::string rx_climate_fan_mode_to_string(climate::ClimateFanMode fan_mode) {
+const char *rx_climate_fan_mode_to_string(climate::ClimateFanMode fan_mode) {
      switch (fan_mode) {
         case climate::CLIMATE_FAN_AUTO: return "AUTO";
         case climate::CLIMATE_FAN_LOW: return "LOW";
@@ -78,7 +45,7 @@ std::string rx_climate_fan_mode_to_string(climate::ClimateFanMode fan_mode) {
     }
 }
 
-std::string rx_climate_swing_mode_to_string(climate::ClimateSwingMode swing_mode) {
+const char *rx_climate_swing_mode_to_string(climate::ClimateSwingMode swing_mode) {
     switch (swing_mode) {
         case climate::CLIMATE_SWING_OFF: return "OFF";
         case climate::CLIMATE_SWING_VERTICAL: return "VERTICAL";
@@ -112,95 +79,63 @@ void CarrierCartridgeRx::dump_config() {
 // ======================================================================
 // ===                on_receive LOGIC (Protocol v2) ===
 // ======================================================================
-bool CarrierCartridgeRx::on_receive(remote_base::RemoteReceiveData data) {
-  auto decoded_hex = decode_to_uint64(data);
-  if (!decoded_hex.has_value()) {
-    return false; // Not our code
-  }
-
-  uint64_t hex_code = decoded_hex.value();
-  ESP_LOGD(TAG, "on_receive: Decoded HEX: 0x%016llX", hex_code);
-
-  // *** FIX 2: Initialize variables to a default state ***
-  climate::ClimateMode received_mode = climate::CLIMATE_MODE_OFF;
-  climate::ClimateFanMode received_fan_mode = climate::CLIMATE_FAN_AUTO;
-  float received_temp = NAN;
-  bool state_decoded = false; // Flag to indicate if we decoded a main state
-  bool swing_decoded = false; // Flag for special swing codes
-
-  // --- Rule 6 & 7: Check for special SWING codes first ---
-  if (hex_code == CODE_SWING_ON) {
-    ESP_LOGD(TAG, "on_receive: Matched SWING ON code");
-    if (this->swing_mode_sensor_ != nullptr && this->swing_mode_sensor_->get_raw_state() != "VERTICAL") {
-       this->swing_mode_sensor_->publish_state("VERTICAL");
-    }
-    swing_decoded = true;
-  } else if (hex_code == CODE_SWING_OFF) {
-    ESP_LOGD(TAG, "on_receive: Matched SWING OFF code");
-    if (this->swing_mode_sensor_ != nullptr && this->swing_mode_sensor_->get_raw_state() != "OFF") {
-       this->swing_mode_sensor_->publish_state("OFF");
-    }
-    swing_decoded = true;
-  }
+static ir_common::AllocSite RECEIVE_SITE{"carrier_cartridge_rx.on_receive"};
+static ir_common::BudgetSite RECEIVE_BUDGET{"carrier_cartridge_rx.on_receive"};
 
-  // --- Rule 1: Check for main code prefix ---
-  uint32_t prefix = (hex_code >> 32) & 0xFFFFFFFFULL;
-  if (prefix == 0xF20D03FCULL) {
-    ESP_LOGD(TAG, "on_receive: Matched main state prefix 0xF20D03FC");
-    state_decoded = true;
-
-    uint8_t b5 = (hex_code >> 16) & 0xFF;
-    uint8_t b6 = (hex_code >> 8) & 0xFF;
-
-    // --- Rule 2: Parse Mode (B6 Low Nibble) ---
-    uint8_t mode_nibble = b6 & 0x0F;
-    switch (mode_nibble) {
-        case 0x0: received_mode = climate::CLIMATE_MODE_AUTO; break;
-        case 0x1: received_mode = climate::CLIMATE_MODE_COOL; break;
-        case 0x2: received_mode = climate::CLIMATE_MODE_DRY; break;
-        case 0x4: received_mode = climate::CLIMATE_MODE_FAN_ONLY; break;
-        case 0x7: received_mode = climate::CLIMATE_MODE_OFF; break;
-        default:
-          ESP_LOGW(TAG, "on_receive: Unknown mode nibble: 0x%X", mode_nibble);
-          state_decoded = false; 
+bool CarrierCartridgeRx::on_receive(remote_base::RemoteReceiveData data) {
+  ir_common::BudgetGuard budget_guard(RECEIVE_BUDGET);
+  CartridgeState state{};
+  bool swing_on = false;
+  bool state_decoded, swing_decoded;
+  {
+    // Only decoding is guarded: a text sensor publish builds a std::string,
+    // so the publishes below run once per change, outside the guard
+    ir_common::AllocGuard alloc_guard(RECEIVE_SITE);
+    uint8_t frame[MAX_FRAME_BYTES];
+    size_t length = decode_capture(data.get_raw_data(), frame);
+    if (length == 0) {
+      return false; // Not our code
     }
 
-    // --- Rule 3: Parse Fan (B6 High Nibble) ---
-    uint8_t fan_nibble = (b6 >> 4) & 0x0F;
-    switch (fan_nibble) {
-        case 0x0: received_fan_mode = climate::CLIMATE_FAN_AUTO; break;
-        case 0x4: received_fan_mode = climate::CLIMATE_FAN_LOW; break; // Level 1
-        case 0x6: received_fan_mode = climate::CLIMATE_FAN_MEDIUM; break; // Level 2
-        case 0x8: received_fan_mode = climate::CLIMATE_FAN_MEDIUM; break; // Level 3
-        case 0xA: received_fan_mode = climate::CLIMATE_FAN_HIGH; break; // Level 4
-        case 0xC: received_fan_mode = climate::CLIMATE_FAN_HIGH; break; // Level 5
-        default:
-          received_fan_mode = climate::CLIMATE_FAN_AUTO; 
-    }
+    char hex[ir_common::hex_buffer_size(MAX_FRAME_BYTES)];
+    ESP_LOGD(TAG, "on_receive: Decoded %u bytes: %s", (unsigned) length,
+             ir_common::format_hex_to(hex, sizeof(hex), frame, length));
+    state_decoded = parse_state_frame(frame, length, &state);
+    swing_decoded = parse_swing_frame(frame, length, &swing_on);
+  }
 
-    // --- Rule 4: Parse Temperature (B5 High Nibble) ---
-    // This check now safely uses the initialized 'received_mode'
-    if (state_decoded && received_mode != climate::CLIMATE_MODE_OFF && received_mode != climate::CLIMATE_MODE_FAN_ONLY) {
-      uint8_t temp_nibble = (b5 >> 4) & 0x0F;
-      received_temp = temp_nibble + 17.0f; // T = value + 17
-      received_temp = clamp(received_temp, 17.0f, 30.0f); 
+  // --- Rule 6 & 7: Special SWING codes ---
+  if (swing_decoded) {
+    const char *swing_str = swing_on ? "VERTICAL" : "OFF";
+    ESP_LOGD(TAG, "on_receive: Matched SWING %s code", swing_on ? "ON" : "OFF");
+    if (this->swing_mode_sensor_ != nullptr && this->swing_mode_sensor_->get_raw_state() != swing_str) {
+       this->swing_mode_sensor_->publish_state(swing_str);
     }
   }
 
-
-  // --- Publish state to sensors if a main state was decoded ---
+  // --- Rules 1-4: Main state frame ---
   if (state_decoded) {
-      std::string mode_str = rx_climate_mode_to_string(received_mode);
-      std::string fan_mode_str = rx_climate_fan_mode_to_string(received_fan_mode);
-      std::string temp_str = "";
+    ESP_LOGD(TAG, "on_receive: Command 0x%02X, options 0x%02X", state.command, state.options);
+    if (state.options != 0x00) {
+      ESP_LOGW(TAG, "on_receive: Unrecognised option bits 0x%02X (timer?), state fields still applied", state.options);
+    }
+  }
+  auto received_mode = static_cast<climate::ClimateMode>(state.ac.mode());
+  auto received_fan_mode = static_cast<climate::ClimateFanMode>(state.ac.fan());
+  float received_temp = state.ac.has_temperature() ? state.ac.temperature() : NAN;
+  // --- Publish state to sensors if a main state was decoded and differs from the last one ---
+  if (state_decoded && state.ac == this->last_state_) {
+      ESP_LOGD(TAG, "Received state matches the last one, not publishing.");
+  } else if (state_decoded) {
+      this->last_state_ = state.ac;
+      const char *mode_str = rx_climate_mode_to_string(received_mode);
+      const char *fan_mode_str = rx_climate_fan_mode_to_string(received_fan_mode);
+      char temp_str[10] = "";
       
       if (!std::isnan(received_temp)) {
-          char temp_buffer[10];
-          snprintf(temp_buffer, sizeof(temp_buffer), "%.1f", received_temp);
-          // *** FIX 3: Added missing semicolon ***
-          temp_str = temp_buffer;
+          snprintf(temp_str, sizeof(temp_str), "%.1f", received_temp);
       } else if (received_mode != climate::CLIMATE_MODE_OFF && received_mode != climate::CLIMATE_MODE_FAN_ONLY) {
-           temp_str = "N/A"; 
+           snprintf(temp_str, sizeof(temp_str), "N/A");
       }
 
       bool published = false;
@@ -218,8 +153,7 @@ bool CarrierCartridgeRx::on_receive(remote_base::RemoteReceiveData data) {
       }
       
       if (published) {
-          ESP_LOGD(TAG, "Published updated state: Mode=%s, Fan=%s, Temp=%s",
-                   mode_str.c_str(), fan_mode_str.c_str(), temp_str.c_str());
+          ESP_LOGD(TAG, "Published updated state: Mode=%s, Fan=%s, Temp=%s", mode_str, fan_mode_str, temp_str);
       } else {
           ESP_LOGD(TAG, "Received state matches current sensor state, not publishing.");
       }
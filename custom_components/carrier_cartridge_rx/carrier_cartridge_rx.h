@@ -4,6 +4,7 @@
 #include "esphome/components/remote_base/remote_base.h" 
 #include "esphome/components/remote_receiver/remote_receiver.h"
 #include "esphome/components/text_sensor/text_sensor.h"
+#include "esphome/components/ir_common/ac_state.h"
 #include "esphome/core/log.h"
 #include <vector>
 #include <optional>
@@ -36,6 +37,8 @@ class CarrierCartridgeRx : public Component, public remote_base::RemoteReceiverL
   text_sensor::TextSensor *fan_mode_sensor_{nullptr};
   text_sensor::TextSensor *target_temperature_sensor_{nullptr};
   text_sensor::TextSensor *swing_mode_sensor_{nullptr};
+  // Last decoded main state, so repeats are not re-published
+  ir_common::AcState last_state_;
 };
 
 } // namespace carrier_cartridge_rx
@@ -0,0 +1,255 @@
+#include "cartridge_protocol.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+#include "esphome/components/ir_common/frame_segmenter.h"
+#include "esphome/components/ir_common/line_coding.h"
+#include "esphome/components/ir_common/signal_quality.h"
+#include "esphome/components/ir_common/soft_bits.h"
+#include <cmath>
+#include <cstring>
+
+namespace esphome {
+namespace carrier_cartridge_rx {
+
+static const char *const TAG = "carrier_cartridge_rx.protocol";
+
+// ======================================================================
+// ===               IR PROTOCOL TIMING DEFINITIONS                   ===
+// ======================================================================
+static const uint32_t IR_FREQUENCY = 38000;
+static const uint32_t HEADER_PULSE_US = 4320;
+static const uint32_t HEADER_SPACE_US = 4350;
+static const uint32_t PULSE_DURATION_US = 500;
+static const uint32_t SPACE_ZERO_US = 550;
+static const uint32_t SPACE_ONE_US = 1650;
+static const uint32_t FRAME_GAP_US = 7400;
+static const ir_common::LineCoding CODING = {ir_common::LINE_PULSE_DISTANCE, HEADER_PULSE_US, HEADER_SPACE_US,
+                                             PULSE_DURATION_US, SPACE_ZERO_US, SPACE_ONE_US, PULSE_DURATION_US,
+                                             false, false};
+
+// Received captures are split on spaces longer than any header space.
+static const uint32_t SPLIT_GAP_US = 6000;
+static const size_t MAX_FRAMES = ir_common::VOTE_MAX_FRAMES;
+// Header mark/space, one mark/space pair per bit, final mark
+static const size_t MIN_FRAME_TIMINGS = 2 + 8 * 2 + 1;
+
+// ======================================================================
+// ===                HEX "CODE BOOK" FOR SPECIAL CODES               ===
+// ======================================================================
+static const uint8_t CODE_SWING_ON[] = {0xF2, 0x0D, 0x01, 0xFE, 0x21, 0x01, 0x20};   // Rule 6
+static const uint8_t CODE_SWING_OFF[] = {0xF2, 0x0D, 0x01, 0xFE, 0x21, 0x02, 0x23};  // Rule 7
+static const uint8_t MAIN_PREFIX[] = {0xF2, 0x0D, 0x03, 0xFC};                        // Rule 1
+static const size_t MAIN_FRAME_BYTES = 9;
+
+// ======================================================================
+// ===                         DECODER                                ===
+// ======================================================================
+// Header bytes before the payload, plus the trailing checksum
+static const size_t FRAME_OVERHEAD_BYTES = 6;
+
+bool frame_valid(const uint8_t *frame, size_t length) {
+  if (length < FRAME_OVERHEAD_BYTES + 1 || length > MAX_FRAME_BYTES)
+    return false;
+  // Complement pairs and the length byte: cheap, and they reject most
+  // corrupted or foreign frames before the XOR is computed.
+  if ((frame[0] ^ frame[1]) != 0xFF || (frame[2] ^ frame[3]) != 0xFF)
+    return false;
+  if (frame[2] + FRAME_OVERHEAD_BYTES != length)
+    return false;
+  uint8_t x = 0;
+  for (size_t i = 0; i + 1 < length; i++)
+    x ^= frame[i];
+  return x == frame[length - 1];
+}
+
+// Decodes one segmented frame MSB first. Uncertain spaces are read as the
+// nearer of 0/1 and repaired against the check bytes. Returns the byte count,
+// or 0 if the bits do not fill whole bytes or the check bytes cannot be met.
+static size_t decode_frame(const int32_t *timings, size_t len, uint8_t *out, ir_common::SignalQuality *quality) {
+  size_t bits = (len - 3) / 2;
+  if (len < MIN_FRAME_TIMINGS || bits % 8 != 0 || bits / 8 > MAX_FRAME_BYTES)
+    return 0;
+  ir_common::SoftBits soft;
+  ir_common::decode_soft_bits(timings, len, 3, bits, SPACE_ZERO_US, SPACE_ONE_US, &soft);
+  int repaired = ir_common::repair_bits(&soft, frame_valid);
+  if (repaired < 0) {
+    ESP_LOGD(TAG, "Frame check bytes failed (%u uncertain bits)", (unsigned) soft.weak_count());
+    return 0;
+  }
+  if (repaired > 0)
+    ESP_LOGD(TAG, "Repaired %d weak bit(s) using the check bytes", repaired);
+  memcpy(out, soft.bytes, bits / 8);
+  *quality = ir_common::measure_signal(CODING, timings, len, bits);
+  return bits / 8;
+}
+
+size_t decode_capture(const remote_base::RawTimings &raw, uint8_t *out, ir_common::SignalQuality *quality) {
+  ir_common::FrameSpan spans[MAX_FRAMES];
+  size_t n = ir_common::segment_frames(raw.data(), raw.size(), SPLIT_GAP_US, MIN_FRAME_TIMINGS, spans, MAX_FRAMES);
+
+  size_t length = 0;
+  ir_common::MajorityVote vote(MAX_FRAME_BYTES);
+  uint8_t frame[MAX_FRAME_BYTES];
+  ir_common::SignalQuality frame_quality;
+  for (size_t i = 0; i < n; i++) {
+    size_t len = decode_frame(raw.data() + spans[i].start, spans[i].length, frame, &frame_quality);
+    if (len == 0)
+      continue;
+    if (length == 0) {
+      length = len;
+      vote = ir_common::MajorityVote(len);
+      if (quality != nullptr)
+        *quality = frame_quality;
+    } else if (quality != nullptr) {
+      quality->merge(frame_quality);
+    }
+    vote.add(frame, len);
+  }
+  if (length == 0)
+    return 0;
+
+  if (vote.result(out)) {
+    ESP_LOGV(TAG, "%u of %u repeats agree", (unsigned) vote.agreement(out), (unsigned) vote.count());
+    return length;
+  }
+  // Two repeats that disagree: take the first one with a valid preamble
+  for (size_t i = 0; i < vote.count(); i++) {
+    if (vote.frame(i)[0] == 0xF2 && vote.frame(i)[1] == 0x0D) {
+      memcpy(out, vote.frame(i), length);
+      ESP_LOGD(TAG, "Repeats disagree, using repeat %u", (unsigned) i + 1);
+      return length;
+    }
+  }
+  return 0;
+}
+
+// ======================================================================
+// ===                        FIELD RULES                             ===
+// ======================================================================
+// One table per field, read by both directions. The first row for a value
+// is the one transmitted; later rows are extra remote levels it decodes to.
+struct ModeRule {
+  uint8_t nibble;
+  climate::ClimateMode mode;
+};
+struct FanRule {
+  uint8_t nibble;
+  climate::ClimateFanMode fan_mode;
+};
+
+// Rule 2: B6 low nibble
+static const ModeRule MODE_RULES[] = {
+    {0x0, climate::CLIMATE_MODE_AUTO},     {0x1, climate::CLIMATE_MODE_COOL}, {0x2, climate::CLIMATE_MODE_DRY},
+    {0x4, climate::CLIMATE_MODE_FAN_ONLY}, {0x7, climate::CLIMATE_MODE_OFF},
+};
+// Rule 3: B6 high nibble, remote levels 1-5. Unlisted nibbles decode to AUTO.
+static const FanRule FAN_RULES[] = {
+    {0x0, climate::CLIMATE_FAN_AUTO},
+    {0x4, climate::CLIMATE_FAN_LOW},     // Level 1
+    {0x8, climate::CLIMATE_FAN_MEDIUM},  // Level 3
+    {0xC, climate::CLIMATE_FAN_HIGH},    // Level 5
+    {0x6, climate::CLIMATE_FAN_MEDIUM},  // Level 2
+    {0xA, climate::CLIMATE_FAN_HIGH},    // Level 4
+};
+// Rule 4: B5 high nibble, T = value + 17
+static const float TEMPERATURE_OFFSET = 17.0f;
+static const float TEMPERATURE_MAX = 30.0f;
+// OFF and FAN_ONLY frames still carry a temperature field
+static const float TEMPERATURE_FILLER = 24.0f;
+
+bool parse_swing_frame(const uint8_t *frame, size_t length, bool *swing_on) {
+  if (length == sizeof(CODE_SWING_ON) && memcmp(frame, CODE_SWING_ON, length) == 0) {
+    *swing_on = true;
+    return true;
+  }
+  if (length == sizeof(CODE_SWING_OFF) && memcmp(frame, CODE_SWING_OFF, length) == 0) {
+    *swing_on = false;
+    return true;
+  }
+  return false;
+}
+
+bool parse_state_frame(const uint8_t *frame, size_t length, CartridgeState *state) {
+  if (length != MAIN_FRAME_BYTES || memcmp(frame, MAIN_PREFIX, sizeof(MAIN_PREFIX)) != 0)
+    return false;
+
+  uint8_t mode_nibble = frame[6] & 0x0F;
+  const ModeRule *mode = nullptr;
+  for (const auto &rule : MODE_RULES) {
+    if (rule.nibble == mode_nibble) {
+      mode = &rule;
+      break;
+    }
+  }
+  if (mode == nullptr) {
+    ESP_LOGW(TAG, "Unknown mode nibble: 0x%X", mode_nibble);
+    return false;
+  }
+
+  uint8_t fan_nibble = frame[6] >> 4;
+  climate::ClimateFanMode fan_mode = climate::CLIMATE_FAN_AUTO;
+  for (const auto &rule : FAN_RULES) {
+    if (rule.nibble == fan_nibble) {
+      fan_mode = rule.fan_mode;
+      break;
+    }
+  }
+
+  float temp = 0;  // not set
+  if (mode->mode != climate::CLIMATE_MODE_OFF && mode->mode != climate::CLIMATE_MODE_FAN_ONLY)
+    temp = clamp((frame[5] >> 4) + TEMPERATURE_OFFSET, TEMPERATURE_OFFSET, TEMPERATURE_MAX);
+  state->ac = ir_common::AcState(mode->mode, fan_mode, temp);
+  state->command = frame[4];
+  state->options = frame[7];
+  return true;
+}
+
+// ======================================================================
+// ===                         ENCODER                                ===
+// ======================================================================
+size_t encode_state_frame(const CartridgeState &state, uint8_t *frame) {
+  uint8_t mode_nibble = 0x7;  // OFF for anything the unit does not have
+  for (const auto &rule : MODE_RULES) {
+    if (rule.mode == state.ac.mode()) {
+      mode_nibble = rule.nibble;
+      break;
+    }
+  }
+  uint8_t fan_nibble = 0x0;
+  for (const auto &rule : FAN_RULES) {
+    if (rule.fan_mode == state.ac.fan()) {
+      fan_nibble = rule.nibble;
+      break;
+    }
+  }
+  float temp = state.ac.has_temperature() ? state.ac.temperature() : TEMPERATURE_FILLER;
+  temp = clamp(roundf(temp), TEMPERATURE_OFFSET, TEMPERATURE_MAX);
+
+  memcpy(frame, MAIN_PREFIX, sizeof(MAIN_PREFIX));
+  frame[4] = state.command;
+  frame[5] = static_cast<uint8_t>(temp - TEMPERATURE_OFFSET) << 4;
+  frame[6] = (fan_nibble << 4) | mode_nibble;
+  frame[7] = state.options;
+  frame[8] = 0;
+  for (size_t i = 0; i < MAIN_FRAME_BYTES - 1; i++)
+    frame[8] ^= frame[i];
+  return MAIN_FRAME_BYTES;
+}
+
+size_t encode_swing_frame(bool swing_on, uint8_t *frame) {
+  const uint8_t *code = swing_on ? CODE_SWING_ON : CODE_SWING_OFF;
+  memcpy(frame, code, sizeof(CODE_SWING_ON));
+  return sizeof(CODE_SWING_ON);
+}
+
+void encode_timings(const uint8_t *frame, size_t length, remote_base::RemoteTransmitData *dst) {
+  dst->set_carrier_frequency(IR_FREQUENCY);
+  for (uint8_t repeat = 0; repeat < 2; repeat++) {
+    ir_common::encode_line(CODING, frame, length * 8, dst);
+    if (repeat == 0)
+      dst->space(FRAME_GAP_US);
+  }
+}
+
+}  // namespace carrier_cartridge_rx
+}  // namespace esphome
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "esphome/components/climate/climate.h"
+#include "esphome/components/remote_base/remote_base.h"
+#include "esphome/components/ir_common/ac_state.h"
+#include "esphome/components/ir_common/signal_quality.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace carrier_cartridge_rx {
+
+// ======================================================================
+// ===                 CARRIER CARTRIDGE PROTOCOL                     ===
+// ======================================================================
+// Shared by the text-sensor receiver and the climate entity.
+//
+// Frames are sent MSB first, each one twice:
+//   main state  F2 0D 03 FC 01 T<<4 (fan<<4 | mode) 00 CS   (T = °C - 17)
+//   swing       F2 0D 01 FE 21 01 20  (on)  /  21 02 23 (off)
+//
+// Check bytes, all verified before a frame is accepted:
+//   B1 = ~B0, B3 = ~B2, B2 = frame length - 6, CS = XOR of all preceding bytes.
+
+static const size_t MAX_FRAME_BYTES = 9;
+/// B4 of a state frame sent by the stock remote
+static const uint8_t COMMAND_STATE = 0x01;
+
+struct CartridgeState {
+  ir_common::AcState ac;  // mode, fan, temperature (not set for OFF / FAN_ONLY); swing has its own frame
+  uint8_t command;        // B4: COMMAND_STATE for a state frame, encoded as given
+  uint8_t options;        // B7: 0x00 from the stock remote (timer / power bits on other models)
+};
+
+/// All check bytes of a complete frame.
+bool frame_valid(const uint8_t *frame, size_t length);
+
+/// Segments the capture, decodes and checksum-repairs each frame, and votes
+/// across the repeats. Returns the frame length, 0 if nothing decoded.
+/// `quality`, if given, receives the worst of the repeats that decoded.
+size_t decode_capture(const remote_base::RawTimings &raw, uint8_t *frame, ir_common::SignalQuality *quality = nullptr);
+
+/// Rules 1-4 plus the extra fields. False if this is not a main state frame or the mode is unknown.
+bool parse_state_frame(const uint8_t *frame, size_t length, CartridgeState *state);
+/// Rules 6-7. False if this is not a swing frame.
+bool parse_swing_frame(const uint8_t *frame, size_t length, bool *swing_on);
+
+/// Inverse of parse_state_frame, from the same field tables. Returns the frame length.
+size_t encode_state_frame(const CartridgeState &state, uint8_t *frame);
+/// CODE_SWING_ON / CODE_SWING_OFF. Returns the frame length.
+size_t encode_swing_frame(bool swing_on, uint8_t *frame);
+/// Header, bits and final mark, twice with the inter-frame gap.
+void encode_timings(const uint8_t *frame, size_t length, remote_base::RemoteTransmitData *dst);
+
+}  // namespace carrier_cartridge_rx
+}  // namespace esphome
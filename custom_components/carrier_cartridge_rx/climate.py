@@ -0,0 +1,70 @@
+# File: custom_components/carrier_cartridge_rx/climate.py
+
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import climate, remote_transmitter, sensor, remote_receiver, remote_base
+from esphome.components import ir_common
+from esphome.const import (
+    CONF_ID,
+    CONF_SENSOR,
+)
+
+CONF_RECEIVER_ID = "receiver_id"
+
+AUTO_LOAD = ["ir_common", "sensor"]
+
+carrier_cartridge_rx_ns = cg.esphome_ns.namespace("carrier_cartridge_rx")
+
+CarrierCartridgeClimate = carrier_cartridge_rx_ns.class_(
+    "CarrierCartridgeClimate",
+    climate.Climate,
+    cg.Component,
+    remote_base.RemoteReceiverListener,
+)
+
+# What the protocol can send; YAML may narrow it to what the unit has
+TRAITS_SCHEMA = ir_common.traits_schema(
+    ["OFF", "AUTO", "COOL", "DRY", "FAN_ONLY"],
+    ["AUTO", "LOW", "MEDIUM", "HIGH"],
+    (17, 30),
+    swing_modes=["OFF", "VERTICAL"],
+)
+
+CONFIG_SCHEMA = cv.All(
+    climate.climate_schema(CarrierCartridgeClimate).extend(
+        {
+            cv.Required(remote_transmitter.CONF_TRANSMITTER_ID): cv.use_id(
+                remote_transmitter.RemoteTransmitterComponent
+            ),
+            cv.Optional(CONF_SENSOR): cv.use_id(sensor.Sensor),
+            # With a receiver, the physical remote updates the entity directly
+            cv.Optional(CONF_RECEIVER_ID): cv.use_id(
+                remote_receiver.RemoteReceiverComponent
+            ),
+        }
+    ).extend(ir_common.PUBLISH_GATE_SCHEMA).extend(TRAITS_SCHEMA).extend(ir_common.STATE_STORE_SCHEMA)
+    .extend(ir_common.SIGNAL_QUALITY_SCHEMA).extend(cv.COMPONENT_SCHEMA),
+    ir_common.validate_temperature_range,
+)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+
+    await cg.register_component(var, config)
+    await climate.register_climate(var, config)
+    await ir_common.traits_to_code(var, config)
+    await ir_common.state_store_to_code(var, config)
+    await ir_common.signal_quality_to_code(var, config)
+
+    transmitter = await cg.get_variable(config[remote_transmitter.CONF_TRANSMITTER_ID])
+    cg.add(var.set_transmitter(transmitter))
+
+    if CONF_SENSOR in config:
+        sens = await cg.get_variable(config[CONF_SENSOR])
+        cg.add(var.set_sensor(sens))
+    await ir_common.publish_gate_to_code(var, config)
+
+    if CONF_RECEIVER_ID in config:
+        receiver = await cg.get_variable(config[CONF_RECEIVER_ID])
+        cg.add(receiver.register_listener(var))
@@ -7,6 +7,8 @@ from esphome.const import CONF_ID
 
 CONF_RECEIVER_ID = "receiver_id"
 
+AUTO_LOAD = ["ir_common"]
+
 # Define keys for the configuration options
 CONF_MODE_SENSOR = "mode_sensor"
 CONF_FAN_MODE_SENSOR = "fan_mode_sensor"
@@ -0,0 +1,63 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome import automation
+from esphome.components import remote_base, remote_receiver
+from esphome.const import CONF_ID
+
+CONF_RECEIVER_ID = "receiver_id"
+CONF_BUFFER_SIZE = "buffer_size"
+CONF_RESOLUTION = "resolution"
+CONF_STREAM_PORT = "stream_port"
+
+AUTO_LOAD = ["ir_common", "socket"]
+DEPENDENCIES = ["remote_receiver"]
+
+ir_capture_ns = cg.esphome_ns.namespace("ir_capture")
+IrCapture = ir_capture_ns.class_("IrCapture", cg.Component, remote_base.RemoteReceiverListener)
+DumpAction = ir_capture_ns.class_("DumpAction", automation.Action)
+ClearAction = ir_capture_ns.class_("ClearAction", automation.Action)
+
+# Latest raw captures, compressed in RAM (see ir_common/capture_ring.h)
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(IrCapture),
+        cv.Required(CONF_RECEIVER_ID): cv.use_id(remote_receiver.RemoteReceiverComponent),
+        cv.Optional(CONF_BUFFER_SIZE, default=2048): cv.int_range(min=256, max=32768),
+        # Durations are rounded to this; well inside any receiver tolerance
+        cv.Optional(CONF_RESOLUTION, default="25us"): cv.All(
+            cv.positive_time_period_microseconds,
+            cv.Range(min=cv.TimePeriod(microseconds=1), max=cv.TimePeriod(microseconds=255)),
+        ),
+        # Binary stream of every capture for tools/ir_stream.py (see ir_common/capture_stream.h)
+        cv.Optional(CONF_STREAM_PORT): cv.port,
+    }
+).extend(cv.COMPONENT_SCHEMA)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+    receiver = await cg.get_variable(config[CONF_RECEIVER_ID])
+    cg.add(receiver.register_listener(var))
+    cg.add(var.set_buffer_size(config[CONF_BUFFER_SIZE]))
+    cg.add(var.set_resolution(config[CONF_RESOLUTION].total_microseconds))
+    if CONF_STREAM_PORT in config:
+        cg.add_define("USE_IR_CAPTURE_STREAM")
+        cg.add(var.set_stream_port(config[CONF_STREAM_PORT]))
+
+
+IR_CAPTURE_ACTION_SCHEMA = automation.maybe_simple_id({cv.GenerateID(): cv.use_id(IrCapture)})
+
+
+@automation.register_action("ir_capture.dump", DumpAction, IR_CAPTURE_ACTION_SCHEMA)
+async def ir_capture_dump_to_code(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    return var
+
+
+@automation.register_action("ir_capture.clear", ClearAction, IR_CAPTURE_ACTION_SCHEMA)
+async def ir_capture_clear_to_code(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    return var
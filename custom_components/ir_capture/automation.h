@@ -0,0 +1,22 @@
+#pragma once
+
+#include "esphome/core/automation.h"
+#include "ir_capture.h"
+
+namespace esphome {
+namespace ir_capture {
+
+// ir_capture.dump: log the captures held, oldest first
+template<typename... Ts> class DumpAction : public Action<Ts...>, public Parented<IrCapture> {
+ public:
+  void play(Ts... x) override { this->parent_->dump(); }
+};
+
+// ir_capture.clear: forget them
+template<typename... Ts> class ClearAction : public Action<Ts...>, public Parented<IrCapture> {
+ public:
+  void play(Ts... x) override { this->parent_->clear(); }
+};
+
+}  // namespace ir_capture
+}  // namespace esphome
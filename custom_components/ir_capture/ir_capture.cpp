@@ -0,0 +1,221 @@
+#include "ir_capture.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+#include "esphome/components/ir_common/alloc_stats.h"
+#include "esphome/components/ir_common/hex_format.h"
+#include "esphome/components/ir_common/loop_budget.h"
+#ifdef USE_IR_CAPTURE_STREAM
+#include "esphome/components/ir_common/capture_stream.h"
+#include "esphome/components/ir_common/protocol_id.h"
+#include <cstring>
+#endif
+#include <algorithm>
+#include <cstdio>
+
+namespace esphome {
+namespace ir_capture {
+
+static const char *const TAG = "ir_capture";
+
+// Per log line, so each stays well under the logger's line limit
+static const size_t HEX_BYTES_PER_LINE = 32;
+static const size_t TIMINGS_PER_LINE = 16;
+
+void IrCapture::setup() {
+  this->ring_.init(this->buffer_size_);
+#ifdef USE_IR_CAPTURE_STREAM
+  if (this->stream_port_ != 0)
+    this->start_server_();
+#endif
+}
+
+void IrCapture::loop() {
+#ifdef USE_IR_CAPTURE_STREAM
+  if (this->server_ == nullptr)
+    return;
+  struct sockaddr_storage addr;
+  socklen_t addr_len = sizeof(addr);
+  auto client = this->server_->accept((struct sockaddr *) &addr, &addr_len);
+  if (client != nullptr) {
+    // The newest reader wins; a stale one would hold the stream forever
+    if (this->client_ != nullptr)
+      this->close_client_();
+    client->setblocking(false);
+    this->client_ = std::move(client);
+    this->send_used_ = 0;
+    ESP_LOGI(TAG, "Stream client connected");
+    this->queue_hello_();
+  }
+  if (this->client_ == nullptr)
+    return;
+  // Nothing is read from the client; this only notices it went away
+  uint8_t discard[16];
+  ssize_t n = this->client_->read(discard, sizeof(discard));
+  if (n == 0 || (n < 0 && errno != EWOULDBLOCK && errno != EAGAIN)) {
+    ESP_LOGI(TAG, "Stream client disconnected");
+    this->close_client_();
+    return;
+  }
+  this->flush_();
+#endif
+}
+
+void IrCapture::dump_config() {
+  ESP_LOGCONFIG(TAG, "IR Capture Ring:");
+  ESP_LOGCONFIG(TAG, "  Buffer: %u bytes", (unsigned) this->ring_.capacity());
+  ESP_LOGCONFIG(TAG, "  Resolution: %u us", this->resolution_us_);
+  if (this->stream_port_ != 0)
+    ESP_LOGCONFIG(TAG, "  Stream Port: %u", this->stream_port_);
+}
+
+static ir_common::AllocSite RECEIVE_SITE{"ir_capture.on_receive"};
+static ir_common::BudgetSite RECEIVE_BUDGET{"ir_capture.on_receive"};
+
+bool IrCapture::on_receive(remote_base::RemoteReceiveData data) {
+  ir_common::AllocGuard alloc_guard(RECEIVE_SITE);
+  ir_common::BudgetGuard budget_guard(RECEIVE_BUDGET);
+  const auto &raw = data.get_raw_data();
+  uint32_t now = millis();
+  this->sequence_++;
+  if (!this->ring_.push(now, raw.data(), raw.size(), this->resolution_us_))
+    ESP_LOGW(TAG, "Capture of %u timings does not fit in %u bytes", (unsigned) raw.size(),
+             (unsigned) this->ring_.capacity());
+#ifdef USE_IR_CAPTURE_STREAM
+  if (this->client_ != nullptr)
+    this->queue_capture_(this->sequence_ - 1, now, raw);
+#endif
+  // Only recording: leave the capture to the other listeners
+  return false;
+}
+
+void IrCapture::dump() {
+  uint32_t now = millis();
+  size_t n = this->ring_.size();
+  ESP_LOGI(TAG, "%u captures in %u/%u bytes (%u dropped since boot)", (unsigned) n, (unsigned) this->ring_.used(),
+           (unsigned) this->ring_.capacity(), (unsigned) this->ring_.dropped());
+  ir_common::CaptureRecord record;
+  for (size_t i = 0; this->ring_.get(i, &record); i++) {
+    ir_common::CaptureReader reader;
+    if (!reader.begin(record.data, record.length))
+      continue;
+    ESP_LOGI(TAG, "Capture %u/%u, %u s ago: %u timings in %u bytes", (unsigned) i + 1, (unsigned) n,
+             (unsigned) ((now - record.timestamp_ms) / 1000), (unsigned) reader.count(), record.length);
+
+    // Encoded form (ir_common/capture_codec.h), for host tools
+    char hex[ir_common::hex_buffer_size(HEX_BYTES_PER_LINE)];
+    for (size_t pos = 0; pos < record.length; pos += HEX_BYTES_PER_LINE) {
+      size_t len = std::min<size_t>(HEX_BYTES_PER_LINE, record.length - pos);
+      ESP_LOGI(TAG, "  enc %s", ir_common::format_hex_to(hex, sizeof(hex), record.data + pos, len));
+    }
+
+    // Timings, in the layout of `dump: raw`
+    // ", -12345" is 8 characters; room for one longer timing past the flush point
+    char line[TIMINGS_PER_LINE * 8 + 16];
+    size_t used = 0;
+    int32_t timing;
+    while (reader.next(&timing)) {
+      used += snprintf(line + used, sizeof(line) - used, used == 0 ? "%d" : ", %d", (int) timing);
+      if (used >= TIMINGS_PER_LINE * 8) {
+        ESP_LOGI(TAG, "  raw %s", line);
+        used = 0;
+      }
+    }
+    if (used != 0)
+      ESP_LOGI(TAG, "  raw %s", line);
+  }
+}
+
+void IrCapture::clear() {
+  this->ring_.clear();
+  ESP_LOGI(TAG, "Captures cleared");
+}
+
+#ifdef USE_IR_CAPTURE_STREAM
+// ======================================================================
+// ===                        BINARY STREAM                           ===
+// ======================================================================
+void IrCapture::start_server_() {
+  this->server_ = socket::socket_ip(SOCK_STREAM, 0);
+  if (this->server_ == nullptr) {
+    ESP_LOGE(TAG, "Could not create the stream socket");
+    return;
+  }
+  int enable = 1;
+  this->server_->setsockopt(SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+  this->server_->setblocking(false);
+  struct sockaddr_storage addr;
+  socklen_t addr_len = socket::set_sockaddr_any((struct sockaddr *) &addr, sizeof(addr), this->stream_port_);
+  if (this->server_->bind((struct sockaddr *) &addr, addr_len) != 0 || this->server_->listen(1) != 0) {
+    ESP_LOGE(TAG, "Could not listen on port %u: errno %d", this->stream_port_, errno);
+    this->server_ = nullptr;
+  }
+}
+
+void IrCapture::queue_hello_() {
+  size_t count;
+  const ir_common::ProtocolInfo *protocols = ir_common::known_protocols(&count);
+  uint8_t *payload = this->send_buffer_ + ir_common::STREAM_HEADER_SIZE;
+  size_t room = STREAM_SEND_BUFFER - ir_common::STREAM_HEADER_SIZE;
+  size_t length = 0;
+  for (size_t i = 0; i < count; i++) {
+    size_t name = strlen(protocols[i].name);
+    if (length + name + 1 > room)
+      break;
+    memcpy(payload + length, protocols[i].name, name);
+    length += name;
+    payload[length++] = '\n';
+  }
+  ir_common::write_stream_header({ir_common::STREAM_HELLO, ir_common::STREAM_NO_PROTOCOL, 0, this->sequence_, millis(),
+                                  uint16_t(length)},
+                                 this->send_buffer_);
+  this->send_used_ = ir_common::STREAM_HEADER_SIZE + length;
+  this->flush_();
+}
+
+void IrCapture::queue_capture_(uint32_t sequence, uint32_t now, const remote_base::RawTimings &raw) {
+  uint8_t protocol = ir_common::STREAM_NO_PROTOCOL;
+  uint8_t confidence = 0;
+  ir_common::ProtocolGuess guess;
+  if (ir_common::identify_protocol(raw.data(), raw.size(), &guess, 1) != 0) {
+    size_t count;
+    protocol = guess.protocol - ir_common::known_protocols(&count);
+    confidence = guess.confidence;
+  }
+  size_t length = ir_common::write_capture_record(sequence, now, protocol, confidence, raw.data(), raw.size(),
+                                                  this->resolution_us_, this->send_buffer_ + this->send_used_,
+                                                  STREAM_SEND_BUFFER - this->send_used_);
+  if (length == 0) {
+    // Whole records only: the reader sees the gap in the sequence
+    this->stream_dropped_++;
+    ESP_LOGW(TAG, "Stream client too slow, dropped capture %u (%u so far)", (unsigned) sequence,
+             (unsigned) this->stream_dropped_);
+    return;
+  }
+  this->send_used_ += length;
+  this->flush_();
+}
+
+void IrCapture::flush_() {
+  if (this->send_used_ == 0)
+    return;
+  ssize_t n = this->client_->write(this->send_buffer_, this->send_used_);
+  if (n < 0) {
+    if (errno != EWOULDBLOCK && errno != EAGAIN) {
+      ESP_LOGW(TAG, "Stream write failed: errno %d", errno);
+      this->close_client_();
+    }
+    return;
+  }
+  memmove(this->send_buffer_, this->send_buffer_ + n, this->send_used_ - n);
+  this->send_used_ -= n;
+}
+
+void IrCapture::close_client_() {
+  this->client_->close();
+  this->client_ = nullptr;
+  this->send_used_ = 0;
+}
+#endif
+
+}  // namespace ir_capture
+}  // namespace esphome
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/components/remote_base/remote_base.h"
+#include "esphome/components/ir_common/capture_ring.h"
+#ifdef USE_IR_CAPTURE_STREAM
+#include "esphome/components/socket/socket.h"
+#include <memory>
+#endif
+#include <cstdint>
+
+namespace esphome {
+namespace ir_capture {
+
+// Listens on a remote_receiver next to the climate platforms and keeps the
+// latest raw captures, compressed, in a RAM ring buffer. Never claims a
+// capture, so the platforms and dumpers see it as before.
+//
+// With stream_port set it also serves one TCP client at a time and sends
+// it every capture as a binary record (ir_common/capture_stream.h), tagged
+// with identify_protocol()'s best guess. Records that do not fit in the
+// send buffer are dropped whole, never blocking the loop; the sequence
+// number shows the reader where.
+
+#ifdef USE_IR_CAPTURE_STREAM
+static const size_t STREAM_SEND_BUFFER = 2048;
+#endif
+
+class IrCapture : public Component, public remote_base::RemoteReceiverListener {
+ public:
+  void set_buffer_size(size_t size) { this->buffer_size_ = size; }
+  void set_resolution(uint8_t resolution_us) { this->resolution_us_ = resolution_us; }
+  void set_stream_port(uint16_t port) { this->stream_port_ = port; }
+
+  void setup() override;
+  void loop() override;
+  void dump_config() override;
+  bool on_receive(remote_base::RemoteReceiveData data) override;
+
+  /// ir_capture.dump: logs every capture held, as encoded hex and as timings.
+  void dump();
+  /// ir_capture.clear
+  void clear();
+
+  const ir_common::CaptureRing &ring() const { return this->ring_; }
+
+ protected:
+  size_t buffer_size_{2048};
+  uint8_t resolution_us_{25};
+  ir_common::CaptureRing ring_;
+  uint32_t sequence_{0};
+  uint16_t stream_port_{0};
+#ifdef USE_IR_CAPTURE_STREAM
+  void start_server_();
+  void queue_capture_(uint32_t sequence, uint32_t now, const remote_base::RawTimings &raw);
+  void queue_hello_();
+  void flush_();
+  void close_client_();
+
+  std::unique_ptr<socket::Socket> server_;
+  std::unique_ptr<socket::Socket> client_;
+  uint8_t send_buffer_[STREAM_SEND_BUFFER];
+  size_t send_used_{0};
+  uint32_t stream_dropped_{0};
+#endif
+};
+
+}  // namespace ir_capture
+}  // namespace esphome
@@ -0,0 +1,124 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import sensor
+from esphome.const import ENTITY_CATEGORY_DIAGNOSTIC, STATE_CLASS_MEASUREMENT, UNIT_PERCENT
+
+# Shared IR helpers (packed codebook reader, ...) used by the A/C platforms.
+# Not configured directly: the platforms pull it in through AUTO_LOAD.
+ir_common_ns = cg.esphome_ns.namespace("ir_common")
+
+CONF_MIN_PUBLISH_INTERVAL = "min_publish_interval"
+CONF_CURRENT_TEMPERATURE_DEADBAND = "current_temperature_deadband"
+
+# For climate platforms with a room temperature sensor: only publish when the
+# state changed, and current-temperature updates at most this often.
+PUBLISH_GATE_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_MIN_PUBLISH_INTERVAL, default="10s"): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_CURRENT_TEMPERATURE_DEADBAND, default=0.1): cv.positive_float,
+    }
+)
+
+
+async def publish_gate_to_code(var, config):
+    cg.add(var.set_min_publish_interval(config[CONF_MIN_PUBLISH_INTERVAL]))
+    cg.add(var.set_current_temperature_deadband(config[CONF_CURRENT_TEMPERATURE_DEADBAND]))
+
+
+CONF_FLASH_WRITE_DELAY = "flash_write_delay"
+
+# The last state is kept in RTC memory at once and written to flash only after
+# it has been stable this long (see state_store.h).
+STATE_STORE_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_FLASH_WRITE_DELAY, default="5min"): cv.positive_time_period_milliseconds,
+    }
+)
+
+
+async def state_store_to_code(var, config):
+    cg.add(var.set_flash_write_delay(config[CONF_FLASH_WRITE_DELAY]))
+
+
+CONF_SIGNAL_QUALITY = "signal_quality"
+
+# For receiving platforms: how close each accepted frame came to failing to
+# decode, 0-100 (see signal_quality.h).
+SIGNAL_QUALITY_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_SIGNAL_QUALITY): sensor.sensor_schema(
+            unit_of_measurement=UNIT_PERCENT,
+            icon="mdi:signal",
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_MEASUREMENT,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+    }
+)
+
+
+async def signal_quality_to_code(var, config):
+    if CONF_SIGNAL_QUALITY in config:
+        sens = await sensor.new_sensor(config[CONF_SIGNAL_QUALITY])
+        cg.add(var.set_signal_quality_sensor(sens))
+
+
+# Values of esphome::climate::ClimateMode / ClimateFanMode / ClimateSwingMode,
+# the same numbering the codebooks use (tools/gen_codebook.py).
+CLIMATE_MODES = {"OFF": 0, "HEAT_COOL": 1, "COOL": 2, "HEAT": 3, "FAN_ONLY": 4, "DRY": 5, "AUTO": 6}
+CLIMATE_FAN_MODES = {"ON": 0, "OFF": 1, "AUTO": 2, "LOW": 3, "MEDIUM": 4, "HIGH": 5, "MIDDLE": 6,
+                     "FOCUS": 7, "DIFFUSE": 8, "QUIET": 9}
+CLIMATE_SWING_MODES = {"OFF": 0, "BOTH": 1, "VERTICAL": 2, "HORIZONTAL": 3}
+
+CONF_SUPPORTED_MODES = "supported_modes"
+CONF_SUPPORTED_FAN_MODES = "supported_fan_modes"
+CONF_SUPPORTED_SWING_MODES = "supported_swing_modes"
+CONF_MIN_TEMPERATURE = "min_temperature"
+CONF_MAX_TEMPERATURE = "max_temperature"
+CONF_TEMPERATURE_STEP = "temperature_step"
+
+
+def traits_schema(modes, fan_modes, temperature_range, swing_modes=(), step=1.0, default_range=None):
+    """Options for ConfiguredTraits. The arguments are what the protocol can
+    send and are the defaults; YAML may narrow them to what the unit has."""
+    low, high = temperature_range
+    default_low, default_high = default_range or temperature_range
+    schema = {
+        cv.Optional(CONF_SUPPORTED_MODES, default=list(modes)): cv.ensure_list(cv.one_of(*modes, upper=True)),
+        cv.Optional(CONF_SUPPORTED_FAN_MODES, default=list(fan_modes)): cv.ensure_list(
+            cv.one_of(*fan_modes, upper=True)
+        ),
+        cv.Optional(CONF_MIN_TEMPERATURE, default=default_low): cv.float_range(min=low, max=high),
+        cv.Optional(CONF_MAX_TEMPERATURE, default=default_high): cv.float_range(min=low, max=high),
+        cv.Optional(CONF_TEMPERATURE_STEP, default=step): cv.float_range(min=0.5, max=5),
+    }
+    if swing_modes:
+        schema[cv.Optional(CONF_SUPPORTED_SWING_MODES, default=list(swing_modes))] = cv.ensure_list(
+            cv.one_of(*swing_modes, upper=True)
+        )
+    return cv.Schema(schema)
+
+
+def validate_temperature_range(config):
+    if config[CONF_MIN_TEMPERATURE] > config[CONF_MAX_TEMPERATURE]:
+        raise cv.Invalid(f"{CONF_MIN_TEMPERATURE} must not be above {CONF_MAX_TEMPERATURE}")
+    return config
+
+
+def _mask(names, values):
+    mask = 0
+    for name in names:
+        mask |= 1 << values[name]
+    return mask
+
+
+async def traits_to_code(var, config):
+    cg.add(var.set_supported_modes(_mask(config[CONF_SUPPORTED_MODES], CLIMATE_MODES)))
+    cg.add(var.set_supported_fan_modes(_mask(config[CONF_SUPPORTED_FAN_MODES], CLIMATE_FAN_MODES)))
+    if CONF_SUPPORTED_SWING_MODES in config:
+        cg.add(var.set_supported_swing_modes(_mask(config[CONF_SUPPORTED_SWING_MODES], CLIMATE_SWING_MODES)))
+    cg.add(
+        var.set_temperature_range(
+            config[CONF_MIN_TEMPERATURE], config[CONF_MAX_TEMPERATURE], config[CONF_TEMPERATURE_STEP]
+        )
+    )
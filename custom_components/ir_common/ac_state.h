@@ -0,0 +1,91 @@
+#pragma once
+
+#include "esphome/components/climate/climate.h"
+#include "codebook.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace ir_common {
+
+// ======================================================================
+// ===                     PACKED CLIMATE STATE                       ===
+// ======================================================================
+// The state an IR remote can send, in one 32-bit word with the codebook key
+// layout (see codebook_key): a state is its own codebook key, equality is
+// one integer compare and temperatures compare in half degrees, not as
+// floats. Fan and swing CODEBOOK_ANY and temperature 0 mean "not set".
+// Power has no bit of its own (it is mode != OFF), so packed states stay
+// valid keys for the existing codebooks.
+
+class AcState {
+ public:
+  constexpr AcState() = default;
+  constexpr explicit AcState(uint32_t packed) : packed_(packed) {}
+  constexpr AcState(uint8_t mode, uint8_t fan, float temperature, uint8_t swing = CODEBOOK_ANY)
+      : packed_(codebook_key(mode, fan, temperature, swing)) {}
+
+  /// Snapshot of an entity. An unset fan mode reads as AUTO; swing is only
+  /// included when the caller's protocol carries it.
+  static AcState from_climate(const climate::Climate &climate, uint8_t swing = CODEBOOK_ANY) {
+    return AcState(climate.mode, climate.fan_mode.value_or(climate::CLIMATE_FAN_AUTO), climate.target_temperature,
+                   swing);
+  }
+
+  constexpr uint32_t packed() const { return this->packed_; }
+  constexpr uint8_t mode() const { return codebook_key_mode(this->packed_); }
+  constexpr uint8_t fan() const { return codebook_key_fan(this->packed_); }
+  constexpr uint8_t half_degrees() const { return (this->packed_ >> 16) & 0xFF; }
+  constexpr float temperature() const { return codebook_key_temperature(this->packed_); }
+  constexpr uint8_t swing() const { return codebook_key_swing(this->packed_); }
+  constexpr bool power() const { return this->mode() != climate::CLIMATE_MODE_OFF; }
+  constexpr bool has_fan() const { return this->fan() != CODEBOOK_ANY; }
+  constexpr bool has_temperature() const { return this->half_degrees() != 0; }
+  constexpr bool has_swing() const { return this->swing() != CODEBOOK_ANY; }
+
+  constexpr AcState with_fan(uint8_t fan) const { return AcState((this->packed_ & ~0x0000FF00u) | (uint32_t(fan) << 8)); }
+  constexpr AcState with_temperature(float temperature) const {
+    return AcState((this->packed_ & ~0x00FF0000u) | (uint32_t(codebook_half_degrees(temperature)) << 16));
+  }
+  constexpr AcState with_swing(uint8_t swing) const {
+    return AcState((this->packed_ & ~0xFF000000u) | (uint32_t(swing) << 24));
+  }
+
+  /// Writes the set fields to the entity. Returns false if it already had
+  /// them, so receivers can skip publishing repeats.
+  bool apply_to(climate::Climate *climate) const {
+    bool changed = false;
+    if (climate->mode != this->mode()) {
+      climate->mode = static_cast<climate::ClimateMode>(this->mode());
+      changed = true;
+    }
+    if (this->has_fan() && climate->fan_mode != static_cast<climate::ClimateFanMode>(this->fan())) {
+      climate->fan_mode = static_cast<climate::ClimateFanMode>(this->fan());
+      changed = true;
+    }
+    if (this->has_temperature() && codebook_half_degrees(climate->target_temperature) != this->half_degrees()) {
+      climate->target_temperature = this->temperature();
+      changed = true;
+    }
+    if (this->has_swing() && climate->swing_mode != this->swing()) {
+      climate->swing_mode = static_cast<climate::ClimateSwingMode>(this->swing());
+      changed = true;
+    }
+    return changed;
+  }
+
+  constexpr bool operator==(const AcState &other) const { return this->packed_ == other.packed_; }
+  constexpr bool operator!=(const AcState &other) const { return this->packed_ != other.packed_; }
+
+ protected:
+  // OFF, nothing else set
+  uint32_t packed_{0xFF00FF00u};
+};
+
+/// For unordered containers keyed by state; the same mix as the codebook index.
+struct AcStateHash {
+  size_t operator()(const AcState &state) const { return codebook_hash(state.packed(), 0); }
+};
+
+}  // namespace ir_common
+}  // namespace esphome
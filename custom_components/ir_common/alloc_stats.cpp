@@ -0,0 +1,104 @@
+#include "alloc_stats.h"
+#include "esphome/core/defines.h"
+#include "esphome/core/log.h"
+#include <cstdlib>
+#ifndef USE_ESP8266
+#include <atomic>
+#endif
+#ifdef USE_ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+namespace esphome {
+namespace ir_common {
+
+static const char *const TAG = "ir_common.alloc";
+
+#ifdef USE_ESP8266
+// One task and no allocating interrupts: plain counters are enough
+using Counter = uint32_t;
+#else
+// The WiFi, lwIP and API tasks allocate concurrently with the loop
+using Counter = std::atomic<uint32_t>;
+#endif
+
+struct Counters {
+  Counter count{0};
+  Counter bytes{0};
+};
+
+static Counters all;        // every task
+static Counters loop_task;  // only the loop task, which is what AllocGuard compares
+static uint32_t violations = 0;
+
+static AllocStats snapshot(const Counters &counters) { return {counters.count, counters.bytes}; }
+
+#ifdef USE_ESP32
+static TaskHandle_t tracked_task = nullptr;
+
+void alloc_track_current_task() { tracked_task = xTaskGetCurrentTaskHandle(); }
+#else
+void alloc_track_current_task() {}
+#endif
+
+#ifdef USE_IR_ALLOC_TRACKING
+#ifdef USE_ESP32
+// Until setup() names the loop task nothing is charged to the guards
+static bool on_tracked_task() { return tracked_task != nullptr && xTaskGetCurrentTaskHandle() == tracked_task; }
+#else
+static bool on_tracked_task() { return true; }
+#endif
+
+static void record(size_t size) {
+  all.count += 1;
+  all.bytes += size;
+  if (on_tracked_task()) {
+    loop_task.count += 1;
+    loop_task.bytes += size;
+  }
+}
+
+// Link-time wrappers: the linker routes every malloc/calloc/realloc call to
+// __wrap_*, and __real_* is the original allocator.
+extern "C" {
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t n, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size) {
+  record(size);
+  return __real_malloc(size);
+}
+void *__wrap_calloc(size_t n, size_t size) {
+  record(n * size);
+  return __real_calloc(n, size);
+}
+void *__wrap_realloc(void *ptr, size_t size) {
+  record(size);
+  return __real_realloc(ptr, size);
+}
+}
+
+bool alloc_tracking_enabled() { return true; }
+#else
+bool alloc_tracking_enabled() { return false; }
+#endif
+
+AllocStats alloc_stats() { return snapshot(all); }
+uint32_t alloc_violations() { return violations; }
+
+AllocGuard::AllocGuard(AllocSite &site) : site_(site), start_(snapshot(loop_task)) {}
+
+AllocGuard::~AllocGuard() {
+  AllocStats now = snapshot(loop_task);
+  uint32_t count = now.count - this->start_.count;
+  if (this->site_.passes++ == 0 || count == 0)
+    return;
+  violations++;
+  ESP_LOGW(TAG, "%s allocated %u times (%u bytes) in steady state", this->site_.name, (unsigned) count,
+           (unsigned) (now.bytes - this->start_.bytes));
+}
+
+}  // namespace ir_common
+}  // namespace esphome
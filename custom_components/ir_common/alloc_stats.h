@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace ir_common {
+
+// ======================================================================
+// ===                  HEAP ALLOCATION TRACKING                      ===
+// ======================================================================
+// Long-running ESP8266 nodes fragment the heap when every receive or send
+// allocates. With USE_IR_ALLOC_TRACKING (set by the ir_common sensor
+// platform) malloc/calloc/realloc are wrapped at link time
+// (-Wl,--wrap=malloc,...), so every allocation is counted, from C or C++.
+// The same flags work in a host build, but --wrap only reaches code that
+// is linked statically, so link with -static there (firmware always is).
+//
+// AllocGuard marks a hot path that must not allocate in steady state: the
+// first pass through each site may grow buffers that are then reused, every
+// later pass that allocates is counted and logged. Without tracking the
+// guard only counts passes.
+//
+// Guards only see allocations made on the loop task. On ESP32 the WiFi,
+// lwIP and API tasks allocate while a guard is open, so the wrappers
+// compare the current task with the one alloc_track_current_task()
+// recorded (the diagnostic sensor's setup()), and the counters are atomic.
+// The ESP8266 has one task, so every allocation is the loop's.
+
+struct AllocStats {
+  uint32_t count;  // allocations since boot
+  uint32_t bytes;  // bytes requested since boot
+};
+
+/// True when built with the malloc wrappers.
+bool alloc_tracking_enabled();
+/// Allocations on every task
+AllocStats alloc_stats();
+/// Makes the calling task the one guards charge. Call from setup().
+void alloc_track_current_task();
+/// Guarded passes that allocated, across all sites.
+uint32_t alloc_violations();
+
+struct AllocSite {
+  const char *name;
+  uint32_t passes;
+};
+
+class AllocGuard {
+ public:
+  explicit AllocGuard(AllocSite &site);
+  ~AllocGuard();
+
+ protected:
+  AllocSite &site_;
+  AllocStats start_;
+};
+
+}  // namespace ir_common
+}  // namespace esphome
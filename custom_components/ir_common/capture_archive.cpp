@@ -0,0 +1,168 @@
+#include "capture_archive.h"
+#include <cstring>
+
+namespace esphome {
+namespace ir_common {
+
+// A section of `size` bytes at `offset` lies inside the file
+static bool in_bounds(uint64_t offset, uint64_t size, size_t file_size) {
+  return offset <= file_size && size <= file_size - offset;
+}
+
+bool CaptureArchive::open(const uint8_t *data, size_t size) {
+  this->count_ = 0;
+  if (size < sizeof(ArchiveHeader) || (reinterpret_cast<uintptr_t>(data) & 7) != 0)
+    return false;
+  const auto *header = reinterpret_cast<const ArchiveHeader *>(data);
+  if (memcmp(header->magic, ARCHIVE_MAGIC, sizeof(ARCHIVE_MAGIC)) != 0 || header->version != ARCHIVE_VERSION)
+    return false;
+  uint64_t count = header->frame_count;
+  if (count > size / sizeof(ArchiveFrame) || (header->index_offset & 7) != 0 || (header->meta_offset & 7) != 0 ||
+      !in_bounds(header->timings_offset, header->timings_size, size) ||
+      !in_bounds(header->index_offset, count * sizeof(ArchiveFrame), size) ||
+      !in_bounds(header->meta_offset, count * sizeof(ArchiveMeta), size) ||
+      !in_bounds(header->nodes_offset, header->nodes_size, size) ||
+      !in_bounds(header->protocols_offset, header->protocols_size, size))
+    return false;
+
+  this->timings_ = data + header->timings_offset;
+  this->timings_size_ = header->timings_size;
+  this->frames_ = reinterpret_cast<const ArchiveFrame *>(data + header->index_offset);
+  this->metas_ = reinterpret_cast<const ArchiveMeta *>(data + header->meta_offset);
+  this->nodes_ = reinterpret_cast<const char *>(data + header->nodes_offset);
+  this->nodes_size_ = header->nodes_size;
+  this->protocols_ = reinterpret_cast<const char *>(data + header->protocols_offset);
+  this->protocols_size_ = header->protocols_size;
+  this->count_ = count;
+  return true;
+}
+
+bool CaptureArchive::capture(size_t i, CaptureReader *reader) const {
+  const ArchiveFrame &frame = this->frames_[i];
+  if (!in_bounds(frame.offset, frame.length, this->timings_size_))
+    return false;
+  return reader->begin(this->timings_ + frame.offset, frame.length);
+}
+
+// The index-th '\n' terminated entry of a name table
+static const char *table_entry(const char *table, size_t size, size_t index, size_t *length) {
+  const char *end = table + size;
+  for (const char *p = table; p < end;) {
+    const char *newline = static_cast<const char *>(memchr(p, '\n', end - p));
+    if (newline == nullptr)
+      return nullptr;
+    if (index-- == 0) {
+      *length = newline - p;
+      return p;
+    }
+    p = newline + 1;
+  }
+  return nullptr;
+}
+
+const char *CaptureArchive::node_name(uint16_t index, size_t *length) const {
+  return table_entry(this->nodes_, this->nodes_size_, index, length);
+}
+
+const char *CaptureArchive::protocol_name(uint8_t index, size_t *length) const {
+  return table_entry(this->protocols_, this->protocols_size_, index, length);
+}
+
+#ifdef IR_COMMON_HOST_TOOL
+CaptureArchiveWriter::~CaptureArchiveWriter() {
+  if (this->file_ != nullptr)
+    fclose(this->file_);
+}
+
+bool CaptureArchiveWriter::open(const char *path) {
+  this->file_ = fopen(path, "wb");
+  if (this->file_ == nullptr)
+    return false;
+  // Placeholder until finish() knows the section offsets
+  this->offset_ = 0;
+  return this->write_(&this->header_, sizeof(this->header_));
+}
+
+static size_t intern(std::vector<std::string> *names, const char *name, size_t limit) {
+  for (size_t i = 0; i < names->size(); i++) {
+    if ((*names)[i] == name)
+      return i;
+  }
+  if (names->size() == limit || strchr(name, '\n') != nullptr)
+    return limit;
+  names->push_back(name);
+  return names->size() - 1;
+}
+
+uint16_t CaptureArchiveWriter::node(const char *name) { return intern(&this->nodes_, name, ARCHIVE_NO_NODE); }
+
+uint8_t CaptureArchiveWriter::protocol(const char *name) {
+  return intern(&this->protocols_, name, ARCHIVE_NO_PROTOCOL);
+}
+
+bool CaptureArchiveWriter::add(const int32_t *timings, size_t count, uint8_t quantum_us, const ArchiveMeta &meta) {
+  if (count > UINT32_MAX)
+    return false;
+  this->buffer_.resize(capture_encoded_max(count));
+  size_t length = encode_capture(timings, count, quantum_us, this->buffer_.data(), this->buffer_.size());
+  if (length == 0)
+    return false;
+  ArchiveFrame frame{this->offset_ - sizeof(ArchiveHeader), uint32_t(length), uint32_t(count)};
+  if (!this->write_(this->buffer_.data(), length))
+    return false;
+  this->frames_.push_back(frame);
+  this->metas_.push_back(meta);
+  return true;
+}
+
+bool CaptureArchiveWriter::write_(const void *data, size_t size) {
+  if (this->failed_ || fwrite(data, 1, size, this->file_) != size) {
+    this->failed_ = true;
+    return false;
+  }
+  this->offset_ += size;
+  return true;
+}
+
+bool CaptureArchiveWriter::pad_() {
+  static const uint8_t ZEROS[8] = {};
+  return this->write_(ZEROS, (8 - this->offset_ % 8) % 8);
+}
+
+bool CaptureArchiveWriter::finish() {
+  if (this->file_ == nullptr)
+    return false;
+  ArchiveHeader &header = this->header_;
+  memcpy(header.magic, ARCHIVE_MAGIC, sizeof(ARCHIVE_MAGIC));
+  header.version = ARCHIVE_VERSION;
+  header.frame_count = this->frames_.size();
+  header.timings_offset = sizeof(ArchiveHeader);
+  header.timings_size = this->offset_ - sizeof(ArchiveHeader);
+
+  this->pad_();
+  header.index_offset = this->offset_;
+  this->write_(this->frames_.data(), this->frames_.size() * sizeof(ArchiveFrame));
+  header.meta_offset = this->offset_;
+  this->write_(this->metas_.data(), this->metas_.size() * sizeof(ArchiveMeta));
+
+  auto write_names = [this](const std::vector<std::string> &names, uint64_t *offset, uint64_t *size) {
+    *offset = this->offset_;
+    for (const std::string &name : names) {
+      this->write_(name.data(), name.size());
+      this->write_("\n", 1);
+    }
+    *size = this->offset_ - *offset;
+  };
+  write_names(this->nodes_, &header.nodes_offset, &header.nodes_size);
+  write_names(this->protocols_, &header.protocols_offset, &header.protocols_size);
+
+  bool ok = !this->failed_ && fseek(this->file_, 0, SEEK_SET) == 0 &&
+            fwrite(&header, 1, sizeof(header), this->file_) == sizeof(header);
+  ok &= fclose(this->file_) == 0;
+  this->file_ = nullptr;
+  return ok;
+}
+#endif
+
+}  // namespace ir_common
+}  // namespace esphome
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "capture_codec.h"
+#include <cstddef>
+#include <cstdint>
+#ifdef IR_COMMON_HOST_TOOL
+#include <cstdio>
+#include <string>
+#include <vector>
+#endif
+
+namespace esphome {
+namespace ir_common {
+
+// ======================================================================
+// ===               COLUMNAR CAPTURE ARCHIVE (.irca)                 ===
+// ======================================================================
+// A corpus of captures in one file that host tools map into memory and
+// read in place, with no parsing step on open. Little endian, every
+// section 8-byte aligned:
+//
+//   ArchiveHeader                  magic, frame count, section offsets
+//   timings column                 capture_codec.h encodings, back to back
+//   ArchiveFrame[frame_count]      index: where each capture's bytes are
+//   ArchiveMeta[frame_count]       node, timestamp, labelled state, guess
+//   node names, protocol names     '\n' separated
+//
+// A tool that only needs labels or timestamps touches the metadata column
+// and never pages in the timings. The index and metadata columns are
+// written last, so a capture session can append to the timings column
+// without knowing how many captures will come.
+
+static const uint8_t ARCHIVE_MAGIC[4] = {'I', 'R', 'C', 'A'};
+static const uint32_t ARCHIVE_VERSION = 1;
+/// ArchiveMeta::state of a capture nobody labelled
+static const uint32_t ARCHIVE_NO_STATE = 0xFFFFFFFF;
+static const uint16_t ARCHIVE_NO_NODE = 0xFFFF;
+static const uint8_t ARCHIVE_NO_PROTOCOL = 0xFF;
+
+struct ArchiveHeader {
+  uint8_t magic[4];
+  uint32_t version;  // also catches a big-endian reader: 1 reads as 0x01000000
+  uint64_t frame_count;
+  uint64_t timings_offset;
+  uint64_t timings_size;
+  uint64_t index_offset;
+  uint64_t meta_offset;
+  uint64_t nodes_offset;
+  uint64_t nodes_size;
+  uint64_t protocols_offset;
+  uint64_t protocols_size;
+};
+
+struct ArchiveFrame {
+  uint64_t offset;  // into the timings column
+  uint32_t length;  // encoded bytes
+  uint32_t count;   // timings
+};
+
+struct ArchiveMeta {
+  uint64_t timestamp_ms;  // as the source recorded it (node millis() for streams), 0 if unknown
+  uint32_t state;         // AcState::packed() of the label, ARCHIVE_NO_STATE if none
+  uint16_t node;          // index into the node names
+  uint8_t protocol;       // index into the protocol names, best guess when archived
+  uint8_t confidence;     // of that guess, 0-100
+};
+
+static_assert(sizeof(ArchiveHeader) == 80, "ArchiveHeader is a file layout");
+static_assert(sizeof(ArchiveFrame) == 16, "ArchiveFrame is a file layout");
+static_assert(sizeof(ArchiveMeta) == 16, "ArchiveMeta is a file layout");
+
+/// Read-only view of an archive already in memory (usually mmap'd). open()
+/// checks the header and section bounds only; each capture's bounds are
+/// checked when it is read, so opening costs the same for any size.
+class CaptureArchive {
+ public:
+  /// False if `data` is not an archive of this version or a section runs
+  /// past `size`. `data` must be 8-byte aligned and outlive the view.
+  bool open(const uint8_t *data, size_t size);
+  size_t size() const { return this->count_; }
+  const ArchiveFrame &frame(size_t i) const { return this->frames_[i]; }
+  const ArchiveMeta &meta(size_t i) const { return this->metas_[i]; }
+  /// Starts `reader` on capture i. False if its bytes are out of bounds.
+  bool capture(size_t i, CaptureReader *reader) const;
+  /// Name of node / protocol `index`, not terminated. Null if there is none.
+  const char *node_name(uint16_t index, size_t *length) const;
+  const char *protocol_name(uint8_t index, size_t *length) const;
+
+ protected:
+  const uint8_t *timings_{nullptr};
+  size_t timings_size_{0};
+  const ArchiveFrame *frames_{nullptr};
+  const ArchiveMeta *metas_{nullptr};
+  size_t count_{0};
+  const char *nodes_{nullptr};
+  size_t nodes_size_{0};
+  const char *protocols_{nullptr};
+  size_t protocols_size_{0};
+};
+
+#ifdef IR_COMMON_HOST_TOOL
+/// Writes an archive in one pass. Timings go to the file as they are added;
+/// the index and metadata (32 bytes a capture) are held until finish().
+class CaptureArchiveWriter {
+ public:
+  ~CaptureArchiveWriter();
+  bool open(const char *path);
+  /// Index of `name` in the node or protocol names, added on first use.
+  /// ARCHIVE_NO_NODE / ARCHIVE_NO_PROTOCOL once the table is full.
+  uint16_t node(const char *name);
+  uint8_t protocol(const char *name);
+  /// False on a write error or timings that do not alternate.
+  bool add(const int32_t *timings, size_t count, uint8_t quantum_us, const ArchiveMeta &meta);
+  /// Writes the columns and the header. False on a write error.
+  bool finish();
+  size_t size() const { return this->frames_.size(); }
+
+ protected:
+  bool write_(const void *data, size_t size);
+  bool pad_();
+  FILE *file_{nullptr};
+  uint64_t offset_{0};
+  ArchiveHeader header_{};
+  std::vector<ArchiveFrame> frames_;
+  std::vector<ArchiveMeta> metas_;
+  std::vector<std::string> nodes_;
+  std::vector<std::string> protocols_;
+  std::vector<uint8_t> buffer_;
+  bool failed_{false};
+};
+#endif
+
+}  // namespace ir_common
+}  // namespace esphome
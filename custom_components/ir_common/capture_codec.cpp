@@ -0,0 +1,97 @@
+#include "capture_codec.h"
+#include <cstdlib>
+
+namespace esphome {
+namespace ir_common {
+
+static uint32_t zigzag(int32_t v) { return (uint32_t(v) << 1) ^ uint32_t(v >> 31); }
+static int32_t unzigzag(uint32_t v) { return int32_t(v >> 1) ^ -int32_t(v & 1); }
+
+size_t write_varint(uint32_t value, uint8_t *out, size_t size) {
+  size_t n = 0;
+  do {
+    if (n == size)
+      return 0;
+    uint8_t b = value & 0x7F;
+    value >>= 7;
+    out[n++] = value != 0 ? b | 0x80 : b;
+  } while (value != 0);
+  return n;
+}
+
+size_t read_varint(const uint8_t *data, size_t size, uint32_t *value) {
+  uint32_t v = 0;
+  for (size_t n = 0; n < size && n < 5; n++) {
+    v |= uint32_t(data[n] & 0x7F) << (7 * n);
+    if ((data[n] & 0x80) == 0) {
+      *value = v;
+      return n + 1;
+    }
+  }
+  return 0;
+}
+
+size_t encode_capture(const int32_t *timings, size_t count, uint8_t quantum_us, uint8_t *out, size_t size) {
+  if (quantum_us == 0 || size < 2)
+    return 0;
+  bool first_is_space = count != 0 && timings[0] < 0;
+  out[0] = quantum_us;
+  out[1] = first_is_space ? CAPTURE_FIRST_IS_SPACE : 0;
+  size_t pos = 2;
+  size_t n = write_varint(count, out + pos, size - pos);
+  if (n == 0)
+    return 0;
+  pos += n;
+
+  uint32_t last[2] = {0, 0};
+  for (size_t i = 0; i < count; i++) {
+    bool space = timings[i] < 0;
+    if (space != (first_is_space != (i % 2 == 1)))
+      return 0;  // two marks or two spaces in a row
+    uint32_t q = (uint32_t(std::abs(timings[i])) + quantum_us / 2) / quantum_us;
+    n = write_varint(zigzag(int32_t(q - last[space])), out + pos, size - pos);
+    if (n == 0)
+      return 0;
+    pos += n;
+    last[space] = q;
+  }
+  return pos;
+}
+
+bool CaptureReader::begin(const uint8_t *data, size_t size) {
+  this->data_ = data;
+  this->size_ = size;
+  this->index_ = 0;
+  this->last_[0] = this->last_[1] = 0;
+  if (size < 2 || data[0] == 0)
+    return false;
+  this->quantum_ = data[0];
+  this->first_is_space_ = (data[1] & CAPTURE_FIRST_IS_SPACE) != 0;
+  uint32_t count;
+  size_t n = read_varint(data + 2, size - 2, &count);
+  if (n == 0)
+    return false;
+  this->count_ = count;
+  this->pos_ = 2 + n;
+  return true;
+}
+
+bool CaptureReader::next(int32_t *timing) {
+  if (this->index_ >= this->count_)
+    return false;
+  uint32_t zz;
+  size_t n = read_varint(this->data_ + this->pos_, this->size_ - this->pos_, &zz);
+  if (n == 0)
+    return false;
+  this->pos_ += n;
+  bool space = this->first_is_space_ != (this->index_ % 2 == 1);
+  uint32_t q = this->last_[space] + unzigzag(zz);
+  this->last_[space] = q;
+  this->index_++;
+  int32_t duration = int32_t(q * this->quantum_);
+  *timing = space ? -duration : duration;
+  return true;
+}
+
+}  // namespace ir_common
+}  // namespace esphome
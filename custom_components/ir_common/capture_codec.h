@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace ir_common {
+
+// ======================================================================
+// ===               COMPACT RAW CAPTURE ENCODING                     ===
+// ======================================================================
+// A raw capture alternates marks (positive) and spaces (negative). Stored
+// as int32 that is 4 bytes a timing; this encoding is usually 1:
+//
+//   byte    quantum_us        durations are rounded to multiples of this
+//   byte    flags             bit 0: the first timing is a space
+//   varint  count             timings
+//   varint  zigzag(q[i] - q[i-2])  per timing, q = duration / quantum
+//
+// Each timing is coded against the previous one of the same kind (mark
+// against mark, space against space), so steady bit timings give deltas
+// near zero and only 0/1 changes cost a second byte. Signs are implied by
+// the alternation. The firmware ring buffer, the binary stream and the
+// host tools all use this one codec.
+
+static const uint8_t CAPTURE_FIRST_IS_SPACE = 0x01;
+static const size_t CAPTURE_HEADER_MAX = 2 + 5;
+
+/// Worst-case encoded size of `count` timings.
+constexpr size_t capture_encoded_max(size_t count) { return CAPTURE_HEADER_MAX + count * 5; }
+
+/// Encodes into `out`. Returns the bytes written, or 0 if `out` is too
+/// small, quantum_us is 0, or the signs do not alternate.
+size_t encode_capture(const int32_t *timings, size_t count, uint8_t quantum_us, uint8_t *out, size_t size);
+
+/// Reads timings back one at a time, so a capture can be logged or
+/// streamed without a timings buffer.
+class CaptureReader {
+ public:
+  /// False if the header is truncated.
+  bool begin(const uint8_t *data, size_t size);
+  size_t count() const { return this->count_; }
+  uint8_t quantum_us() const { return this->quantum_; }
+  /// Next timing, false after the last one or on truncated data.
+  bool next(int32_t *timing);
+
+ protected:
+  const uint8_t *data_{nullptr};
+  size_t size_{0};
+  size_t pos_{0};
+  size_t count_{0};
+  size_t index_{0};
+  uint8_t quantum_{1};
+  bool first_is_space_{false};
+  uint32_t last_[2]{};  // previous mark / space, in quanta
+};
+
+/// LEB128: 7 bits a byte, low first. Returns the bytes written, 0 if they do not fit.
+size_t write_varint(uint32_t value, uint8_t *out, size_t size);
+/// Returns the bytes read, 0 on truncated or over-long input.
+size_t read_varint(const uint8_t *data, size_t size, uint32_t *value);
+
+}  // namespace ir_common
+}  // namespace esphome
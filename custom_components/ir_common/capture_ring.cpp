@@ -0,0 +1,72 @@
+#include "capture_ring.h"
+#include <cstring>
+
+namespace esphome {
+namespace ir_common {
+
+static const size_t RECORD_HEADER = 6;
+
+static uint16_t record_length(const uint8_t *record) { return record[4] | (record[5] << 8); }
+
+void CaptureRing::init(size_t capacity) {
+  this->arena_.reset(new uint8_t[capacity]);
+  this->capacity_ = capacity;
+  this->clear();
+}
+
+void CaptureRing::clear() {
+  this->used_ = 0;
+  this->records_ = 0;
+}
+
+void CaptureRing::evict_oldest_() {
+  size_t length = RECORD_HEADER + record_length(this->arena_.get());
+  memmove(this->arena_.get(), this->arena_.get() + length, this->used_ - length);
+  this->used_ -= length;
+  this->records_--;
+  this->dropped_++;
+}
+
+bool CaptureRing::push(uint32_t timestamp_ms, const int32_t *timings, size_t count, uint8_t quantum_us) {
+  if (this->capacity_ <= RECORD_HEADER)
+    return false;
+  // Typical size first (about a byte a timing), evicting more only if the encoder runs out
+  size_t want = RECORD_HEADER + CAPTURE_HEADER_MAX + count;
+  while (this->records_ != 0 && this->capacity_ - this->used_ < want)
+    this->evict_oldest_();
+
+  for (;;) {
+    uint8_t *record = this->arena_.get() + this->used_;
+    size_t room = this->capacity_ - this->used_ - RECORD_HEADER;
+    size_t length =
+        encode_capture(timings, count, quantum_us, record + RECORD_HEADER, room > UINT16_MAX ? UINT16_MAX : room);
+    if (length != 0) {
+      memcpy(record, &timestamp_ms, 4);
+      record[4] = length & 0xFF;
+      record[5] = length >> 8;
+      this->used_ += RECORD_HEADER + length;
+      this->records_++;
+      return true;
+    }
+    if (this->records_ == 0) {
+      this->dropped_++;
+      return false;
+    }
+    this->evict_oldest_();
+  }
+}
+
+bool CaptureRing::get(size_t index, CaptureRecord *out) const {
+  if (index >= this->records_)
+    return false;
+  const uint8_t *record = this->arena_.get();
+  for (size_t i = 0; i < index; i++)
+    record += RECORD_HEADER + record_length(record);
+  memcpy(&out->timestamp_ms, record, 4);
+  out->length = record_length(record);
+  out->data = record + RECORD_HEADER;
+  return true;
+}
+
+}  // namespace ir_common
+}  // namespace esphome
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "capture_codec.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace esphome {
+namespace ir_common {
+
+// ======================================================================
+// ===                   RECENT CAPTURE RING BUFFER                   ===
+// ======================================================================
+// Keeps as many of the latest raw captures as fit in a fixed RAM arena,
+// each compressed with encode_capture(). A new capture evicts the oldest
+// ones until it fits. Records are packed oldest first and evicted by one
+// memmove of the arena, which is cheaper than wrapping records around the
+// end on buffers this size.
+//
+//   record := u32 timestamp_ms, u16 length, length bytes of encoded capture
+
+struct CaptureRecord {
+  uint32_t timestamp_ms;
+  const uint8_t *data;
+  uint16_t length;
+};
+
+class CaptureRing {
+ public:
+  /// Allocates the arena once; call from setup().
+  void init(size_t capacity);
+  /// False if the capture does not fit even in an empty arena.
+  bool push(uint32_t timestamp_ms, const int32_t *timings, size_t count, uint8_t quantum_us);
+  void clear();
+
+  /// Captures held.
+  size_t size() const { return this->records_; }
+  size_t used() const { return this->used_; }
+  size_t capacity() const { return this->capacity_; }
+  /// Captures evicted or rejected since boot.
+  uint32_t dropped() const { return this->dropped_; }
+  /// `index` 0 is the oldest capture held.
+  bool get(size_t index, CaptureRecord *record) const;
+
+ protected:
+  void evict_oldest_();
+
+  std::unique_ptr<uint8_t[]> arena_;
+  size_t capacity_{0};
+  size_t used_{0};
+  size_t records_{0};
+  uint32_t dropped_{0};
+};
+
+}  // namespace ir_common
+}  // namespace esphome
@@ -0,0 +1,59 @@
+#include "capture_stream.h"
+#include "capture_codec.h"
+
+namespace esphome {
+namespace ir_common {
+
+static void put_u16(uint8_t *out, uint16_t v) {
+  out[0] = v & 0xFF;
+  out[1] = v >> 8;
+}
+
+static void put_u32(uint8_t *out, uint32_t v) {
+  put_u16(out, v & 0xFFFF);
+  put_u16(out + 2, v >> 16);
+}
+
+static uint16_t get_u16(const uint8_t *in) { return in[0] | (in[1] << 8); }
+static uint32_t get_u32(const uint8_t *in) { return get_u16(in) | (uint32_t(get_u16(in + 2)) << 16); }
+
+void write_stream_header(const StreamHeader &header, uint8_t *out) {
+  out[0] = STREAM_MAGIC_0;
+  out[1] = STREAM_MAGIC_1;
+  out[2] = header.type;
+  out[3] = header.protocol;
+  out[4] = header.confidence;
+  out[5] = 0;
+  put_u32(out + 6, header.sequence);
+  put_u32(out + 10, header.timestamp_ms);
+  put_u16(out + 14, header.length);
+}
+
+bool read_stream_header(const uint8_t *data, StreamHeader *header) {
+  if (data[0] != STREAM_MAGIC_0 || data[1] != STREAM_MAGIC_1)
+    return false;
+  header->type = data[2];
+  header->protocol = data[3];
+  header->confidence = data[4];
+  header->sequence = get_u32(data + 6);
+  header->timestamp_ms = get_u32(data + 10);
+  header->length = get_u16(data + 14);
+  return true;
+}
+
+size_t write_capture_record(uint32_t sequence, uint32_t timestamp_ms, uint8_t protocol, uint8_t confidence,
+                            const int32_t *timings, size_t count, uint8_t quantum_us, uint8_t *out, size_t size) {
+  if (size <= STREAM_HEADER_SIZE)
+    return 0;
+  size_t room = size - STREAM_HEADER_SIZE;
+  size_t length =
+      encode_capture(timings, count, quantum_us, out + STREAM_HEADER_SIZE, room > UINT16_MAX ? UINT16_MAX : room);
+  if (length == 0)
+    return 0;
+  write_stream_header(StreamHeader{STREAM_CAPTURE, protocol, confidence, sequence, timestamp_ms, uint16_t(length)},
+                      out);
+  return STREAM_HEADER_SIZE + length;
+}
+
+}  // namespace ir_common
+}  // namespace esphome
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace ir_common {
+
+// ======================================================================
+// ===                  BINARY CAPTURE STREAM RECORDS                 ===
+// ======================================================================
+// Framing for captures sent to a host (ir_capture's stream_port, read by
+// tools/ir_stream.py). All integers are little endian:
+//
+//   u8[2] magic        'I' 'R'
+//   u8    type         STREAM_HELLO or STREAM_CAPTURE
+//   u8    protocol     index into the hello's protocol list, 0xFF = none
+//   u8    confidence   0-100, identify_protocol()'s score
+//   u8    reserved
+//   u32   sequence     captures since boot; a gap means records were dropped
+//   u32   timestamp_ms millis() when the capture arrived
+//   u16   length       payload bytes
+//   payload            hello: protocol names, '\n' separated
+//                      capture: capture_codec.h encoding
+//
+// A client gets one hello on connect, then a record per capture.
+
+static const uint8_t STREAM_MAGIC_0 = 'I';
+static const uint8_t STREAM_MAGIC_1 = 'R';
+static const uint8_t STREAM_HELLO = 1;
+static const uint8_t STREAM_CAPTURE = 2;
+static const uint8_t STREAM_NO_PROTOCOL = 0xFF;
+static const size_t STREAM_HEADER_SIZE = 16;
+
+struct StreamHeader {
+  uint8_t type;
+  uint8_t protocol;
+  uint8_t confidence;
+  uint32_t sequence;
+  uint32_t timestamp_ms;
+  uint16_t length;
+};
+
+/// Writes the header for a payload of header.length bytes.
+void write_stream_header(const StreamHeader &header, uint8_t *out);
+/// False if the magic does not match.
+bool read_stream_header(const uint8_t *data, StreamHeader *header);
+
+/// A whole capture record (header and encoded timings). Returns the bytes
+/// written, 0 if it does not fit in `size`.
+size_t write_capture_record(uint32_t sequence, uint32_t timestamp_ms, uint8_t protocol, uint8_t confidence,
+                            const int32_t *timings, size_t count, uint8_t quantum_us, uint8_t *out, size_t size);
+
+}  // namespace ir_common
+}  // namespace esphome
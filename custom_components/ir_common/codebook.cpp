@@ -0,0 +1,90 @@
+#include "codebook.h"
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+namespace ir_common {
+
+static const char *const MODE_NAMES[] = {"OFF", "HEAT_COOL", "COOL", "HEAT", "FAN_ONLY", "DRY", "AUTO"};
+static const char *const FAN_NAMES[] = {"ON",   "OFF",    "AUTO",  "LOW",     "MEDIUM",
+                                        "HIGH", "MIDDLE", "FOCUS", "DIFFUSE", "QUIET"};
+static const char *const SWING_NAMES[] = {"OFF", "BOTH", "VERTICAL", "HORIZONTAL"};
+
+template<size_t N> static bool index_of_name(const char *const (&names)[N], const std::string &name, uint8_t *out) {
+  for (size_t i = 0; i < N; i++) {
+    if (str_equals_case_insensitive(name, names[i])) {
+      *out = i;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool codebook_mode_from_name(const std::string &name, uint8_t *mode) { return index_of_name(MODE_NAMES, name, mode); }
+bool codebook_fan_from_name(const std::string &name, uint8_t *fan) { return index_of_name(FAN_NAMES, name, fan); }
+bool codebook_swing_from_name(const std::string &name, uint8_t *swing) {
+  return index_of_name(SWING_NAMES, name, swing);
+}
+
+static inline uint16_t pgm_u16(const uint8_t *p) {
+  return uint16_t(progmem_read_byte(p)) | (uint16_t(progmem_read_byte(p + 1)) << 8);
+}
+
+static inline uint32_t pgm_u32(const uint8_t *p) {
+  return uint32_t(pgm_u16(p)) | (uint32_t(pgm_u16(p + 2)) << 16);
+}
+
+Codebook::Codebook(const uint8_t *blob, size_t size) : blob_(blob), blob_size_(size) {
+  // Runs during static initialisation, so no logging here; components
+  // report is_valid() from dump_config().
+  if (blob == nullptr || size < CODEBOOK_HEADER_SIZE)
+    return;
+  if (this->read_u32_(0) != CODEBOOK_MAGIC || progmem_read_byte(blob + 4) != CODEBOOK_VERSION)
+    return;
+  this->format_ = progmem_read_byte(blob + 5);
+  this->count_ = this->read_u16_(6);
+  this->buckets_ = this->read_u16_(8);
+  this->stride_ = this->read_u16_(10);
+  this->carrier_khz_ = progmem_read_byte(blob + 12);
+  this->max_length_ = this->read_u16_(14);
+
+  size_t expected = CODEBOOK_HEADER_SIZE + size_t(this->buckets_) * 2 + size_t(this->count_) * this->stride_;
+  this->valid_ = this->count_ > 0 && this->buckets_ > 0 && expected == size;
+}
+
+uint16_t Codebook::read_u16_(size_t offset) const { return pgm_u16(this->blob_ + offset); }
+uint32_t Codebook::read_u32_(size_t offset) const { return pgm_u32(this->blob_ + offset); }
+
+bool Codebook::get(uint16_t index, CodebookRecord *out) const {
+  if (!this->valid_ || index >= this->count_)
+    return false;
+  size_t offset = CODEBOOK_HEADER_SIZE + size_t(this->buckets_) * 2 + size_t(index) * this->stride_;
+  out->key = this->read_u32_(offset);
+  out->length = this->read_u16_(offset + 4);
+  out->payload = this->blob_ + offset + CODEBOOK_RECORD_HEADER_SIZE;
+  return true;
+}
+
+bool Codebook::find(uint32_t key, CodebookRecord *out) const {
+  if (!this->valid_)
+    return false;
+  uint16_t bucket = codebook_hash(key, 0) % this->buckets_;
+  uint16_t seed = this->read_u16_(CODEBOOK_HEADER_SIZE + size_t(bucket) * 2);
+  uint16_t slot = codebook_hash(key, seed) % this->count_;
+  if (!this->get(slot, out))
+    return false;
+  return out->key == key;
+}
+
+int32_t Codebook::read_timing(const CodebookRecord &rec, size_t i) {
+  return static_cast<int16_t>(pgm_u16(rec.payload + i * 2));
+}
+
+size_t Codebook::read_bytes(const CodebookRecord &rec, uint8_t *dst, size_t max_len) {
+  size_t len = rec.length < max_len ? rec.length : max_len;
+  for (size_t i = 0; i < len; i++)
+    dst[i] = progmem_read_byte(rec.payload + i);
+  return len;
+}
+
+}  // namespace ir_common
+}  // namespace esphome
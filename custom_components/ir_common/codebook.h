@@ -0,0 +1,140 @@
+#pragma once
+
+#include "esphome/core/hal.h"
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+
+namespace esphome {
+namespace ir_common {
+
+// ======================================================================
+// ===                  PACKED CODEBOOK BLOB FORMAT                   ===
+// ======================================================================
+// Produced by tools/gen_codebook.py from codebooks/*.json. The blob is a
+// single PROGMEM array read in place, all fields little-endian:
+//
+//   Header (16 bytes)
+//     0  u32  magic "IRCB"
+//     4  u8   version
+//     5  u8   payload format (CODEBOOK_FORMAT_*)
+//     6  u16  record count n
+//     8  u16  bucket count b
+//    10  u16  record stride in bytes
+//    12  u8   carrier frequency in kHz
+//    13  u8   reserved
+//    14  u16  max payload length (entries for RAW16, bytes for BYTES)
+//   Displacement table: b x u16
+//   Records: n x stride
+//     0  u32  key (see codebook_key)
+//     4  u16  payload length
+//     6  u16  reserved
+//     8  ...  payload (int16 timings or frame bytes)
+//
+// Lookup is a two-level minimal perfect hash: the key picks a bucket, the
+// bucket's displacement re-seeds the hash, and the result is the record
+// slot. The stored key is compared to reject states that are not in the
+// book, so a lookup is always two hashes and one key compare.
+
+static const uint32_t CODEBOOK_MAGIC = 0x42435249;  // "IRCB"
+static const uint8_t CODEBOOK_VERSION = 1;
+static const size_t CODEBOOK_HEADER_SIZE = 16;
+static const size_t CODEBOOK_RECORD_HEADER_SIZE = 8;
+
+static const uint8_t CODEBOOK_FORMAT_RAW16 = 0;  // signed µs timings, mark > 0, space < 0
+static const uint8_t CODEBOOK_FORMAT_BYTES = 1;  // protocol frame bytes, MSB first
+
+// Wildcard for fan / swing in keys where the code does not depend on it.
+static const uint8_t CODEBOOK_ANY = 0xFF;
+
+/**
+ * @brief Packs a climate state into a codebook key.
+ * mode in bits 0-7, fan in 8-15, half-degree temperature in 16-23
+ * (0 = not part of the key), swing in 24-31.
+ */
+/// Temperature in half degrees, rounded; 0 (not set) for NaN and non-positive values.
+constexpr uint8_t codebook_half_degrees(float temperature) {
+  if (!(temperature > 0.0f))
+    return 0;
+  return temperature * 2.0f + 0.5f >= 255.0f ? 0xFF : static_cast<uint8_t>(temperature * 2.0f + 0.5f);
+}
+
+constexpr uint32_t codebook_key(uint8_t mode, uint8_t fan, float temperature, uint8_t swing) {
+  return uint32_t(mode) | (uint32_t(fan) << 8) | (uint32_t(codebook_half_degrees(temperature)) << 16) |
+         (uint32_t(swing) << 24);
+}
+
+constexpr uint8_t codebook_key_mode(uint32_t key) { return key & 0xFF; }
+constexpr uint8_t codebook_key_fan(uint32_t key) { return (key >> 8) & 0xFF; }
+constexpr float codebook_key_temperature(uint32_t key) { return ((key >> 16) & 0xFF) / 2.0f; }
+constexpr uint8_t codebook_key_swing(uint32_t key) { return key >> 24; }
+
+/// Case-insensitive enum names as used in codebooks/*.json ("FAN_ONLY", "LOW").
+/// Must match MODES / FANS / SWINGS in tools/gen_codebook.py.
+bool codebook_mode_from_name(const std::string &name, uint8_t *mode);
+bool codebook_fan_from_name(const std::string &name, uint8_t *fan);
+bool codebook_swing_from_name(const std::string &name, uint8_t *swing);
+
+/// Must match codebook_hash() in tools/gen_codebook.py.
+inline uint32_t codebook_hash(uint32_t key, uint32_t seed) {
+  uint32_t h = key ^ (seed * 0x9E3779B9u);
+  h ^= h >> 16;
+  h *= 0x85EBCA6Bu;
+  h ^= h >> 13;
+  h *= 0xC2B2AE35u;
+  h ^= h >> 16;
+  return h;
+}
+
+struct CodebookRecord {
+  uint32_t key{0};
+  uint16_t length{0};
+  const uint8_t *payload{nullptr};  // points into flash, read with the accessors below
+};
+
+class Codebook {
+ public:
+  Codebook(const uint8_t *blob, size_t size);
+
+  bool is_valid() const { return this->valid_; }
+  uint8_t format() const { return this->format_; }
+  uint16_t size() const { return this->count_; }
+  uint16_t max_length() const { return this->max_length_; }
+  uint32_t carrier_frequency() const { return uint32_t(this->carrier_khz_) * 1000; }
+
+  /// O(1) lookup of a packed state key. Returns false if the state is not in the book.
+  bool find(uint32_t key, CodebookRecord *out) const;
+  /// First hit among keys, in order: "exact state, else the nearest one we have".
+  bool find_first(std::initializer_list<uint32_t> keys, CodebookRecord *out) const {
+    for (uint32_t key : keys) {
+      if (this->find(key, out))
+        return true;
+    }
+    return false;
+  }
+  /// Record by slot index, for iterating the whole book.
+  bool get(uint16_t index, CodebookRecord *out) const;
+
+  /// i-th timing of a RAW16 record.
+  static int32_t read_timing(const CodebookRecord &rec, size_t i);
+  /// Copies a BYTES record into RAM, returns the number of bytes copied.
+  static size_t read_bytes(const CodebookRecord &rec, uint8_t *dst, size_t max_len);
+
+ protected:
+  uint16_t read_u16_(size_t offset) const;
+  uint32_t read_u32_(size_t offset) const;
+
+  const uint8_t *blob_;
+  size_t blob_size_;
+  bool valid_{false};
+  uint8_t format_{0};
+  uint8_t carrier_khz_{0};
+  uint16_t count_{0};
+  uint16_t buckets_{0};
+  uint16_t stride_{0};
+  uint16_t max_length_{0};
+};
+
+}  // namespace ir_common
+}  // namespace esphome
@@ -0,0 +1,42 @@
+#include "configured_traits.h"
+
+namespace esphome {
+namespace ir_common {
+
+// ClimateMode, ClimateFanMode and ClimateSwingMode all fit in the 32-bit masks
+static const uint8_t MASK_BITS = 32;
+
+const climate::ClimateTraits &ConfiguredTraits::cached_traits_(bool supports_current_temperature) {
+  if (this->traits_built_)
+    return this->traits_;
+
+  climate::ClimateTraits traits;
+  traits.set_supports_current_temperature(supports_current_temperature);
+  for (uint8_t i = 0; i < MASK_BITS; i++) {
+    if (this->modes_ & (1u << i))
+      traits.add_supported_mode(static_cast<climate::ClimateMode>(i));
+    if (this->fan_modes_ & (1u << i))
+      traits.add_supported_fan_mode(static_cast<climate::ClimateFanMode>(i));
+    if (this->swing_modes_ & (1u << i))
+      traits.add_supported_swing_mode(static_cast<climate::ClimateSwingMode>(i));
+  }
+  traits.set_visual_min_temperature(this->min_temperature_);
+  traits.set_visual_max_temperature(this->max_temperature_);
+  traits.set_visual_temperature_step(this->temperature_step_);
+  this->extend_traits_(traits);
+
+  this->traits_ = traits;
+  this->traits_built_ = true;
+  return this->traits_;
+}
+
+float ConfiguredTraits::clamp_temperature_(float temperature) const {
+  if (temperature < this->min_temperature_)
+    return this->min_temperature_;
+  if (temperature > this->max_temperature_)
+    return this->max_temperature_;
+  return temperature;
+}
+
+}  // namespace ir_common
+}  // namespace esphome
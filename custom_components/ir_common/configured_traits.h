@@ -0,0 +1,51 @@
+#pragma once
+
+#include "esphome/components/climate/climate.h"
+#include <cstdint>
+
+namespace esphome {
+namespace ir_common {
+
+// ======================================================================
+// ===                  CONFIGURED, CACHED TRAITS                     ===
+// ======================================================================
+// ESPHome asks for traits() on every call validation and publish. Platforms
+// mixing this in get their supported modes, fan modes, swing modes and
+// temperature range from YAML (see traits_schema() in __init__.py, whose
+// defaults are what the protocol can send), build the ClimateTraits once and
+// return the cached copy from then on.
+//
+// The masks have one bit per enum value: bit climate::CLIMATE_MODE_COOL is COOL.
+
+class ConfiguredTraits {
+ public:
+  void set_supported_modes(uint32_t mask) { this->modes_ = mask; }
+  void set_supported_fan_modes(uint32_t mask) { this->fan_modes_ = mask; }
+  void set_supported_swing_modes(uint32_t mask) { this->swing_modes_ = mask; }
+  void set_temperature_range(float min_temperature, float max_temperature, float step) {
+    this->min_temperature_ = min_temperature;
+    this->max_temperature_ = max_temperature;
+    this->temperature_step_ = step;
+  }
+
+ protected:
+  /// Built on the first call and kept until invalidate_traits_().
+  const climate::ClimateTraits &cached_traits_(bool supports_current_temperature);
+  void invalidate_traits_() { this->traits_built_ = false; }
+  /// For traits that also depend on runtime data (raw_ac's learned codes).
+  virtual void extend_traits_(climate::ClimateTraits &traits) {}
+
+  float clamp_temperature_(float temperature) const;
+
+  uint32_t modes_{0};
+  uint32_t fan_modes_{0};
+  uint32_t swing_modes_{0};
+  float min_temperature_{16.0f};
+  float max_temperature_{30.0f};
+  float temperature_step_{1.0f};
+  bool traits_built_{false};
+  climate::ClimateTraits traits_;
+};
+
+}  // namespace ir_common
+}  // namespace esphome
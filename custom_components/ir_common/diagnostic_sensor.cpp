@@ -0,0 +1,65 @@
+#include "diagnostic_sensor.h"
+#ifdef USE_SENSOR
+#include "alloc_stats.h"
+#include "loop_budget.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace ir_common {
+
+static const char *const TAG = "ir_common.diagnostic_sensor";
+
+void DiagnosticSensor::set_loop_budget(uint32_t budget_us) { ir_common::set_loop_budget(budget_us); }
+
+// setup() runs on the loop task, where every guarded path runs
+void DiagnosticSensor::setup() { alloc_track_current_task(); }
+
+void DiagnosticSensor::update() {
+  AllocStats stats = alloc_stats();
+  if (this->allocations_sensor_ != nullptr)
+    this->allocations_sensor_->publish_state(stats.count);
+  if (this->allocated_bytes_sensor_ != nullptr)
+    this->allocated_bytes_sensor_->publish_state(stats.bytes);
+  if (this->violations_sensor_ != nullptr)
+    this->violations_sensor_->publish_state(alloc_violations());
+  if (this->loop_worst_sensor_ != nullptr)
+    this->loop_worst_sensor_->publish_state(loop_worst_us() / 1000.0f);
+  if (this->loop_overruns_sensor_ != nullptr)
+    this->loop_overruns_sensor_->publish_state(loop_overruns());
+  for (const SiteSensors &sensors : this->site_sensors_) {
+    // A site that has not run yet has not been slow either
+    const BudgetSite *site = find_budget_site(sensors.site);
+    if (sensors.worst != nullptr)
+      sensors.worst->publish_state(site != nullptr ? site->worst_us / 1000.0f : 0.0f);
+    if (sensors.overruns != nullptr)
+      sensors.overruns->publish_state(site != nullptr ? site->overruns : 0);
+  }
+
+  // Name the culprits once per batch of new overruns
+  if (loop_overruns() == this->logged_overruns_)
+    return;
+  this->logged_overruns_ = loop_overruns();
+  for (const BudgetSite *site = budget_sites(); site != nullptr; site = site->next) {
+    ESP_LOGD(TAG, "  %-36s worst %6.1f ms  over budget %u/%u", site->name, site->worst_us / 1000.0f,
+             (unsigned) site->overruns, (unsigned) site->passes);
+  }
+}
+
+void DiagnosticSensor::dump_config() {
+  ESP_LOGCONFIG(TAG, "IR Allocation Tracking: %s", alloc_tracking_enabled() ? "enabled" : "NOT LINKED");
+  ESP_LOGCONFIG(TAG, "  Loop Budget: %.1f ms", loop_budget() / 1000.0f);
+  LOG_SENSOR("  ", "Allocations", this->allocations_sensor_);
+  LOG_SENSOR("  ", "Allocated Bytes", this->allocated_bytes_sensor_);
+  LOG_SENSOR("  ", "Steady-State Violations", this->violations_sensor_);
+  LOG_SENSOR("  ", "Loop Worst Time", this->loop_worst_sensor_);
+  LOG_SENSOR("  ", "Loop Overruns", this->loop_overruns_sensor_);
+  for (const SiteSensors &sensors : this->site_sensors_) {
+    ESP_LOGCONFIG(TAG, "  Site %s:", sensors.site);
+    LOG_SENSOR("    ", "Worst Time", sensors.worst);
+    LOG_SENSOR("    ", "Overruns", sensors.overruns);
+  }
+}
+
+}  // namespace ir_common
+}  // namespace esphome
+#endif
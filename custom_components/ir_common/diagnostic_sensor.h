@@ -0,0 +1,51 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+#ifdef USE_SENSOR
+#include "esphome/core/component.h"
+#include "esphome/components/sensor/sensor.h"
+#include <vector>
+
+namespace esphome {
+namespace ir_common {
+
+// Diagnostic sensors for alloc_stats and loop_budget: allocations since
+// boot, guarded hot paths that allocated in steady state, and the slowest
+// and over-budget passes through the same paths, in total and per site.
+class DiagnosticSensor : public PollingComponent {
+ public:
+  void set_allocations_sensor(sensor::Sensor *sensor) { this->allocations_sensor_ = sensor; }
+  void set_allocated_bytes_sensor(sensor::Sensor *sensor) { this->allocated_bytes_sensor_ = sensor; }
+  void set_violations_sensor(sensor::Sensor *sensor) { this->violations_sensor_ = sensor; }
+  void set_loop_worst_sensor(sensor::Sensor *sensor) { this->loop_worst_sensor_ = sensor; }
+  void set_loop_overruns_sensor(sensor::Sensor *sensor) { this->loop_overruns_sensor_ = sensor; }
+  void set_loop_budget(uint32_t budget_us);
+  /// Worst pass (ms) and overrun count of one budget site, e.g. "raw_ac.on_receive".
+  /// Either sensor may be null.
+  void add_site_sensors(const char *site, sensor::Sensor *worst, sensor::Sensor *overruns) {
+    this->site_sensors_.push_back({site, worst, overruns});
+  }
+
+  void setup() override;
+  void update() override;
+  void dump_config() override;
+
+ protected:
+  sensor::Sensor *allocations_sensor_{nullptr};
+  sensor::Sensor *allocated_bytes_sensor_{nullptr};
+  sensor::Sensor *violations_sensor_{nullptr};
+  sensor::Sensor *loop_worst_sensor_{nullptr};
+  sensor::Sensor *loop_overruns_sensor_{nullptr};
+  uint32_t logged_overruns_{0};
+
+  struct SiteSensors {
+    const char *site;
+    sensor::Sensor *worst;
+    sensor::Sensor *overruns;
+  };
+  std::vector<SiteSensors> site_sensors_;  // filled once from YAML
+};
+
+}  // namespace ir_common
+}  // namespace esphome
+#endif
@@ -0,0 +1,148 @@
+#include "frame_matcher.h"
+#include <algorithm>
+#include <cstdlib>
+
+namespace esphome {
+namespace ir_common {
+
+static void level_ranks(const uint16_t *levels, uint8_t *ranks) {
+  for (uint8_t j = 0; j < LEARN_LEVELS; j++) {
+    ranks[j] = 0;
+    for (uint8_t k = 0; k < LEARN_LEVELS; k++) {
+      if (levels[k] != 0 && levels[k] < levels[j])
+        ranks[j]++;
+    }
+  }
+}
+
+uint32_t frame_signature(const QuantisedFrame &frame) {
+  uint8_t ranks[2][LEARN_LEVELS];
+  level_ranks(frame.mark_levels, ranks[0]);
+  level_ranks(frame.space_levels, ranks[1]);
+
+  // FNV-1a
+  uint32_t h = 2166136261u;
+  h = (h ^ (frame.length & 0xFF)) * 16777619u;
+  h = (h ^ (frame.length >> 8)) * 16777619u;
+  for (size_t i = 0; i < frame.length; i++) {
+    uint8_t level = (frame.symbols[i / 4] >> ((i % 4) * 2)) & 0x03;
+    h = (h ^ ranks[i & 1][level]) * 16777619u;
+  }
+  return h;
+}
+
+void FrameMatcher::add_codebook(const Codebook *book) {
+  if (!book->is_valid() || book->format() != CODEBOOK_FORMAT_RAW16)
+    return;
+  std::vector<int32_t> timings;
+  timings.reserve(book->max_length());
+  for (uint16_t i = 0; i < book->size(); i++) {
+    Entry entry{};
+    if (!book->get(i, &entry.record))
+      continue;
+    entry.key = entry.record.key;
+    entry.length = entry.record.length;
+    timings.resize(entry.length);
+    for (size_t j = 0; j < entry.length; j++)
+      timings[j] = Codebook::read_timing(entry.record, j);
+    QuantisedFrame frame;
+    // Frames that do not quantise keep signature 0 and are only reachable by the fallback
+    if (quantise_frame(timings.data(), timings.size(), &frame))
+      entry.signature = frame_signature(frame);
+    this->entries_.push_back(entry);
+  }
+  this->sort_();
+}
+
+void FrameMatcher::add_learned(const LearnedCodebook *learned) {
+  for (size_t i = 0; i < learned->key_count(); i++) {
+    Entry entry{};
+    entry.key = learned->key_at(i);
+    entry.frame = &learned->frame_at(i);
+    entry.length = entry.frame->length;
+    entry.signature = frame_signature(*entry.frame);
+    this->entries_.push_back(entry);
+  }
+  this->sort_();
+}
+
+void FrameMatcher::sort_() {
+  std::stable_sort(this->entries_.begin(), this->entries_.end(),
+                   [](const Entry &a, const Entry &b) { return a.signature < b.signature; });
+}
+
+int32_t FrameMatcher::timing_(const Entry &entry, size_t i) const {
+  return entry.frame != nullptr ? entry.frame->timing(i) : Codebook::read_timing(entry.record, i);
+}
+
+uint32_t FrameMatcher::distance_(const Entry &entry, const int32_t *timings, size_t len, uint32_t limit) const {
+  size_t common = std::min<size_t>(len, entry.length);
+  size_t extra = std::max<size_t>(len, entry.length) - common;
+  uint32_t sum = extra * MATCH_LENGTH_PENALTY;
+  if (sum >= limit)
+    return UINT32_MAX;
+  for (size_t i = 0; i < common; i++) {
+    sum += std::abs(std::abs(timings[i]) - std::abs(this->timing_(entry, i)));
+    // Checked every 8 timings: cheap enough and still exits within a few µs
+    if ((i & 7) == 7 && sum >= limit)
+      return UINT32_MAX;
+  }
+  return sum >= limit ? UINT32_MAX : sum;
+}
+
+size_t FrameMatcher::collect_(uint32_t signature, const int32_t *timings, size_t len, uint32_t *keys,
+                              size_t max_keys) const {
+  auto it = std::lower_bound(this->entries_.begin(), this->entries_.end(), signature,
+                             [](const Entry &e, uint32_t sig) { return e.signature < sig; });
+  const uint32_t limit = len * MATCH_MAX_AVERAGE_ERROR;
+  size_t n = 0;
+  for (; it != this->entries_.end() && it->signature == signature && n < max_keys; ++it) {
+    // Same symbol shape is not the same remote (or may be a hash collision): check the timings
+    if (this->distance_(*it, timings, len, limit) == UINT32_MAX)
+      continue;
+    // A key can be both learned and built in; report it once
+    if (std::find(keys, keys + n, it->key) == keys + n)
+      keys[n++] = it->key;
+  }
+  return n;
+}
+
+size_t FrameMatcher::match(const int32_t *timings, size_t len, uint32_t *keys, size_t max_keys) const {
+  if (len == 0 || max_keys == 0 || this->entries_.empty())
+    return 0;
+
+  // 1. Exact path
+  QuantisedFrame frame;
+  if (quantise_frame(timings, len, &frame)) {
+    size_t n = this->collect_(frame_signature(frame), timings, len, keys, max_keys);
+    if (n != 0)
+      return n;
+  }
+
+  // 2. Early-exit nearest neighbour
+  const Entry *best = nullptr;
+  uint32_t best_distance = len * MATCH_MAX_AVERAGE_ERROR;
+  for (const auto &entry : this->entries_) {
+    uint32_t d = this->distance_(entry, timings, len, best_distance);
+    if (d < best_distance) {
+      best = &entry;
+      best_distance = d;
+    }
+  }
+  if (best == nullptr)
+    return 0;
+  keys[0] = best->key;
+  if (best->signature == 0)
+    return 1;
+  // Include the keys that share the winning frame
+  size_t n = this->collect_(best->signature, timings, len, keys + 1, max_keys - 1);
+  size_t out = 1;
+  for (size_t i = 0; i < n; i++) {
+    if (keys[1 + i] != keys[0])
+      keys[out++] = keys[1 + i];
+  }
+  return out;
+}
+
+}  // namespace ir_common
+}  // namespace esphome
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "codebook.h"
+#include "learned_codebook.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace esphome {
+namespace ir_common {
+
+// ======================================================================
+// ===                    RAW CAPTURE -> STATE MATCHER                ===
+// ======================================================================
+// Maps a received raw capture back to the codebook key that would have
+// produced it, so replay-only platforms get state feedback.
+//
+// 1. Exact path: the capture is quantised (quantise_frame) and its levels
+//    are ranked by duration, so "short space" is symbol 0 whatever the
+//    actual µs. A hash of the ranked symbols is looked up by binary search,
+//    and each hit is confirmed with the fallback's distance and limit.
+// 2. Fallback: nearest neighbour on the raw timings, summing the absolute
+//    per-timing error with an early exit once the running sum exceeds the
+//    best candidate so far (or reaches the acceptance limit).
+//
+// Several keys can share one frame (a remote that does not encode fan
+// speed, or identical captures), so a match returns all of them.
+
+static const uint32_t MATCH_MAX_AVERAGE_ERROR = 150;  // µs per timing for the fallback
+static const uint32_t MATCH_LENGTH_PENALTY = 1000;    // µs per missing/extra timing
+
+/// Jitter-independent hash of a quantised frame: length plus duration-ranked symbols.
+uint32_t frame_signature(const QuantisedFrame &frame);
+
+class FrameMatcher {
+ public:
+  /// Indexes every record of a RAW16 codebook. Other formats are ignored.
+  void add_codebook(const Codebook *book);
+  /// Indexes learned frames. Add these first: on equal frames they win.
+  void add_learned(const LearnedCodebook *learned);
+  void clear() { this->entries_.clear(); }
+  size_t size() const { return this->entries_.size(); }
+
+  /// Writes up to max_keys candidate keys, best first. Returns how many.
+  size_t match(const int32_t *timings, size_t len, uint32_t *keys, size_t max_keys) const;
+
+ protected:
+  struct Entry {
+    uint32_t signature;
+    uint32_t key;
+    uint16_t length;
+    const QuantisedFrame *frame;  // learned frame, or nullptr for a codebook record
+    CodebookRecord record;
+  };
+
+  void sort_();
+  int32_t timing_(const Entry &entry, size_t i) const;
+  /// Early-exit distance; returns UINT32_MAX once it reaches limit.
+  uint32_t distance_(const Entry &entry, const int32_t *timings, size_t len, uint32_t limit) const;
+  /// Keys with `signature` whose frame is within the fallback limit of `timings`.
+  size_t collect_(uint32_t signature, const int32_t *timings, size_t len, uint32_t *keys, size_t max_keys) const;
+
+  std::vector<Entry> entries_;  // sorted by signature, insertion order kept within one
+};
+
+}  // namespace ir_common
+}  // namespace esphome
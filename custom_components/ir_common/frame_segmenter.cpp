@@ -0,0 +1,66 @@
+#include "frame_segmenter.h"
+#include <cstdlib>
+#include <cstring>
+
+namespace esphome {
+namespace ir_common {
+
+size_t segment_frames(const int32_t *timings, size_t len, uint32_t gap_us, size_t min_timings, FrameSpan *spans,
+                      size_t max_spans) {
+  size_t n = 0;
+  size_t start = 0;
+  // A capture may begin with a space left over from the idle line
+  while (start < len && timings[start] <= 0)
+    start++;
+
+  for (size_t i = start; i <= len && n < max_spans; i++) {
+    bool gap = i == len || (timings[i] < 0 && uint32_t(-timings[i]) >= gap_us);
+    if (!gap)
+      continue;
+    if (i - start >= min_timings) {
+      spans[n].start = start;
+      spans[n].length = i - start;
+      n++;
+    }
+    start = i + 1;
+  }
+  return n;
+}
+
+bool MajorityVote::add(const uint8_t *frame, size_t length) {
+  if (length != this->length_ || this->count_ == VOTE_MAX_FRAMES)
+    return false;
+  memcpy(this->frames_[this->count_++], frame, length);
+  return true;
+}
+
+bool MajorityVote::result(uint8_t *out) const {
+  if (this->count_ == 0)
+    return false;
+  bool decided = true;
+  for (size_t byte = 0; byte < this->length_; byte++) {
+    uint8_t value = 0;
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      uint8_t mask = 1 << bit;
+      size_t ones = 0;
+      for (size_t f = 0; f < this->count_; f++)
+        ones += (this->frames_[f][byte] & mask) != 0;
+      if (ones * 2 > this->count_)
+        value |= mask;
+      else if (ones * 2 == this->count_)
+        decided = false;
+    }
+    out[byte] = value;
+  }
+  return decided;
+}
+
+size_t MajorityVote::agreement(const uint8_t *decided) const {
+  size_t n = 0;
+  for (size_t f = 0; f < this->count_; f++)
+    n += memcmp(this->frames_[f], decided, this->length_) == 0;
+  return n;
+}
+
+}  // namespace ir_common
+}  // namespace esphome
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace ir_common {
+
+// ======================================================================
+// ===                 MULTI-FRAME SEGMENTATION AND VOTING            ===
+// ======================================================================
+// Most A/C remotes repeat the frame (or send several parts) inside one
+// capture. segment_frames() splits a capture on long spaces in one pass;
+// each span starts at a mark and ends at the mark before the gap, so a
+// protocol decoder sees exactly one frame. MajorityVote then combines the
+// decoded repeats bit by bit, so one corrupted repeat does not lose the
+// capture.
+
+struct FrameSpan {
+  uint16_t start;   // index of the first mark (usually the header mark)
+  uint16_t length;  // timings, excluding the gap space
+};
+
+/// Splits on spaces of at least gap_us. Spans shorter than min_timings
+/// (noise, stray marks) are dropped. Returns the number of spans written.
+size_t segment_frames(const int32_t *timings, size_t len, uint32_t gap_us, size_t min_timings, FrameSpan *spans,
+                      size_t max_spans);
+
+static const size_t VOTE_MAX_FRAMES = 4;
+static const size_t VOTE_MAX_BYTES = 16;
+
+class MajorityVote {
+ public:
+  /// Only frames of exactly `length` bytes take part.
+  explicit MajorityVote(size_t length) : length_(length < VOTE_MAX_BYTES ? length : VOTE_MAX_BYTES) {}
+
+  /// Returns false if the frame has the wrong length or the vote is full.
+  bool add(const uint8_t *frame, size_t length);
+  size_t count() const { return this->count_; }
+  size_t length() const { return this->length_; }
+  const uint8_t *frame(size_t i) const { return this->frames_[i]; }
+
+  /// Bitwise majority into out. False if there are no frames or any bit is
+  /// tied (two disagreeing repeats); out then holds the bits that were decided.
+  bool result(uint8_t *out) const;
+  /// Frames identical to `decided`: 1 of 1, 2 of 3, ...
+  size_t agreement(const uint8_t *decided) const;
+
+ protected:
+  uint8_t frames_[VOTE_MAX_FRAMES][VOTE_MAX_BYTES];
+  size_t length_;
+  size_t count_{0};
+};
+
+}  // namespace ir_common
+}  // namespace esphome
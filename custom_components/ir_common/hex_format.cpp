@@ -0,0 +1,24 @@
+#include "hex_format.h"
+
+namespace esphome {
+namespace ir_common {
+
+const char *format_hex_to(char *buffer, size_t size, const uint8_t *data, size_t length) {
+  static const char DIGITS[] = "0123456789ABCDEF";
+  size_t pos = 0;
+  for (size_t i = 0; i < length; i++) {
+    size_t need = i != 0 ? 3 : 2;
+    if (pos + need >= size)
+      break;
+    if (i != 0)
+      buffer[pos++] = ' ';
+    buffer[pos++] = DIGITS[data[i] >> 4];
+    buffer[pos++] = DIGITS[data[i] & 0x0F];
+  }
+  if (size != 0)
+    buffer[pos] = '\0';
+  return buffer;
+}
+
+}  // namespace ir_common
+}  // namespace esphome
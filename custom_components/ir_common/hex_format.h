@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace ir_common {
+
+/// "F2 0D 03" into the caller's buffer; format_hex_pretty() returns a std::string.
+/// Truncated to whole bytes if the buffer is short.
+const char *format_hex_to(char *buffer, size_t size, const uint8_t *data, size_t length);
+/// Buffer size format_hex_to() needs for `length` bytes.
+constexpr size_t hex_buffer_size(size_t length) { return length * 3 + 1; }
+
+}  // namespace ir_common
+}  // namespace esphome
@@ -0,0 +1,182 @@
+#include "learned_codebook.h"
+#include "esphome/core/log.h"
+#include <cstdlib>
+#include <cstring>
+
+namespace esphome {
+namespace ir_common {
+
+static const char *const TAG = "ir_common.learn";
+
+static bool within_tolerance(uint32_t a, uint32_t b) {
+  uint32_t diff = a > b ? a - b : b - a;
+  return diff * 100 <= b * LEARN_TOLERANCE_PERCENT;
+}
+
+bool QuantisedFrame::same_as(const QuantisedFrame &other) const {
+  if (this->length != other.length)
+    return false;
+  if (memcmp(this->symbols, other.symbols, (this->length + 3) / 4) != 0)
+    return false;
+  for (uint8_t j = 0; j < LEARN_LEVELS; j++) {
+    if ((this->mark_levels[j] == 0) != (other.mark_levels[j] == 0) ||
+        (this->space_levels[j] == 0) != (other.space_levels[j] == 0))
+      return false;
+    if (this->mark_levels[j] != 0 && !within_tolerance(this->mark_levels[j], other.mark_levels[j]))
+      return false;
+    if (this->space_levels[j] != 0 && !within_tolerance(this->space_levels[j], other.space_levels[j]))
+      return false;
+  }
+  return true;
+}
+
+bool quantise_frame(const int32_t *timings, size_t len, QuantisedFrame *out) {
+  if (len == 0 || len > LEARN_MAX_TIMINGS)
+    return false;
+
+  // [0] = marks, [1] = spaces. Levels are running means, numbered in order
+  // of first appearance so identical captures get identical symbols.
+  uint32_t sums[2][LEARN_LEVELS] = {};
+  uint16_t counts[2][LEARN_LEVELS] = {};
+  uint8_t used[2] = {0, 0};
+
+  memset(out, 0, sizeof(QuantisedFrame));
+  for (size_t i = 0; i < len; i++) {
+    uint8_t kind = i & 1;
+    uint32_t duration = std::abs(timings[i]);
+    // Nearest level within tolerance, so a long header cannot swallow a bit level
+    uint8_t level = used[kind];
+    uint32_t best = UINT32_MAX;
+    for (uint8_t j = 0; j < used[kind]; j++) {
+      uint32_t mean = sums[kind][j] / counts[kind][j];
+      uint32_t diff = duration > mean ? duration - mean : mean - duration;
+      if (diff < best && within_tolerance(duration, mean)) {
+        best = diff;
+        level = j;
+      }
+    }
+    if (level == used[kind]) {
+      if (used[kind] == LEARN_LEVELS)
+        return false;
+      used[kind]++;
+    }
+    sums[kind][level] += duration;
+    counts[kind][level]++;
+    out->symbols[i / 4] |= level << ((i % 4) * 2);
+  }
+
+  for (uint8_t j = 0; j < LEARN_LEVELS; j++) {
+    if (counts[0][j] != 0)
+      out->mark_levels[j] = sums[0][j] / counts[0][j];
+    if (counts[1][j] != 0)
+      out->space_levels[j] = sums[1][j] / counts[1][j];
+  }
+  out->length = len;
+  return true;
+}
+
+void LearnedCodebook::setup(uint32_t hash_base, uint8_t frame_slots) {
+  this->index_pref_ = global_preferences->make_preference<Index>(hash_base, true);
+  if (!this->index_pref_.load(&this->index_) || this->index_.count > LEARN_MAX_KEYS)
+    this->index_ = Index{};
+
+  this->frames_.assign(frame_slots, QuantisedFrame{});
+  this->frame_prefs_.reserve(frame_slots);
+  for (uint8_t i = 0; i < frame_slots; i++) {
+    this->frame_prefs_.push_back(global_preferences->make_preference<QuantisedFrame>(hash_base + 1 + i, true));
+    if (!this->frame_prefs_[i].load(&this->frames_[i]) || this->frames_[i].length > LEARN_MAX_TIMINGS)
+      this->frames_[i] = QuantisedFrame{};
+  }
+
+  // Drop index entries whose frame is gone (slot count reduced in YAML, lost flash).
+  uint8_t kept = 0;
+  for (uint8_t i = 0; i < this->index_.count; i++) {
+    uint8_t slot = this->index_.frame_of[i];
+    if (slot < frame_slots && this->frames_[slot].length != 0) {
+      this->index_.keys[kept] = this->index_.keys[i];
+      this->index_.frame_of[kept] = slot;
+      kept++;
+    }
+  }
+  this->index_.count = kept;
+  ESP_LOGD(TAG, "Loaded %u learned codes in %u frames", kept, (unsigned) this->frame_count());
+}
+
+int LearnedCodebook::find_key_(uint32_t key) const {
+  for (uint8_t i = 0; i < this->index_.count; i++) {
+    if (this->index_.keys[i] == key)
+      return i;
+  }
+  return -1;
+}
+
+bool LearnedCodebook::slot_referenced_(size_t slot, int ignore_entry) const {
+  for (uint8_t i = 0; i < this->index_.count; i++) {
+    if (int(i) != ignore_entry && this->index_.frame_of[i] == slot)
+      return true;
+  }
+  return false;
+}
+
+const QuantisedFrame *LearnedCodebook::find(uint32_t key) const {
+  int entry = this->find_key_(key);
+  if (entry < 0)
+    return nullptr;
+  return &this->frames_[this->index_.frame_of[entry]];
+}
+
+size_t LearnedCodebook::frame_count() const {
+  size_t n = 0;
+  for (size_t slot = 0; slot < this->frames_.size(); slot++) {
+    if (this->slot_referenced_(slot, -1))
+      n++;
+  }
+  return n;
+}
+
+LearnedCodebook::StoreResult LearnedCodebook::store(uint32_t key, const QuantisedFrame &frame) {
+  int entry = this->find_key_(key);
+  if (entry < 0 && this->index_.count == LEARN_MAX_KEYS)
+    return FULL;
+
+  // Reuse an identical frame if another state already sends it.
+  int slot = -1;
+  StoreResult result = STORED;
+  for (size_t i = 0; i < this->frames_.size(); i++) {
+    if (this->slot_referenced_(i, entry) && this->frames_[i].same_as(frame)) {
+      slot = i;
+      result = DEDUPLICATED;
+      break;
+    }
+  }
+  // Otherwise take a slot nobody else points at (this key's old slot included).
+  if (slot < 0) {
+    for (size_t i = 0; i < this->frames_.size(); i++) {
+      if (!this->slot_referenced_(i, entry)) {
+        slot = i;
+        break;
+      }
+    }
+    if (slot < 0)
+      return FULL;
+    this->frames_[slot] = frame;
+    this->frame_prefs_[slot].save(&this->frames_[slot]);
+  }
+
+  if (entry < 0)
+    entry = this->index_.count++;
+  this->index_.keys[entry] = key;
+  this->index_.frame_of[entry] = slot;
+  this->index_pref_.save(&this->index_);
+  global_preferences->sync();
+  return result;
+}
+
+void LearnedCodebook::clear() {
+  this->index_ = Index{};
+  this->index_pref_.save(&this->index_);
+  global_preferences->sync();
+}
+
+}  // namespace ir_common
+}  // namespace esphome
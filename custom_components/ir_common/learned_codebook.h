@@ -0,0 +1,84 @@
+#pragma once
+
+#include "esphome/core/preferences.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace esphome {
+namespace ir_common {
+
+// ======================================================================
+// ===                 LEARNED (FLASH-BACKED) CODEBOOK                ===
+// ======================================================================
+// Captures from the physical remote are quantised before storage: marks and
+// spaces are clustered separately into at most four duration levels each,
+// and every timing is stored as a 2-bit level index. A 227-entry capture
+// (908 bytes as int32) becomes an 84-byte QuantisedFrame.
+//
+// Frames live in their own preference slots; a small index maps state keys
+// (codebook_key) to frame slots, so states that send the identical frame
+// share one slot.
+
+static const size_t LEARN_MAX_TIMINGS = 256;
+static const size_t LEARN_MAX_KEYS = 16;
+static const uint8_t LEARN_LEVELS = 4;
+static const uint8_t LEARN_TOLERANCE_PERCENT = 20;
+
+struct QuantisedFrame {
+  uint16_t mark_levels[LEARN_LEVELS];   // µs, 0 = unused
+  uint16_t space_levels[LEARN_LEVELS];  // µs, 0 = unused
+  uint16_t length;                      // timings, marks at even indices
+  uint16_t reserved;
+  uint8_t symbols[LEARN_MAX_TIMINGS / 4];  // 2-bit level index per timing
+
+  /// Signed µs timing i (mark > 0, space < 0), as RemoteTransmitData expects.
+  int32_t timing(size_t i) const {
+    uint8_t level = (this->symbols[i / 4] >> ((i % 4) * 2)) & 0x03;
+    return (i & 1) ? -int32_t(this->space_levels[level]) : int32_t(this->mark_levels[level]);
+  }
+  /// Same symbol sequence and every level within tolerance: the same code.
+  bool same_as(const QuantisedFrame &other) const;
+};
+
+/// Single pass, O(n * LEARN_LEVELS). Fails if the capture is too long or has
+/// more than LEARN_LEVELS distinct mark or space durations.
+bool quantise_frame(const int32_t *timings, size_t len, QuantisedFrame *out);
+
+class LearnedCodebook {
+ public:
+  enum StoreResult : uint8_t { STORED, DEDUPLICATED, FULL };
+
+  /// Loads the index and frames from flash. hash_base must be unique per entity.
+  void setup(uint32_t hash_base, uint8_t frame_slots);
+
+  const QuantisedFrame *find(uint32_t key) const;
+  StoreResult store(uint32_t key, const QuantisedFrame &frame);
+  void clear();
+
+  size_t key_count() const { return this->index_.count; }
+  size_t frame_count() const;
+  size_t frame_slots() const { return this->frames_.size(); }
+  /// Iteration over learned entries (key + frame) for the receive matcher.
+  uint32_t key_at(size_t i) const { return this->index_.keys[i]; }
+  const QuantisedFrame &frame_at(size_t i) const { return this->frames_[this->index_.frame_of[i]]; }
+
+ protected:
+  struct Index {
+    uint32_t keys[LEARN_MAX_KEYS];
+    uint8_t frame_of[LEARN_MAX_KEYS];
+    uint8_t count;
+    uint8_t reserved[3];
+  };
+
+  int find_key_(uint32_t key) const;
+  bool slot_referenced_(size_t slot, int ignore_entry) const;
+
+  Index index_{};
+  std::vector<QuantisedFrame> frames_;
+  ESPPreferenceObject index_pref_;
+  std::vector<ESPPreferenceObject> frame_prefs_;
+};
+
+}  // namespace ir_common
+}  // namespace esphome
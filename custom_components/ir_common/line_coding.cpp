@@ -0,0 +1,192 @@
+#include "line_coding.h"
+#include <cstdlib>
+#include <cstring>
+
+namespace esphome {
+namespace ir_common {
+
+static uint8_t reverse_bits(uint8_t b) {
+  b = (b & 0xF0) >> 4 | (b & 0x0F) << 4;
+  b = (b & 0xCC) >> 2 | (b & 0x33) << 2;
+  b = (b & 0xAA) >> 1 | (b & 0x55) << 1;
+  return b;
+}
+
+// Half-bit units: every timing is one or two units long. A half pair must
+// change level; confidence is the weaker of the timings the pair came from.
+static size_t decode_manchester(const LineCoding &c, const int32_t *t, size_t len, size_t first, size_t max_bits,
+                                SoftBits *out) {
+  const uint32_t unit = c.fixed_us;
+  const uint32_t half = unit / 2;
+  bool pending = false;  // first half of the current bit seen
+  bool pending_mark = false;
+  uint8_t pending_conf = 0;
+  size_t bit = 0;
+
+  auto push_half = [&](bool mark, uint8_t conf) -> bool {
+    if (!pending) {
+      pending = true;
+      pending_mark = mark;
+      pending_conf = conf;
+      return true;
+    }
+    pending = false;
+    if (pending_mark == mark)
+      return false;  // no mid-bit transition: not Manchester
+    bool one = c.inverted ? pending_mark : !pending_mark;
+    if (one)
+      out->bytes[bit / 8] |= 0x80 >> (bit % 8);
+    out->confidence[bit] = conf < pending_conf ? conf : pending_conf;
+    bit++;
+    return true;
+  };
+
+  // A header space can absorb the leading space half of the first bit
+  if (c.header_mark_us != 0 && first >= 2) {
+    uint32_t header = std::abs(t[first - 1]);
+    if (header > c.header_space_us + half)
+      push_half(false, 255);
+  }
+
+  for (size_t i = first; i < len && bit < max_bits; i++) {
+    uint32_t d = std::abs(t[i]);
+    uint32_t units = (d + half) / unit;
+    bool footer = false;
+    if (units > 2 && t[i] > 0 && c.footer_mark_us != 0 && d > c.footer_mark_us) {
+      // A trailing mark half runs on into the footer mark
+      d -= c.footer_mark_us;
+      units = (d + half) / unit;
+      footer = true;
+    }
+    if (units < 1 || units > 2)
+      break;
+    uint32_t err = d > units * unit ? d - units * unit : units * unit - d;
+    uint8_t conf = err >= half ? 0 : 255 - err * 255 / half;
+    for (uint32_t u = 0; u < units && bit < max_bits; u++) {
+      if (!push_half(t[i] > 0, conf))
+        return bit;
+    }
+    if (footer)
+      break;
+  }
+  // A trailing space half merges into the idle line
+  if (pending && pending_mark && bit < max_bits)
+    push_half(false, 255);
+  return bit;
+}
+
+size_t decode_line(const LineCoding &coding, const int32_t *timings, size_t len, size_t max_bits, SoftBits *out) {
+  size_t first = coding.header_mark_us != 0 ? 2 : 0;
+
+  // Pulse distance and width are the same pairwise decision, on the space or the mark
+  size_t bits;
+  switch (coding.kind) {
+    case LINE_PULSE_DISTANCE:
+      bits = decode_soft_bits(timings, len, first + 1, max_bits, coding.zero_us, coding.one_us, out);
+      break;
+    case LINE_PULSE_WIDTH:
+      bits = decode_soft_bits(timings, len, first, max_bits, coding.zero_us, coding.one_us, out);
+      break;
+    case LINE_MANCHESTER:
+      memset(out, 0, sizeof(SoftBits));
+      bits = decode_manchester(coding, timings, len, first, max_bits < SOFT_MAX_BITS ? max_bits : SOFT_MAX_BITS, out);
+      out->bits = bits;
+      break;
+    default:
+      memset(out, 0, sizeof(SoftBits));
+      bits = 0;
+  }
+
+  if (coding.lsb_first) {
+    for (size_t i = 0; i < (bits + 7) / 8; i++) {
+      out->bytes[i] = reverse_bits(out->bytes[i]);
+      // Keep confidence aligned with the stored bit positions
+      for (size_t j = 0; j < 4 && i * 8 + 7 - j < SOFT_MAX_BITS; j++) {
+        uint8_t tmp = out->confidence[i * 8 + j];
+        out->confidence[i * 8 + j] = out->confidence[i * 8 + 7 - j];
+        out->confidence[i * 8 + 7 - j] = tmp;
+      }
+    }
+  }
+  return bits;
+}
+
+#ifndef IR_COMMON_HOST_TOOL
+// Half-bit units of equal level merge into one 2-unit timing, and a
+// trailing mark half into the footer mark
+static void encode_manchester(const LineCoding &c, const uint8_t *bytes, size_t bits,
+                              remote_base::RemoteTransmitData *dst) {
+  bool level = false;  // after the header space, or the idle line
+  uint32_t run = c.header_mark_us != 0 ? c.header_space_us : 0;
+  auto half = [&](bool mark) {
+    if (mark != level && run != 0) {
+      if (level)
+        dst->mark(run);
+      else
+        dst->space(run);
+      run = 0;
+    }
+    level = mark;
+    run += c.fixed_us;
+  };
+
+  if (c.header_mark_us != 0)
+    dst->mark(c.header_mark_us);
+  for (size_t bit = 0; bit < bits; bit++) {
+    uint8_t mask = c.lsb_first ? 1 << (bit % 8) : 0x80 >> (bit % 8);
+    bool mark_first = ((bytes[bit / 8] & mask) != 0) == c.inverted;
+    half(mark_first);
+    half(!mark_first);
+  }
+  // A trailing space is the idle line; only a mark is sent
+  if (level) {
+    dst->mark(run + c.footer_mark_us);
+  } else if (c.footer_mark_us != 0) {
+    dst->space(run);
+    dst->mark(c.footer_mark_us);
+  }
+}
+
+// Without a header, nothing before the first bit tells a leading space
+// half from the idle line
+static bool starts_with_space(const LineCoding &c, const uint8_t *bytes, size_t bits) {
+  if (c.kind != LINE_MANCHESTER || c.header_mark_us != 0 || bits == 0)
+    return false;
+  uint8_t mask = c.lsb_first ? 0x01 : 0x80;
+  return ((bytes[0] & mask) != 0) != c.inverted;
+}
+
+bool encode_line(const LineCoding &coding, const uint8_t *bytes, size_t bits, remote_base::RemoteTransmitData *dst) {
+  if (starts_with_space(coding, bytes, bits))
+    return false;
+  dst->reserve(dst->get_data().size() + line_timing_count(coding, bits));
+  if (coding.kind == LINE_MANCHESTER) {
+    encode_manchester(coding, bytes, bits, dst);
+    return true;
+  }
+  if (coding.header_mark_us != 0)
+    dst->item(coding.header_mark_us, coding.header_space_us);
+  for (size_t bit = 0; bit < bits; bit++) {
+    uint8_t mask = coding.lsb_first ? 1 << (bit % 8) : 0x80 >> (bit % 8);
+    uint32_t varying = (bytes[bit / 8] & mask) ? coding.one_us : coding.zero_us;
+    if (coding.kind == LINE_PULSE_DISTANCE)
+      dst->item(coding.fixed_us, varying);
+    else
+      dst->item(varying, coding.fixed_us);
+  }
+  if (coding.footer_mark_us != 0)
+    dst->mark(coding.footer_mark_us);
+  return true;
+}
+#endif
+
+size_t line_timing_count(const LineCoding &coding, size_t bits) {
+  size_t n = coding.header_mark_us != 0 ? 2 : 0;
+  n += bits * 2;
+  if (coding.footer_mark_us != 0)
+    n++;
+  return n;
+}
+
+}  // namespace ir_common
+}  // namespace esphome
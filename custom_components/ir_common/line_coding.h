@@ -0,0 +1,71 @@
+#pragma once
+
+#include "soft_bits.h"
+#ifndef IR_COMMON_HOST_TOOL
+#include "esphome/components/remote_base/remote_base.h"
+#endif
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace ir_common {
+
+// ======================================================================
+// ===                    TABLE-DRIVEN LINE CODING                    ===
+// ======================================================================
+// A protocol's bit coding is a const LineCoding table, so a new remote is
+// a table entry instead of another decode loop:
+//
+//   PULSE_DISTANCE  fixed mark, the space carries the bit   (NEC, Carrier, Mitsubishi)
+//   PULSE_WIDTH     fixed space, the mark carries the bit   (Sony SIRC style)
+//   MANCHESTER      every bit is two half-bit units; a mark-then-space
+//                   half pair is 0, space-then-mark is 1     (RC5, bi-phase)
+//
+// decode_line() makes one pass with the coding's own loop (the kind is
+// switched on once, not per timing) and produces SoftBits, so checksum
+// repair works for all three. Header timings are skipped, not validated:
+// the protocol decoder (or identify_protocol) judges those.
+//
+// The decoders have no ESPHome dependency. Host tools (tools/ir_convert.cpp)
+// build them with IR_COMMON_HOST_TOOL defined, which leaves out encode_line().
+
+enum LineCodingKind : uint8_t {
+  LINE_PULSE_DISTANCE,
+  LINE_PULSE_WIDTH,
+  LINE_MANCHESTER,
+};
+
+struct LineCoding {
+  LineCodingKind kind;
+  uint16_t header_mark_us;   // 0 = no header
+  uint16_t header_space_us;
+  uint16_t fixed_us;         // PULSE_DISTANCE: the mark, PULSE_WIDTH: the space, MANCHESTER: half-bit unit
+  uint16_t zero_us;          // varying timing for 0 (unused for MANCHESTER)
+  uint16_t one_us;           // varying timing for 1 (unused for MANCHESTER)
+  uint16_t footer_mark_us;   // 0 = none
+  bool lsb_first;            // store bytes in natural order for LSB-first protocols
+  bool inverted;             // MANCHESTER: mark-then-space is 1 instead
+};
+
+/// Decodes up to max_bits after the header. Returns the number of bits decoded;
+/// a Manchester stream stops at the first timing that is not 1 or 2 units.
+/// Without a header, a Manchester capture must start on a bit boundary: a
+/// leading space half is indistinguishable from the idle line.
+size_t decode_line(const LineCoding &coding, const int32_t *timings, size_t len, size_t max_bits, SoftBits *out);
+
+#ifndef IR_COMMON_HOST_TOOL
+/// Appends one frame, MSB first (or LSB first per coding), straight into the
+/// transmitter's own buffer: pass call.get_data(). RemoteTransmitter keeps
+/// that buffer between calls and reset() keeps its capacity, so after the
+/// first send this neither allocates nor copies. A Manchester frame without
+/// a header cannot start with a space half (decode_line() could not find
+/// it): such a frame is not sent and false is returned.
+bool encode_line(const LineCoding &coding, const uint8_t *bytes, size_t bits, remote_base::RemoteTransmitData *dst);
+#endif
+
+/// Timings one frame of `bits` bits takes, header and footer included
+/// (the maximum for MANCHESTER, where adjacent equal halves merge).
+size_t line_timing_count(const LineCoding &coding, size_t bits);
+
+}  // namespace ir_common
+}  // namespace esphome
@@ -0,0 +1,52 @@
+#include "loop_budget.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+#include <cstring>
+
+namespace esphome {
+namespace ir_common {
+
+static const char *const TAG = "ir_common.budget";
+
+static uint32_t budget_us = DEFAULT_LOOP_BUDGET_US;
+static uint32_t overruns = 0;
+static uint32_t worst_us = 0;
+static BudgetSite *sites = nullptr;
+
+void set_loop_budget(uint32_t budget) { budget_us = budget; }
+uint32_t loop_budget() { return budget_us; }
+uint32_t loop_overruns() { return overruns; }
+uint32_t loop_worst_us() { return worst_us; }
+const BudgetSite *budget_sites() { return sites; }
+
+const BudgetSite *find_budget_site(const char *name) {
+  for (const BudgetSite *site = sites; site != nullptr; site = site->next) {
+    if (strcmp(site->name, name) == 0)
+      return site;
+  }
+  return nullptr;
+}
+
+BudgetGuard::BudgetGuard(BudgetSite &site) : site_(site), start_us_(micros()) {}
+
+BudgetGuard::~BudgetGuard() {
+  uint32_t elapsed = micros() - this->start_us_;
+  BudgetSite &site = this->site_;
+  if (site.passes++ == 0) {
+    site.next = sites;
+    sites = &site;
+  }
+  if (elapsed > site.worst_us)
+    site.worst_us = elapsed;
+  if (elapsed > worst_us)
+    worst_us = elapsed;
+  if (elapsed <= budget_us)
+    return;
+  site.overruns++;
+  overruns++;
+  ESP_LOGW(TAG, "%s blocked the loop for %u.%03u ms (budget %u ms)", site.name, (unsigned) (elapsed / 1000),
+           (unsigned) (elapsed % 1000), (unsigned) (budget_us / 1000));
+}
+
+}  // namespace ir_common
+}  // namespace esphome
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+
+namespace esphome {
+namespace ir_common {
+
+// ======================================================================
+// ===                      LOOP TIME BUDGET                          ===
+// ======================================================================
+// ESPHome only warns that "a component" blocked the loop. BudgetGuard
+// times one pass through a hot path (control, on_receive, a sensor
+// callback, a scheduled task) and compares it with a shared budget: the
+// worst pass per site is kept, and every pass over budget is counted and
+// logged with the site's name. Timing costs two micros() calls, so the
+// guards are always compiled in; the ir_common sensor platform sets the
+// budget and publishes the totals.
+
+/// Budget in µs; ESPHome itself warns above 30 ms.
+static const uint32_t DEFAULT_LOOP_BUDGET_US = 20000;
+
+struct BudgetSite {
+  const char *name;
+  uint32_t passes;
+  uint32_t worst_us;
+  uint32_t overruns;
+  BudgetSite *next;  // sites link themselves on their first pass
+};
+
+void set_loop_budget(uint32_t budget_us);
+uint32_t loop_budget();
+/// Passes over budget, across all sites.
+uint32_t loop_overruns();
+/// Slowest pass seen at any site, in µs.
+uint32_t loop_worst_us();
+/// Sites that ran at least once, most recently added first.
+const BudgetSite *budget_sites();
+/// The site called `name`, or nullptr until it has run.
+const BudgetSite *find_budget_site(const char *name);
+
+class BudgetGuard {
+ public:
+  explicit BudgetGuard(BudgetSite &site);
+  ~BudgetGuard();
+
+ protected:
+  BudgetSite &site_;
+  uint32_t start_us_;
+};
+
+}  // namespace ir_common
+}  // namespace esphome
@@ -0,0 +1,141 @@
+#include "protocol_id.h"
+#include "frame_segmenter.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace esphome {
+namespace ir_common {
+
+static const uint32_t HEADER_ZERO_PERCENT = 35;
+static const uint8_t SCORE_HEADER = 30;
+static const uint8_t SCORE_BITS = 30;
+static const uint8_t SCORE_SPACES = 10;
+static const uint8_t SCORE_CHECKSUM = 30;
+static const uint8_t SCORE_CHECKSUM_REPAIRED = 20;
+static const uint8_t SCORE_SIGNATURE = 15;
+
+// ----------------------------------------------------------------------
+// Frame checks, over bytes MSB first as received. These mirror the
+// integrity checks in each platform's decoder.
+// ----------------------------------------------------------------------
+// carrier_ac: the 16 nibbles sum to 0xF (mod 16)
+static bool carrier_64_ok(const uint8_t *b, size_t len) {
+  uint8_t sum = 0;
+  for (size_t i = 0; i < len; i++)
+    sum += (b[i] >> 4) + (b[i] & 0x0F);
+  return (sum & 0x0F) == 0x0F;
+}
+
+// carrier_cartridge_rx: B1 = ~B0, B3 = ~B2, B2 = length - 6, XOR checksum
+static bool carrier_cartridge_ok(const uint8_t *b, size_t len) {
+  if (len < 7 || (b[0] ^ b[1]) != 0xFF || (b[2] ^ b[3]) != 0xFF || b[2] + 6u != len)
+    return false;
+  uint8_t x = 0;
+  for (size_t i = 0; i + 1 < len; i++)
+    x ^= b[i];
+  return x == b[len - 1];
+}
+
+// saijo_ac: checksum not reverse-engineered yet, every frame starts A0
+static bool saijo_72_ok(const uint8_t *b, size_t len) { return len >= 1 && b[0] == 0xA0; }
+
+static uint8_t reverse_bits(uint8_t b) {
+  b = (b & 0xF0) >> 4 | (b & 0x0F) << 4;
+  b = (b & 0xCC) >> 2 | (b & 0x33) << 2;
+  b = (b & 0xAA) >> 1 | (b & 0x55) << 1;
+  return b;
+}
+
+// mitsubishi_ac: LSB first, byte 13 = sum of bytes 0..12, starts C4 D3
+static bool mitsubishi_112_ok(const uint8_t *b, size_t len) {
+  if (len < 2 || b[0] != 0xC4 || b[1] != 0xD3)
+    return false;
+  uint8_t sum = 0;
+  for (size_t i = 0; i + 1 < len; i++)
+    sum += reverse_bits(b[i]);
+  return sum == reverse_bits(b[len - 1]);
+}
+
+// kind, header mark/space, fixed, zero, one, footer, lsb_first, inverted
+static const LineCoding CARRIER_CODING = {LINE_PULSE_DISTANCE, 9000, 4500, 650, 500, 1600, 650, false, false};
+static const LineCoding CARTRIDGE_CODING = {LINE_PULSE_DISTANCE, 4320, 4350, 500, 550, 1650, 500, false, false};
+static const LineCoding MITSUBISHI_CODING = {LINE_PULSE_DISTANCE, 3400, 1700, 450, 420, 1270, 450, false, false};
+
+static const ProtocolInfo PROTOCOLS[] = {
+    {"carrier_ac (64-bit)", CARRIER_CODING, 64, carrier_64_ok, true},
+    {"carrier_cartridge", CARTRIDGE_CODING, 72, carrier_cartridge_ok, true},
+    {"carrier_cartridge (swing)", CARTRIDGE_CODING, 56, carrier_cartridge_ok, true},
+    {"saijo_ac (72-bit)", CARRIER_CODING, 72, saijo_72_ok, false},
+    {"mitsubishi_ac (112-bit)", MITSUBISHI_CODING, 112, mitsubishi_112_ok, true},
+};
+
+const ProtocolInfo *known_protocols(size_t *count) {
+  *count = sizeof(PROTOCOLS) / sizeof(PROTOCOLS[0]);
+  return PROTOCOLS;
+}
+
+// Linear from full score at nominal to 0 at HEADER_ZERO_PERCENT off
+static uint32_t header_score(int32_t measured, uint16_t nominal) {
+  uint32_t diff = std::abs(std::abs(measured) - int32_t(nominal));
+  uint32_t limit = nominal * HEADER_ZERO_PERCENT / 100;
+  return diff >= limit ? 0 : SCORE_HEADER * (limit - diff) / limit;
+}
+
+static bool score_protocol(const ProtocolInfo &p, const int32_t *t, size_t len, ProtocolGuess *out) {
+  if (len < 3 || len != line_timing_count(p.coding, p.bits))
+    return false;
+
+  uint32_t score = SCORE_BITS;
+  score += std::min(header_score(t[0], p.coding.header_mark_us), header_score(t[1], p.coding.header_space_us));
+
+  SoftBits soft;
+  if (decode_line(p.coding, t, len, p.bits, &soft) != p.bits)
+    return false;
+  uint32_t confidence = 0;
+  for (size_t i = 0; i < soft.bits; i++)
+    confidence += soft.confidence[i];
+  score += SCORE_SPACES * confidence / (255u * soft.bits);
+
+  int repaired = repair_bits(&soft, p.check);
+  if (repaired == 0)
+    score += p.checksum ? SCORE_CHECKSUM : SCORE_SIGNATURE;
+  else if (repaired > 0)
+    score += p.checksum ? SCORE_CHECKSUM_REPAIRED : SCORE_SIGNATURE;
+
+  out->protocol = &p;
+  out->confidence = score;
+  out->repaired = repaired;
+  out->length = soft.byte_count();
+  memcpy(out->bytes, soft.bytes, out->length);
+  out->quality = measure_signal(p.coding, t, len, p.bits);
+  return true;
+}
+
+size_t identify_protocol(const int32_t *timings, size_t len, ProtocolGuess *guesses, size_t max_guesses) {
+  FrameSpan span;
+  if (segment_frames(timings, len, PROTOCOL_ID_GAP_US, 3 + 16, &span, 1) == 0)
+    return 0;
+
+  size_t n = 0;
+  for (const auto &p : PROTOCOLS) {
+    ProtocolGuess guess;
+    if (!score_protocol(p, timings + span.start, span.length, &guess))
+      continue;
+    // Insertion sort, best first; the table is tiny
+    size_t pos = std::min(n, max_guesses);
+    while (pos > 0 && guesses[pos - 1].confidence < guess.confidence)
+      pos--;
+    if (pos == max_guesses)
+      continue;
+    size_t last = std::min(n, max_guesses - 1);
+    for (size_t i = last; i > pos; i--)
+      guesses[i] = guesses[i - 1];
+    guesses[pos] = guess;
+    n = std::min(n + 1, max_guesses);
+  }
+  return n;
+}
+
+}  // namespace ir_common
+}  // namespace esphome
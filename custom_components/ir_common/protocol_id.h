@@ -0,0 +1,54 @@
+#pragma once
+
+#include "line_coding.h"
+#include "signal_quality.h"
+#include "soft_bits.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace ir_common {
+
+// ======================================================================
+// ===                  PROTOCOL AUTO-IDENTIFICATION                  ===
+// ======================================================================
+// Fingerprints a capture against every pulse-distance protocol in this
+// repository. The first frame of the capture is scored per protocol on:
+//
+//   header  30  header mark/space against nominal, 0 at 35% off
+//   bits    30  exact bit count, otherwise the protocol is ruled out
+//   coding  10  mean soft-bit confidence against its line coding
+//   check   30  checksum passes (20 after bit repair); 15 for protocols
+//               with only a fixed signature byte to go on
+//
+// The result is a 0-100 confidence per candidate, best first.
+
+struct ProtocolInfo {
+  const char *name;
+  LineCoding coding;
+  uint8_t bits;
+  FrameCheck check;
+  bool checksum;  // false: check only matches a signature, not the payload
+};
+
+struct ProtocolGuess {
+  const ProtocolInfo *protocol;
+  uint8_t confidence;  // 0-100
+  int8_t repaired;     // bits flipped to pass the check, -1 if it failed
+  uint8_t length;      // bytes, MSB first as received
+  SignalQuality quality;  // against this protocol's coding
+  uint8_t bytes[SOFT_MAX_BITS / 8];
+};
+
+static const uint32_t PROTOCOL_ID_GAP_US = 5000;  // longer than any header space
+static const size_t PROTOCOL_ID_MAX_GUESSES = 4;
+
+/// Protocol table, for listing what the reader knows.
+const ProtocolInfo *known_protocols(size_t *count);
+
+/// Scores the first frame of the capture against every known protocol and
+/// writes the candidates whose bit count fits, best first. Returns how many.
+size_t identify_protocol(const int32_t *timings, size_t len, ProtocolGuess *guesses, size_t max_guesses);
+
+}  // namespace ir_common
+}  // namespace esphome
@@ -0,0 +1,50 @@
+#include "publish_gate.h"
+#include "esphome/core/hal.h"
+#include <cmath>
+
+namespace esphome {
+namespace ir_common {
+
+void PublishGate::attach(climate::Climate *climate) {
+  climate->add_on_state_callback([this](climate::Climate &c) { this->published_(c, millis()); });
+}
+
+void PublishGate::published_(const climate::Climate &climate, uint32_t now) {
+  this->published_once_ = true;
+  this->last_state_ = AcState::from_climate(climate, climate.swing_mode);
+  this->last_current_ = climate.current_temperature;
+  this->last_ms_ = now;
+  // Whatever was held back just went out with this publish
+  this->held_ = false;
+}
+
+void PublishGate::hold(uint32_t now, uint32_t wait) {
+  this->held_ = true;
+  this->due_ms_ = now + wait;
+}
+
+bool PublishGate::take_due(uint32_t now) {
+  if (!this->held_ || (int32_t) (now - this->due_ms_) < 0)
+    return false;
+  this->held_ = false;
+  return true;
+}
+
+uint32_t PublishGate::wait_ms(const climate::Climate &climate, uint32_t now) const {
+  if (!this->published_once_ || AcState::from_climate(climate, climate.swing_mode) != this->last_state_)
+    return 0;
+
+  float current = climate.current_temperature;
+  bool was_nan = std::isnan(this->last_current_);
+  if (std::isnan(current) && was_nan)
+    return PUBLISH_NOT_NEEDED;
+  // Going to or from "no reading" always counts as a change
+  if (!std::isnan(current) && !was_nan && std::fabs(current - this->last_current_) < this->deadband_)
+    return PUBLISH_NOT_NEEDED;
+
+  uint32_t elapsed = now - this->last_ms_;
+  return elapsed >= this->min_interval_ms_ ? 0 : this->min_interval_ms_ - elapsed;
+}
+
+}  // namespace ir_common
+}  // namespace esphome
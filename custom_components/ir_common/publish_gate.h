@@ -0,0 +1,61 @@
+#pragma once
+
+#include "esphome/components/climate/climate.h"
+#include "ac_state.h"
+#include <algorithm>
+#include <cstdint>
+
+namespace esphome {
+namespace ir_common {
+
+// ======================================================================
+// ===                   CHANGE-ONLY STATE PUBLISHING                 ===
+// ======================================================================
+// A room sensor updating every few seconds would otherwise republish the
+// whole climate state each time, flooding the API and the HA recorder.
+// The gate watches every publish (through the climate's state callback) and
+// tells the entity when another one is worth sending:
+//   - a change to the AcState (mode, fan, setpoint, swing) goes out at once;
+//   - a current-temperature change goes out only if it moved by at least
+//     the deadband, and no sooner than min_interval after the last publish;
+//   - anything else is dropped.
+// A held-back publish is only a flag and a deadline: the owner polls
+// take_due() from a set_interval(), so holding one back never schedules
+// (and allocates) a timeout on the receive path.
+
+static const uint32_t PUBLISH_NOT_NEEDED = UINT32_MAX;
+
+class PublishGate {
+ public:
+  void set_min_interval(uint32_t min_interval_ms) { this->min_interval_ms_ = min_interval_ms; }
+  void set_temperature_deadband(float deadband) { this->deadband_ = deadband; }
+
+  /// Records every publish of `climate`, whoever makes it. Call once from setup().
+  void attach(climate::Climate *climate);
+
+  /// Milliseconds until `climate` should be published: 0 = now,
+  /// PUBLISH_NOT_NEEDED = nothing worth sending changed.
+  uint32_t wait_ms(const climate::Climate &climate, uint32_t now) const;
+
+  /// Asks take_due() to report a publish `wait` ms after `now`.
+  void hold(uint32_t now, uint32_t wait);
+  /// True once the held-back publish is due; clears it.
+  bool take_due(uint32_t now);
+  /// How often the owner should call take_due().
+  uint32_t poll_interval() const { return std::max<uint32_t>(this->min_interval_ms_ / 4, 250); }
+
+ protected:
+  void published_(const climate::Climate &climate, uint32_t now);
+
+  uint32_t min_interval_ms_{0};
+  float deadband_{0.0f};
+  bool published_once_{false};
+  AcState last_state_;
+  float last_current_{NAN};
+  uint32_t last_ms_{0};
+  bool held_{false};
+  uint32_t due_ms_{0};
+};
+
+}  // namespace ir_common
+}  // namespace esphome
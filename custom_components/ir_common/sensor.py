@@ -0,0 +1,122 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import sensor
+from esphome.const import (
+    CONF_ID,
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    STATE_CLASS_MEASUREMENT,
+    STATE_CLASS_TOTAL_INCREASING,
+    UNIT_BYTES,
+    UNIT_MILLISECOND,
+)
+
+from . import ir_common_ns
+
+CONF_ALLOCATIONS = "allocations"
+CONF_ALLOCATED_BYTES = "allocated_bytes"
+CONF_VIOLATIONS = "steady_state_violations"
+CONF_LOOP_BUDGET = "loop_budget"
+CONF_LOOP_WORST_TIME = "loop_worst_time"
+CONF_LOOP_OVERRUNS = "loop_overruns"
+CONF_LOOP_SITES = "loop_sites"
+CONF_SITE = "site"
+CONF_WORST_TIME = "worst_time"
+CONF_OVERRUNS = "overruns"
+
+# Every BudgetSite in these components (the names their BudgetGuards log).
+# A site covers all instances of its platform.
+BUDGET_SITES = (
+    "carrier_ac.control",
+    "carrier_ac.on_receive",
+    "carrier_cartridge_rx.control",
+    "carrier_cartridge_rx.climate_receive",
+    "carrier_cartridge_rx.on_receive",
+    "carrier_cartridge_rx.publish",
+    "ir_capture.on_receive",
+    "ir_common.state_store.commit",
+    "mitsubishi_ac.control",
+    "mitsubishi_ac.on_receive",
+    "raw_ac.control",
+    "raw_ac.on_receive",
+    "raw_ac.publish",
+    "remote_reader.control",
+    "remote_reader.on_receive",
+    "saijo_ac.control",
+    "saijo_ac.on_receive",
+)
+
+DiagnosticSensor = ir_common_ns.class_("DiagnosticSensor", cg.PollingComponent)
+
+_COUNTER = dict(
+    accuracy_decimals=0,
+    state_class=STATE_CLASS_TOTAL_INCREASING,
+    entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+)
+
+_WORST_TIME = dict(
+    unit_of_measurement=UNIT_MILLISECOND,
+    accuracy_decimals=1,
+    state_class=STATE_CLASS_MEASUREMENT,
+    entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+)
+
+SITE_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.Required(CONF_SITE): cv.one_of(*BUDGET_SITES),
+            cv.Optional(CONF_WORST_TIME): sensor.sensor_schema(**_WORST_TIME),
+            cv.Optional(CONF_OVERRUNS): sensor.sensor_schema(**_COUNTER),
+        }
+    ),
+    cv.has_at_least_one_key(CONF_WORST_TIME, CONF_OVERRUNS),
+)
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(DiagnosticSensor),
+        cv.Optional(CONF_ALLOCATIONS): sensor.sensor_schema(**_COUNTER),
+        cv.Optional(CONF_ALLOCATED_BYTES): sensor.sensor_schema(unit_of_measurement=UNIT_BYTES, **_COUNTER),
+        # Guarded IR hot paths (decode, control) that allocated after their first pass
+        cv.Optional(CONF_VIOLATIONS): sensor.sensor_schema(**_COUNTER),
+        # The same paths timed against loop_budget (see loop_budget.h)
+        cv.Optional(CONF_LOOP_BUDGET, default="20ms"): cv.All(
+            cv.positive_time_period_microseconds, cv.Range(min=cv.TimePeriod(milliseconds=1))
+        ),
+        cv.Optional(CONF_LOOP_WORST_TIME): sensor.sensor_schema(**_WORST_TIME),
+        cv.Optional(CONF_LOOP_OVERRUNS): sensor.sensor_schema(**_COUNTER),
+        # The same two numbers for single paths
+        cv.Optional(CONF_LOOP_SITES): cv.ensure_list(SITE_SCHEMA),
+    }
+).extend(cv.polling_component_schema("60s"))
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+    cg.add(var.set_loop_budget(config[CONF_LOOP_BUDGET]))
+
+    # Route every allocation through the counters in alloc_stats.cpp; timing
+    # alone does not need the wrappers
+    if any(key in config for key in (CONF_ALLOCATIONS, CONF_ALLOCATED_BYTES, CONF_VIOLATIONS)):
+        cg.add_define("USE_IR_ALLOC_TRACKING")
+        cg.add_build_flag("-Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc")
+
+    if CONF_ALLOCATIONS in config:
+        sens = await sensor.new_sensor(config[CONF_ALLOCATIONS])
+        cg.add(var.set_allocations_sensor(sens))
+    if CONF_ALLOCATED_BYTES in config:
+        sens = await sensor.new_sensor(config[CONF_ALLOCATED_BYTES])
+        cg.add(var.set_allocated_bytes_sensor(sens))
+    if CONF_VIOLATIONS in config:
+        sens = await sensor.new_sensor(config[CONF_VIOLATIONS])
+        cg.add(var.set_violations_sensor(sens))
+    if CONF_LOOP_WORST_TIME in config:
+        sens = await sensor.new_sensor(config[CONF_LOOP_WORST_TIME])
+        cg.add(var.set_loop_worst_sensor(sens))
+    if CONF_LOOP_OVERRUNS in config:
+        sens = await sensor.new_sensor(config[CONF_LOOP_OVERRUNS])
+        cg.add(var.set_loop_overruns_sensor(sens))
+    for site in config.get(CONF_LOOP_SITES, []):
+        worst = await sensor.new_sensor(site[CONF_WORST_TIME]) if CONF_WORST_TIME in site else cg.nullptr
+        overruns = await sensor.new_sensor(site[CONF_OVERRUNS]) if CONF_OVERRUNS in site else cg.nullptr
+        cg.add(var.add_site_sensors(site[CONF_SITE], worst, overruns))
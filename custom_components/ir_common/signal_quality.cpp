@@ -0,0 +1,85 @@
+#include "signal_quality.h"
+#include <algorithm>
+#include <cstdlib>
+
+namespace esphome {
+namespace ir_common {
+
+static uint32_t deviation(int32_t measured, uint32_t nominal) {
+  uint32_t d = std::abs(measured);
+  return d > nominal ? d - nominal : nominal - d;
+}
+
+// 100 at nominal, 0 at SIGNAL_ERROR_LIMIT_PERCENT off
+static uint32_t error_score(uint32_t error, uint32_t nominal) {
+  uint32_t limit = nominal * SIGNAL_ERROR_LIMIT_PERCENT / 100;
+  return limit == 0 || error >= limit ? 0 : 100 * (limit - error) / limit;
+}
+
+static uint16_t clamp16(uint32_t v) { return std::min<uint32_t>(v, UINT16_MAX); }
+
+void SignalQuality::merge(const SignalQuality &other) {
+  this->bit_margin_us = std::min(this->bit_margin_us, other.bit_margin_us);
+  this->fixed_error_us = std::max(this->fixed_error_us, other.fixed_error_us);
+  this->header_error_us = std::max(this->header_error_us, other.header_error_us);
+  this->score = std::min(this->score, other.score);
+}
+
+SignalQuality measure_signal(const LineCoding &coding, const int32_t *timings, size_t len, size_t bits) {
+  uint32_t margin = UINT32_MAX;
+  uint32_t fixed_error = 0;
+  uint32_t header_error = 0;
+  uint32_t score = 100;
+
+  size_t first = 0;
+  if (coding.header_mark_us != 0 && len >= 2) {
+    uint32_t mark = deviation(timings[0], coding.header_mark_us);
+    uint32_t space = deviation(timings[1], coding.header_space_us);
+    header_error = std::max(mark, space);
+    score = std::min(error_score(mark, coding.header_mark_us), error_score(space, coding.header_space_us));
+    first = 2;
+  }
+
+  uint32_t half;  // threshold to nominal
+  if (coding.kind == LINE_MANCHESTER) {
+    // Every timing is one or two units; thresholds sit at 0.5, 1.5 and 2.5 units
+    const uint32_t unit = coding.fixed_us;
+    half = unit / 2;
+    for (size_t i = first; i < len; i++) {
+      uint32_t d = std::abs(timings[i]);
+      uint32_t units = (d + half) / unit;
+      if (units < 1 || units > 2)
+        break;
+      margin = std::min(margin, half - std::min(half, deviation(d, units * unit)));
+    }
+  } else {
+    // Pulse distance: fixed mark, varying space. Pulse width: the reverse.
+    const bool distance = coding.kind == LINE_PULSE_DISTANCE;
+    const uint32_t mid = (coding.zero_us + coding.one_us) / 2;
+    half = (coding.one_us - coding.zero_us) / 2;
+    for (size_t bit = 0; bit < bits; bit++) {
+      size_t mark = first + 2 * bit;
+      size_t varying = distance ? mark + 1 : mark;
+      size_t fixed = distance ? mark : mark + 1;
+      if (varying >= len)
+        break;
+      margin = std::min(margin, deviation(timings[varying], mid));
+      // The last pulse-width space runs into the gap
+      if (fixed < len && (distance || bit + 1 < bits))
+        fixed_error = std::max(fixed_error, deviation(timings[fixed], coding.fixed_us));
+    }
+    size_t footer = first + 2 * bits;
+    if (coding.footer_mark_us != 0 && footer < len)
+      fixed_error = std::max(fixed_error, deviation(timings[footer], coding.footer_mark_us));
+    score = std::min(score, error_score(fixed_error, coding.fixed_us));
+  }
+  if (margin == UINT32_MAX)
+    margin = 0;
+  if (half != 0)
+    score = std::min<uint32_t>(score, 100 * std::min(margin, half) / half);
+
+  return SignalQuality{clamp16(margin), clamp16(fixed_error), clamp16(header_error), uint8_t(score)};
+}
+
+}  // namespace ir_common
+}  // namespace esphome
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "line_coding.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace ir_common {
+
+// ======================================================================
+// ===                      SIGNAL QUALITY                            ===
+// ======================================================================
+// A frame that decodes may still have been one noisy timing away from
+// failing. measure_signal() reports how far it was, against the same
+// LineCoding table the frame was decoded with:
+//
+//   bit margin    smallest distance of a bit-carrying timing from its 0/1
+//                 decision threshold (the space for pulse distance, the
+//                 mark for pulse width, the unit boundary for Manchester)
+//   fixed error   largest deviation of a fixed timing (data and footer
+//                 marks for pulse distance) from nominal
+//   header error  largest deviation of the header mark or space
+//
+// score folds them into 0-100: the bit margin as a share of the distance
+// from threshold to nominal, the fixed and header errors against the same
+// 35% limit protocol_id uses for headers. The lowest of the three wins, so
+// a low score names a receiver that needs moving or a tolerance to widen.
+
+static const uint32_t SIGNAL_ERROR_LIMIT_PERCENT = 35;
+
+struct SignalQuality {
+  uint16_t bit_margin_us;
+  uint16_t fixed_error_us;
+  uint16_t header_error_us;
+  uint8_t score;  // 0-100
+
+  /// Keeps the worse of each field, e.g. across the repeats of a capture.
+  void merge(const SignalQuality &other);
+};
+
+/// Measures one frame laid out as decode_line() expects: header (if the
+/// coding has one) at timings[0..1], then `bits` bits and the footer.
+SignalQuality measure_signal(const LineCoding &coding, const int32_t *timings, size_t len, size_t bits);
+
+}  // namespace ir_common
+}  // namespace esphome
@@ -0,0 +1,80 @@
+#include "soft_bits.h"
+#include <cstdlib>
+#include <cstring>
+
+namespace esphome {
+namespace ir_common {
+
+size_t SoftBits::weak_count() const {
+  size_t n = 0;
+  for (size_t i = 0; i < this->bits; i++)
+    n += this->confidence[i] < SOFT_WEAK_CONFIDENCE;
+  return n;
+}
+
+void set_soft_bit(SoftBits *out, size_t bit, uint32_t duration, uint32_t zero_us, uint32_t one_us) {
+  uint32_t mid = (zero_us + one_us) / 2;
+  uint32_t half = (one_us - zero_us) / 2;
+  uint32_t dist = duration > mid ? duration - mid : mid - duration;
+  if (duration > mid)
+    out->bytes[bit / 8] |= 0x80 >> (bit % 8);
+  out->confidence[bit] = dist >= half ? 255 : dist * 255 / half;
+}
+
+size_t decode_soft_bits(const int32_t *timings, size_t len, size_t first_space, size_t max_bits, uint32_t zero_us,
+                        uint32_t one_us, SoftBits *out) {
+  memset(out, 0, sizeof(SoftBits));
+  if (max_bits > SOFT_MAX_BITS)
+    max_bits = SOFT_MAX_BITS;
+
+  size_t bit = 0;
+  for (size_t i = first_space; i < len && bit < max_bits; i += 2, bit++)
+    set_soft_bit(out, bit, std::abs(timings[i]), zero_us, one_us);
+  out->bits = bit;
+  return bit;
+}
+
+int repair_bits(SoftBits *frame, FrameCheck check) {
+  size_t len = frame->byte_count();
+  if (check(frame->bytes, len))
+    return 0;
+
+  // The weakest few bits, weakest first
+  uint8_t candidates[SOFT_REPAIR_CANDIDATES];
+  size_t n = 0;
+  for (size_t bit = 0; bit < len * 8; bit++) {
+    uint8_t c = frame->confidence[bit];
+    if (c >= SOFT_WEAK_CONFIDENCE)
+      continue;
+    if (n == SOFT_REPAIR_CANDIDATES && c >= frame->confidence[candidates[n - 1]])
+      continue;
+    // Insert in order, dropping the strongest candidate when full
+    size_t pos = n < SOFT_REPAIR_CANDIDATES ? n++ : n - 1;
+    while (pos > 0 && frame->confidence[candidates[pos - 1]] > c) {
+      candidates[pos] = candidates[pos - 1];
+      pos--;
+    }
+    candidates[pos] = bit;
+  }
+
+  for (size_t i = 0; i < n; i++) {
+    frame->flip(candidates[i]);
+    if (check(frame->bytes, len))
+      return 1;
+    frame->flip(candidates[i]);
+  }
+  for (size_t i = 0; i < n; i++) {
+    frame->flip(candidates[i]);
+    for (size_t j = i + 1; j < n; j++) {
+      frame->flip(candidates[j]);
+      if (check(frame->bytes, len))
+        return 2;
+      frame->flip(candidates[j]);
+    }
+    frame->flip(candidates[i]);
+  }
+  return -1;
+}
+
+}  // namespace ir_common
+}  // namespace esphome
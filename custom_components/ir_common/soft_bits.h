@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace ir_common {
+
+// ======================================================================
+// ===              SOFT-DECISION DECODING AND BIT REPAIR             ===
+// ======================================================================
+// Pulse-distance decoders used to either reject a space between the 0 and
+// 1 thresholds or read it as 0. decode_soft_bits() instead takes the
+// nearer nominal duration and records how sure it was: 255 on (or beyond)
+// the nominal duration, 0 exactly halfway. When the frame's checksum then
+// fails, repair_bits() flips the least confident bits - singly, then in
+// pairs - until it passes. Only weak bits are candidates, so a clean frame
+// with a bad checksum is still rejected rather than "fixed".
+
+static const size_t SOFT_MAX_BITS = 128;
+// Below this a bit is a repair candidate. Roughly the old 700..1300 µs
+// rejection band for 500/1600 µs spaces.
+static const uint8_t SOFT_WEAK_CONFIDENCE = 160;
+static const uint8_t SOFT_REPAIR_CANDIDATES = 6;
+
+struct SoftBits {
+  uint8_t bytes[SOFT_MAX_BITS / 8];
+  uint8_t confidence[SOFT_MAX_BITS];
+  uint16_t bits;
+
+  size_t byte_count() const { return this->bits / 8; }
+  void flip(size_t bit) { this->bytes[bit / 8] ^= 0x80 >> (bit % 8); }
+  /// Number of bits below SOFT_WEAK_CONFIDENCE.
+  size_t weak_count() const;
+};
+
+/// Sets bit `bit` to the nearer of zero_us / one_us and records its confidence.
+void set_soft_bit(SoftBits *out, size_t bit, uint32_t duration, uint32_t zero_us, uint32_t one_us);
+
+/// Decodes up to max_bits spaces, MSB first, starting at timings[first_space]
+/// and taking every second entry. Returns the number of bits decoded.
+size_t decode_soft_bits(const int32_t *timings, size_t len, size_t first_space, size_t max_bits, uint32_t zero_us,
+                        uint32_t one_us, SoftBits *out);
+
+/// Frame integrity check over whole bytes, e.g. a protocol checksum.
+using FrameCheck = bool (*)(const uint8_t *bytes, size_t len);
+
+/// Returns the number of bits flipped to make check pass (0 if it already
+/// did), or -1 if no combination of weak bits works. On -1 the frame is unchanged.
+int repair_bits(SoftBits *frame, FrameCheck check);
+
+}  // namespace ir_common
+}  // namespace esphome
@@ -0,0 +1,67 @@
+#include "state_store.h"
+#include "loop_budget.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace ir_common {
+
+static const char *const TAG = "ir_common.state_store";
+
+void StateStore::setup(uint32_t key) {
+#ifdef USE_ESP8266
+  this->rtc_pref_ = global_preferences->make_preference<uint32_t>(key, false);
+#endif
+  this->flash_pref_ = global_preferences->make_preference<uint32_t>(key ^ 0x464C5348 /* "FLSH" */, true);
+}
+
+bool StateStore::load(AcState *state) {
+  uint32_t packed;
+  bool flash_ok = this->flash_pref_.load(&packed);
+  if (flash_ok)
+    this->flashed_ = AcState(packed);
+#ifdef USE_ESP8266
+  if (this->rtc_pref_.load(&packed)) {
+    ESP_LOGD(TAG, "Restored 0x%08X from RTC", packed);
+    *state = this->latest_ = AcState(packed);
+    return true;
+  }
+#endif
+  if (!flash_ok)
+    return false;
+  ESP_LOGD(TAG, "Restored 0x%08X from flash", this->flashed_.packed());
+  *state = this->latest_ = this->flashed_;
+  return true;
+}
+
+void StateStore::attach(climate::Climate *climate) {
+  climate->add_on_state_callback(
+      [this](climate::Climate &c) { this->save(AcState::from_climate(c, c.swing_mode), millis()); });
+}
+
+void StateStore::save(AcState state, uint32_t now) {
+  if (state == this->latest_)
+    return;
+  this->latest_ = state;
+  this->changed_ms_ = now;
+#ifdef USE_ESP8266
+  uint32_t packed = state.packed();
+  this->rtc_pref_.save(&packed);
+#endif
+}
+
+static BudgetSite COMMIT_BUDGET{"ir_common.state_store.commit"};
+
+void StateStore::commit_if_due(uint32_t now) {
+  if (this->latest_ == this->flashed_ || now - this->changed_ms_ < this->flash_delay_ms_)
+    return;
+  BudgetGuard budget_guard(COMMIT_BUDGET);
+  uint32_t packed = this->latest_.packed();
+  if (this->flash_pref_.save(&packed)) {
+    this->flashed_ = this->latest_;
+    ESP_LOGD(TAG, "Saved 0x%08X to flash", packed);
+  }
+}
+
+}  // namespace ir_common
+}  // namespace esphome
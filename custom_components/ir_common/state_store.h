@@ -0,0 +1,60 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+#include "esphome/core/preferences.h"
+#include "ac_state.h"
+#include <algorithm>
+#include <cstdint>
+
+namespace esphome {
+namespace ir_common {
+
+// ======================================================================
+// ===                    PERSISTED CLIMATE STATE                     ===
+// ======================================================================
+// Keeps the last sent or received AcState across reboots without wearing
+// the flash:
+//   - every change goes to RTC memory at once (ESP8266), which survives a
+//     warm reboot or OTA, so the entity comes up with the right state;
+//   - flash is only written once the state has been stable for
+//     flash_delay_ms, so a slider dragged through ten setpoints costs one
+//     write; this copy is what a cold boot restores.
+// On ESP32 ESPHome keeps both kinds of preference in NVS, so only the
+// delayed flash copy is used there.
+//
+// The owner polls commit_if_due() from a set_interval(); nothing is
+// scheduled per change, so control and receive paths stay allocation-free.
+
+// XORed with the entity's object id hash to form the preference keys
+static const uint32_t STATE_STORE_KEY = 0x41435354;  // "ACST"
+
+class StateStore {
+ public:
+  void set_flash_delay(uint32_t flash_delay_ms) { this->flash_delay_ms_ = flash_delay_ms; }
+  /// How often the owner should call commit_if_due().
+  uint32_t poll_interval() const { return std::max<uint32_t>(this->flash_delay_ms_ / 4, 1000); }
+
+  /// `key` must be unique per entity, e.g. get_object_id_hash() ^ a constant.
+  void setup(uint32_t key);
+  /// Newest saved state: RTC if it survived, else flash.
+  bool load(AcState *state);
+  /// Saves every published state of `climate` from now on.
+  void attach(climate::Climate *climate);
+  /// Records `state` in RTC and starts the flash delay.
+  void save(AcState state, uint32_t now);
+  /// Writes flash once the latest state has been stable for the flash delay.
+  void commit_if_due(uint32_t now);
+
+ protected:
+  uint32_t flash_delay_ms_{300000};
+  uint32_t changed_ms_{0};
+  AcState latest_;
+  AcState flashed_;
+#ifdef USE_ESP8266
+  ESPPreferenceObject rtc_pref_;
+#endif
+  ESPPreferenceObject flash_pref_;
+};
+
+}  // namespace ir_common
+}  // namespace esphome
@@ -0,0 +1,98 @@
+#include "timing_histogram.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace esphome {
+namespace ir_common {
+
+static const uint32_t FINE_END_US = HISTOGRAM_FINE_BINS * HISTOGRAM_FINE_US;
+
+size_t TimingHistogram::bin_of(uint32_t duration_us) {
+  if (duration_us < FINE_END_US)
+    return duration_us / HISTOGRAM_FINE_US;
+  size_t bin = HISTOGRAM_FINE_BINS + (duration_us - FINE_END_US) / HISTOGRAM_COARSE_US;
+  return bin < HISTOGRAM_BINS ? bin : HISTOGRAM_BINS - 1;
+}
+
+uint32_t TimingHistogram::bin_start(size_t bin) {
+  if (bin < HISTOGRAM_FINE_BINS)
+    return bin * HISTOGRAM_FINE_US;
+  return FINE_END_US + (bin - HISTOGRAM_FINE_BINS) * HISTOGRAM_COARSE_US;
+}
+
+uint32_t TimingHistogram::bin_width(size_t bin) {
+  return bin < HISTOGRAM_FINE_BINS ? HISTOGRAM_FINE_US : HISTOGRAM_COARSE_US;
+}
+
+void TimingHistogram::add(const int32_t *timings, size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    uint16_t *table = timings[i] >= 0 ? this->marks_ : this->spaces_;
+    uint16_t &count = table[bin_of(std::abs(timings[i]))];
+    if (count != UINT16_MAX)
+      count++;
+  }
+  this->frames_++;
+}
+
+void TimingHistogram::clear() {
+  memset(this->marks_, 0, sizeof(this->marks_));
+  memset(this->spaces_, 0, sizeof(this->spaces_));
+  this->frames_ = 0;
+}
+
+size_t TimingHistogram::clusters(bool marks, TimingCluster *out, size_t max_clusters) const {
+  const uint16_t *table = marks ? this->marks_ : this->spaces_;
+  size_t n = 0;
+  size_t bin = 0;
+  while (bin < HISTOGRAM_BINS) {
+    if (table[bin] == 0) {
+      bin++;
+      continue;
+    }
+    // Bin centres weighted by count
+    uint64_t weighted = 0;
+    uint32_t count = 0;
+    for (; bin < HISTOGRAM_BINS && table[bin] != 0; bin++) {
+      // The open-ended last bin counts as its lower edge
+      uint32_t centre = bin_start(bin) + (bin + 1 < HISTOGRAM_BINS ? bin_width(bin) / 2 : 0);
+      weighted += uint64_t(table[bin]) * centre;
+      count += table[bin];
+    }
+    TimingCluster cluster{uint32_t(weighted / count), count};
+    // Insertion by count, dropping the rarest when full
+    size_t pos = n < max_clusters ? n++ : max_clusters;
+    while (pos > 0 && out[pos - 1].count < cluster.count) {
+      if (pos < max_clusters)
+        out[pos] = out[pos - 1];
+      pos--;
+    }
+    if (pos < max_clusters)
+      out[pos] = cluster;
+  }
+  return n;
+}
+
+const char *TimingHistogram::format(char *buffer, size_t size) const {
+  if (size == 0)
+    return buffer;
+  size_t pos = 0;
+  buffer[0] = '\0';
+  TimingCluster clusters[HISTOGRAM_MAX_CLUSTERS];
+  for (int kind = 0; kind < 2; kind++) {
+    size_t n = this->clusters(kind == 0, clusters, HISTOGRAM_MAX_CLUSTERS);
+    int w = snprintf(buffer + pos, size - pos, kind == 0 ? "M" : " | S");
+    for (size_t i = 0; i < n && w >= 0 && pos + w < size; i++) {
+      pos += w;
+      w = snprintf(buffer + pos, size - pos, " %ux%u", (unsigned) clusters[i].duration_us,
+                   (unsigned) clusters[i].count);
+    }
+    if (w < 0 || pos + w >= size)
+      return buffer;  // truncated by snprintf
+    pos += w;
+  }
+  return buffer;
+}
+
+}  // namespace ir_common
+}  // namespace esphome
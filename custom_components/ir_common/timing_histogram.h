@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace ir_common {
+
+// ======================================================================
+// ===                MARK / SPACE DURATION HISTOGRAM                 ===
+// ======================================================================
+// Accumulates every mark and space the receiver sees into fixed bins, so
+// the timing clusters of an unknown remote show up on the device without
+// `dump: raw` logs. 50 µs bins up to 2.4 ms resolve bit timings, 500 µs
+// bins up to 9.9 ms catch headers, and the last bin takes anything longer
+// (frame gaps). Counts saturate instead of wrapping.
+// Both tables together are 256 bytes.
+
+static const size_t HISTOGRAM_BINS = 64;
+static const size_t HISTOGRAM_FINE_BINS = 48;
+static const uint32_t HISTOGRAM_FINE_US = 50;
+static const uint32_t HISTOGRAM_COARSE_US = 500;
+static const size_t HISTOGRAM_MAX_CLUSTERS = 8;
+
+/// A run of adjacent non-empty bins: count-weighted mean duration and total count.
+struct TimingCluster {
+  uint32_t duration_us;
+  uint32_t count;
+};
+
+class TimingHistogram {
+ public:
+  /// Adds a capture: positive timings are marks, negative ones spaces.
+  void add(const int32_t *timings, size_t len);
+  void clear();
+
+  uint32_t frames() const { return this->frames_; }
+  uint16_t marks(size_t bin) const { return this->marks_[bin]; }
+  uint16_t spaces(size_t bin) const { return this->spaces_[bin]; }
+
+  static size_t bin_of(uint32_t duration_us);
+  /// Lower edge of `bin`; the last bin has no upper edge.
+  static uint32_t bin_start(size_t bin);
+  static uint32_t bin_width(size_t bin);
+
+  /// Clusters of the mark (or space) table, most frequent first.
+  size_t clusters(bool marks, TimingCluster *out, size_t max_clusters) const;
+  /// "M 650x130 9000x2 | S 500x66 1600x62 4500x2", truncated to `size`.
+  const char *format(char *buffer, size_t size) const;
+
+ protected:
+  uint16_t marks_[HISTOGRAM_BINS]{};
+  uint16_t spaces_[HISTOGRAM_BINS]{};
+  uint32_t frames_{0};
+};
+
+}  // namespace ir_common
+}  // namespace esphome
@@ -1,4 +1,5 @@
 #include "mitsubishi_ac.h"
+#include "mitsubishi_ac_codebook.h"
 #include <cstring>
 
 namespace esphome {
@@ -16,73 +17,102 @@ static const int32_t PULSE_DURATION_US = 450;
 static const int32_t SPACE_ZERO_US = -420;
 static const int32_t SPACE_ONE_US = -1270;
 static const int32_t FINAL_PULSE_US = 450;
-static const int32_t SPACE_ONE_MIN_US = 850;
+// Sent with ir_common::encode_line; received frames are graded against it
+static const ir_common::LineCoding CODING = {ir_common::LINE_PULSE_DISTANCE, HEADER_PULSE_US, -HEADER_SPACE_US,
+                                             PULSE_DURATION_US, -SPACE_ZERO_US, -SPACE_ONE_US, FINAL_PULSE_US,
+                                             false, false};
 
 // ===============================================================
 // CODEBOOK  (14-byte frames)
 // ===============================================================
-static const uint8_t CODE_COOL_22_AUTO[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3 };
-static const uint8_t CODE_COOL_23_AUTO[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23 };
-static const uint8_t CODE_COOL_24_AUTO[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3 };
-static const uint8_t CODE_COOL_25_AUTO[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43 };
-static const uint8_t CODE_COOL_26_AUTO[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83 };
-static const uint8_t CODE_COOL_27_AUTO[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03 };
-static const uint8_t CODE_COOL_22_LOW[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0x90, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE3 };
-static const uint8_t CODE_COOL_23_LOW[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0x10, 0x40, 0x00, 0x00, 0x00, 0x00, 0x63 };
-static const uint8_t CODE_COOL_24_LOW[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0xE0, 0x40, 0x00, 0x00, 0x00, 0x00, 0xA3 };
-static const uint8_t CODE_COOL_25_LOW[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0x60, 0x40, 0x00, 0x00, 0x00, 0x00, 0x23 };
-static const uint8_t CODE_COOL_26_LOW[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0xA0, 0x40, 0x00, 0x00, 0x00, 0x00, 0xC3 };
-static const uint8_t CODE_COOL_27_LOW[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00, 0x43 };
-static const uint8_t CODE_COOL_22_MEDIUM[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0x90, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00 };
-static const uint8_t CODE_COOL_23_MEDIUM[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0x10, 0xDC, 0x00, 0x00, 0x00, 0x00, 0xFF };
-static const uint8_t CODE_COOL_24_MEDIUM[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0xE0, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x7F };
-static const uint8_t CODE_COOL_25_MEDIUM[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0x60, 0xDC, 0x00, 0x00, 0x00, 0x00, 0xBF };
-static const uint8_t CODE_COOL_26_MEDIUM[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0xA0, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x3F };
-static const uint8_t CODE_COOL_27_MEDIUM[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0x20, 0xDC, 0xDC, 0x00, 0x00, 0x00, 0xDF };
-static const uint8_t CODE_COOL_22_HIGH[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0x90, 0xBC, 0xDC, 0x00, 0x00, 0x00, 0x40 };
-static const uint8_t CODE_COOL_23_HIGH[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0x10, 0xBC, 0xDC, 0x00, 0x00, 0x00, 0x80 };
-static const uint8_t CODE_COOL_24_HIGH[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0xE0, 0xBC, 0xDC, 0x00, 0x00, 0x00, 0x00 };
-static const uint8_t CODE_COOL_25_HIGH[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0x60, 0xBC, 0xDC, 0x00, 0x00, 0x00, 0xFF };
-static const uint8_t CODE_COOL_26_HIGH[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0xA0, 0xBC, 0xDC, 0x00, 0x00, 0x00, 0x7F };
-static const uint8_t CODE_COOL_27_HIGH[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0x20, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xBF };
-static const uint8_t CODE_FAN_ONLY_AUTO[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xE0, 0xE0, 0x1C, 0x00, 0x00, 0x00, 0x00, 0xFF };
-static const uint8_t CODE_FAN_ONLY_LOW[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xE0, 0xE0, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x80 };
-static const uint8_t CODE_FAN_ONLY_MEDIUM[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xE0, 0xE0, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x40 };
-static const uint8_t CODE_FAN_ONLY_HIGH[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xE0, 0xE0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x20 };
-static const uint8_t CODE_OFF[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x05, 0xE0, 0xE0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00 };
-static const uint8_t CODE_DRY_AUTO[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0x40, 0xE0, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x5F };
-static const uint8_t CODE_DRY_LOW[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0x40, 0xE0, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x3F };
-static const uint8_t CODE_DRY_MEDIUM[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0x40, 0xE0, 0xDC, 0x00, 0x00, 0x00, 0x00, 0xBF };
-static const uint8_t CODE_DRY_HIGH[14] = { 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0x40, 0xE0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFF };
+// Frames live in codebooks/mitsubishi_ac.json and are packed into
+// mitsubishi_ac_codebook.cpp by tools/gen_codebook.py.
+static const ir_common::Codebook CODEBOOK(MITSUBISHI_AC_CODEBOOK, MITSUBISHI_AC_CODEBOOK_SIZE);
+static const size_t FRAME_LEN = 14;
+
 
 // ===============================================================
-// RAW ENCODE HELPER
+// RAW DECODE HELPERS
 // ===============================================================
-static std::vector<int32_t> encode_bytes_to_raw(const uint8_t *data, size_t len) {
-  std::vector<int32_t> raw;
-  raw.reserve(2 + len * 16 + 1);
-  raw.push_back(HEADER_PULSE_US);
-  raw.push_back(HEADER_SPACE_US);
-  for (size_t i = 0; i < len; i++) {
-    uint8_t b = data[i];
-    for (int j = 7; j >= 0; j--) {
-      raw.push_back(PULSE_DURATION_US);
-      raw.push_back(((b >> j) & 1) ? SPACE_ONE_US : SPACE_ZERO_US);
-    }
+static const int32_t HEADER_PULSE_MIN_US = 3000;
+static const int32_t HEADER_SPACE_MIN_US = 1500;
+static const uint32_t FRAME_GAP_US = 5000;  // between repeats, longer than the header space
+static const size_t MAX_FRAMES = ir_common::VOTE_MAX_FRAMES;
+
+static uint8_t reverse_bits(uint8_t b) {
+  b = (b & 0xF0) >> 4 | (b & 0x0F) << 4;
+  b = (b & 0xCC) >> 2 | (b & 0x33) << 2;
+  b = (b & 0xAA) >> 1 | (b & 0x55) << 1;
+  return b;
+}
+
+// The protocol is LSB first but frames are kept MSB first as received, so
+// the checksum (byte 13 = sum of bytes 0..12) is over bit-reversed bytes.
+static bool checksum_ok(const uint8_t *b, size_t len) {
+  uint8_t sum = 0;
+  for (size_t i = 0; i + 1 < len; i++)
+    sum += reverse_bits(b[i]);
+  return sum == reverse_bits(b[len - 1]);
+}
+
+// One segmented frame: header, FRAME_LEN bytes MSB first, final mark.
+// Uncertain bits are repaired against the checksum.
+static bool decode_frame(const int32_t *t, size_t len, uint8_t *b, ir_common::SignalQuality *quality) {
+  if (len < 3 + FRAME_LEN * 16 || abs(t[0]) <= HEADER_PULSE_MIN_US || abs(t[1]) <= HEADER_SPACE_MIN_US)
+    return false;
+  ir_common::SoftBits soft;
+  ir_common::decode_soft_bits(t, len, 3, FRAME_LEN * 8, -SPACE_ZERO_US, -SPACE_ONE_US, &soft);
+  int repaired = ir_common::repair_bits(&soft, checksum_ok);
+  if (repaired < 0) {
+    ESP_LOGD(TAG, "Frame checksum failed (%u uncertain bits)", (unsigned) soft.weak_count());
+    return false;
   }
-  raw.push_back(FINAL_PULSE_US);
-  return raw;
+  if (repaired > 0)
+    ESP_LOGD(TAG, "Repaired %d weak bit(s) using the checksum", repaired);
+  memcpy(b, soft.bytes, FRAME_LEN);
+  *quality = ir_common::measure_signal(CODING, t, len, FRAME_LEN * 8);
+  // --- verify header signature ---
+  return b[0] == 0xC4 && b[1] == 0xD3;
+}
+
+// Splits the capture on gaps and votes bit by bit across the repeats.
+// `quality` is the worst of the repeats that decoded.
+static bool decode_capture(const remote_base::RawTimings &raw, uint8_t *b, ir_common::SignalQuality *quality) {
+  ir_common::FrameSpan spans[MAX_FRAMES];
+  size_t n = ir_common::segment_frames(raw.data(), raw.size(), FRAME_GAP_US, 3 + FRAME_LEN * 16, spans, MAX_FRAMES);
+
+  ir_common::MajorityVote vote(FRAME_LEN);
+  uint8_t frame[FRAME_LEN];
+  ir_common::SignalQuality frame_quality;
+  for (size_t i = 0; i < n; i++) {
+    if (!decode_frame(raw.data() + spans[i].start, spans[i].length, frame, &frame_quality))
+      continue;
+    if (vote.count() == 0)
+      *quality = frame_quality;
+    else
+      quality->merge(frame_quality);
+    vote.add(frame, FRAME_LEN);
+  }
+  if (vote.count() == 0)
+    return false;
+  if (!vote.result(b)) {
+    // Two repeats that disagree: keep the first
+    ESP_LOGD(TAG, "Repeats disagree, using the first");
+    memcpy(b, vote.frame(0), FRAME_LEN);
+  }
+  return true;
 }
 
 // ===============================================================
 // TRANSMIT
 // ===============================================================
+// Frames are kept MSB first as received, so they are sent MSB first too
+
 void MitsubishiACClimate::transmit_hex_variable(const uint8_t *data, size_t len) {
   if (!this->transmitter_) return;
   auto call = this->transmitter_->transmit();
-  auto *raw = call.get_data();
-  raw->set_carrier_frequency(IR_FREQUENCY);
-  raw->set_data(encode_bytes_to_raw(data, len));
+  call.get_data()->set_carrier_frequency(IR_FREQUENCY);
+  ir_common::encode_line(CODING, data, len * 8, call.get_data());
   call.perform();
 }
 
@@ -93,36 +123,38 @@ void MitsubishiACClimate::setup() {
   this->mode = climate::CLIMATE_MODE_OFF;
   this->target_temperature = 25;
   this->fan_mode = climate::CLIMATE_FAN_AUTO;
+
+  // Last state from RTC (warm boot) or the delayed flash copy (cold boot)
+  this->state_store_.setup(this->get_object_id_hash() ^ ir_common::STATE_STORE_KEY);
+  ir_common::AcState restored;
+  if (this->state_store_.load(&restored))
+    restored.apply_to(this);
+  this->state_store_.attach(this);
+  this->set_interval("persist", this->state_store_.poll_interval(),
+                     [this]() { this->state_store_.commit_if_due(millis()); });
 }
 
 void MitsubishiACClimate::dump_config() {
   ESP_LOGCONFIG(TAG, "Mitsubishi A/C (Codebook TX, 22–27 °C)");
+  ESP_LOGCONFIG(TAG, "  Codebook: %u codes%s", CODEBOOK.size(), CODEBOOK.is_valid() ? "" : " (INVALID BLOB)");
+  LOG_SENSOR("  ", "Signal Quality", this->signal_quality_sensor_);
 }
 
 
 climate::ClimateTraits MitsubishiACClimate::traits() {
-  climate::ClimateTraits t;
-  t.set_supports_current_temperature(false);
-  t.set_supported_modes({
-    climate::CLIMATE_MODE_OFF,
-    climate::CLIMATE_MODE_COOL,
-    climate::CLIMATE_MODE_DRY,
-    climate::CLIMATE_MODE_FAN_ONLY
-  });
-  t.set_supported_fan_modes({
-    climate::CLIMATE_FAN_AUTO,
-    climate::CLIMATE_FAN_LOW,
-    climate::CLIMATE_FAN_MEDIUM,
-    climate::CLIMATE_FAN_HIGH
-  });
-  t.set_visual_min_temperature(22);
-  t.set_visual_max_temperature(27);
-  t.set_visual_temperature_step(1);
-  return t;
+  // Modes, fans and range come from YAML (supported_modes, ...); built once
+  return this->cached_traits_(false);
 }
 
 
+static ir_common::AllocSite CONTROL_SITE{"mitsubishi_ac.control"};
+static ir_common::BudgetSite CONTROL_BUDGET{"mitsubishi_ac.control"};
+static ir_common::AllocSite RECEIVE_SITE{"mitsubishi_ac.on_receive"};
+static ir_common::BudgetSite RECEIVE_BUDGET{"mitsubishi_ac.on_receive"};
+
 void MitsubishiACClimate::control(const climate::ClimateCall &call) {
+  ir_common::AllocGuard alloc_guard(CONTROL_SITE);
+  ir_common::BudgetGuard budget_guard(CONTROL_BUDGET);
   if (call.get_mode().has_value())
     this->mode = *call.get_mode();
   if (call.get_target_temperature().has_value())
@@ -130,91 +162,45 @@ void MitsubishiACClimate::control(const climate::ClimateCall &call) {
   if (call.get_fan_mode().has_value())
     this->fan_mode = *call.get_fan_mode();
 
-  const uint8_t *code = CODE_OFF;  // default
-  int t = (int)this->target_temperature;
+  // The codebook has whole degrees only
+  auto state = ir_common::AcState::from_climate(*this).with_temperature((int) this->target_temperature);
+  auto fan_auto = state.with_fan(climate::CLIMATE_FAN_AUTO);
+  ir_common::CodebookRecord record;
+  bool found;
 
   // ===============================================================
-  // COOL MODE
+  // COOL MODE  (unknown temperature -> 25 °C, unknown fan -> 25 °C AUTO)
   // ===============================================================
   if (this->mode == climate::CLIMATE_MODE_COOL) {
-    if (this->fan_mode == climate::CLIMATE_FAN_AUTO) {
-      switch (t) {
-        case 22: code = CODE_COOL_22_AUTO; break;
-        case 23: code = CODE_COOL_23_AUTO; break;
-        case 24: code = CODE_COOL_24_AUTO; break;
-        case 25: code = CODE_COOL_25_AUTO; break;
-        case 26: code = CODE_COOL_26_AUTO; break;
-        case 27: code = CODE_COOL_27_AUTO; break;
-        default: code = CODE_COOL_25_AUTO; break;
-      }
-    } else if (this->fan_mode == climate::CLIMATE_FAN_LOW) {
-      switch (t) {
-        case 22: code = CODE_COOL_22_LOW; break;
-        case 23: code = CODE_COOL_23_LOW; break;
-        case 24: code = CODE_COOL_24_LOW; break;
-        case 25: code = CODE_COOL_25_LOW; break;
-        case 26: code = CODE_COOL_26_LOW; break;
-        case 27: code = CODE_COOL_27_LOW; break;
-        default: code = CODE_COOL_25_LOW; break;
-      }
-    } else if (this->fan_mode == climate::CLIMATE_FAN_MEDIUM) {
-      switch (t) {
-        case 22: code = CODE_COOL_22_MEDIUM; break;
-        case 23: code = CODE_COOL_23_MEDIUM; break;
-        case 24: code = CODE_COOL_24_MEDIUM; break;
-        case 25: code = CODE_COOL_25_MEDIUM; break;
-        case 26: code = CODE_COOL_26_MEDIUM; break;
-        case 27: code = CODE_COOL_27_MEDIUM; break;
-        default: code = CODE_COOL_25_MEDIUM; break;
-      }
-    } else if (this->fan_mode == climate::CLIMATE_FAN_HIGH) {
-      switch (t) {
-        case 22: code = CODE_COOL_22_HIGH; break;
-        case 23: code = CODE_COOL_23_HIGH; break;
-        case 24: code = CODE_COOL_24_HIGH; break;
-        case 25: code = CODE_COOL_25_HIGH; break;
-        case 26: code = CODE_COOL_26_HIGH; break;
-        case 27: code = CODE_COOL_27_HIGH; break;
-        default: code = CODE_COOL_25_HIGH; break;
-      }
-    } else {
-      code = CODE_COOL_25_AUTO;
-    }
-
-  // ===============================================================
-  // DRY MODE
-  // ===============================================================
-  } else if (this->mode == climate::CLIMATE_MODE_DRY) {
-    if (this->fan_mode == climate::CLIMATE_FAN_LOW)
-      code = CODE_DRY_LOW;
-    else if (this->fan_mode == climate::CLIMATE_FAN_MEDIUM)
-      code = CODE_DRY_MEDIUM;
-    else if (this->fan_mode == climate::CLIMATE_FAN_HIGH)
-      code = CODE_DRY_HIGH;
-    else
-      code = CODE_DRY_AUTO;
+    found = CODEBOOK.find_first({state.packed(),
+                                 state.with_temperature(25).packed(),
+                                 fan_auto.with_temperature(25).packed()},
+                                &record);
 
   // ===============================================================
-  // FAN ONLY MODE
+  // DRY / FAN ONLY MODE  (unknown fan -> AUTO)
   // ===============================================================
-  } else if (this->mode == climate::CLIMATE_MODE_FAN_ONLY) {
-    if (this->fan_mode == climate::CLIMATE_FAN_LOW)
-      code = CODE_FAN_ONLY_LOW;
-    else if (this->fan_mode == climate::CLIMATE_FAN_MEDIUM)
-      code = CODE_FAN_ONLY_MEDIUM;
-    else if (this->fan_mode == climate::CLIMATE_FAN_HIGH)
-      code = CODE_FAN_ONLY_HIGH;
-    else
-      code = CODE_FAN_ONLY_AUTO;
+  } else if (this->mode == climate::CLIMATE_MODE_DRY || this->mode == climate::CLIMATE_MODE_FAN_ONLY) {
+    found = CODEBOOK.find_first({state.with_temperature(0).packed(),
+                                 fan_auto.with_temperature(0).packed()},
+                                &record);
 
   // ===============================================================
   // OFF
   // ===============================================================
   } else {
-    code = CODE_OFF;
+    found = CODEBOOK.find(ir_common::AcState(climate::CLIMATE_MODE_OFF, ir_common::CODEBOOK_ANY, 0).packed(),
+                          &record);
   }
 
-  this->transmit_hex_variable(code, 14);
+  uint8_t code[FRAME_LEN];
+  if (!found || ir_common::Codebook::read_bytes(record, code, FRAME_LEN) != FRAME_LEN) {
+    ESP_LOGW(TAG, "No codebook frame for the current state");
+    this->publish_state();
+    return;
+  }
+
+  this->transmit_hex_variable(code, FRAME_LEN);
   this->publish_state();
 }
 // ===============================================================
@@ -222,74 +208,62 @@ void MitsubishiACClimate::control(const climate::ClimateCall &call) {
 // ===============================================================
 
 bool MitsubishiACClimate::on_receive(remote_base::RemoteReceiveData data) {
-  if (data.size() < 64) return false;
-
-  uint8_t b[14] = {0};
-  int bit_index = 0;
-  size_t start = 0;
-
-  // --- find header ---
-  for (size_t i = 0; i + 1 < data.size(); i++) {
-    if (abs(data[i]) > 3000 && abs(data[i + 1]) > 1500) {
-      start = i + 2;
-      break;
-    }
-  }
-
-  // --- decode bits ---
-  for (size_t i = start; i + 1 < data.size(); i += 2) {
-    int32_t sp = abs(data[i + 1]);
-    bool bit = (sp >= SPACE_ONE_MIN_US);
-    size_t byte_idx = bit_index / 8;
-    if (byte_idx >= 14) break;
-    b[byte_idx] = (b[byte_idx] << 1) | (bit ? 1 : 0);
-    bit_index++;
-  }
-
-  // --- verify header signature ---
-  if (!(b[0] == 0xC4 && b[1] == 0xD3))
+  ir_common::AllocGuard alloc_guard(RECEIVE_SITE);
+  ir_common::BudgetGuard budget_guard(RECEIVE_BUDGET);
+  uint8_t b[FRAME_LEN] = {0};
+  ir_common::SignalQuality quality;
+  if (!decode_capture(data.get_raw_data(), b, &quality))
     return false;
+  ESP_LOGD(TAG, "Signal quality %u%% (bit margin %uus, mark error %uus, header error %uus)", quality.score,
+           quality.bit_margin_us, quality.fixed_error_us, quality.header_error_us);
+  if (this->signal_quality_sensor_ != nullptr)
+    this->signal_quality_sensor_->publish_state(quality.score);
 
   // --- OFF ---
+  // Repeats of the current state are not published again
   if (b[5] == 0x05) {
-    this->mode = climate::CLIMATE_MODE_OFF;
-    this->publish_state();
+    if (ir_common::AcState(climate::CLIMATE_MODE_OFF, ir_common::CODEBOOK_ANY, 0).apply_to(this))
+      this->publish_state();
     return true;
   }
 
   // --- Mode detection ---
+  uint8_t mode = this->mode;
   if (b[6] == 0xC0)
-    this->mode = climate::CLIMATE_MODE_COOL;
+    mode = climate::CLIMATE_MODE_COOL;
   else if (b[6] == 0x40)
-    this->mode = climate::CLIMATE_MODE_DRY;
+    mode = climate::CLIMATE_MODE_DRY;
   else if (b[6] == 0xE0)
-    this->mode = climate::CLIMATE_MODE_FAN_ONLY;
+    mode = climate::CLIMATE_MODE_FAN_ONLY;
 
   // --- Temperature detection (for COOL mode only) ---
-  if (this->mode == climate::CLIMATE_MODE_COOL) {
+  float temperature = 0;
+  if (mode == climate::CLIMATE_MODE_COOL) {
     switch (b[7]) {
-      case 0x90: this->target_temperature = 22; break;
-      case 0x10: this->target_temperature = 23; break;
-      case 0xE0: this->target_temperature = 24; break;
-      case 0x60: this->target_temperature = 25; break;
-      case 0xA0: this->target_temperature = 26; break;
-      case 0x20: this->target_temperature = 27; break;
-      default: this->target_temperature = 25; break;
+      case 0x90: temperature = 22; break;
+      case 0x10: temperature = 23; break;
+      case 0xE0: temperature = 24; break;
+      case 0x60: temperature = 25; break;
+      case 0xA0: temperature = 26; break;
+      case 0x20: temperature = 27; break;
+      default: temperature = 25; break;
     }
   }
 
   // --- Fan speed detection ---
   uint8_t fan_byte = b[8];
+  uint8_t fan;
   if ((fan_byte & 0x40) == 0x40)
-    this->fan_mode = climate::CLIMATE_FAN_LOW;
+    fan = climate::CLIMATE_FAN_LOW;
   else if ((fan_byte & 0xDC) == 0xDC)
-    this->fan_mode = climate::CLIMATE_FAN_MEDIUM;
+    fan = climate::CLIMATE_FAN_MEDIUM;
   else if ((fan_byte & 0xBC) == 0xBC)
-    this->fan_mode = climate::CLIMATE_FAN_HIGH;
+    fan = climate::CLIMATE_FAN_HIGH;
   else
-    this->fan_mode = climate::CLIMATE_FAN_AUTO;
+    fan = climate::CLIMATE_FAN_AUTO;
 
-  this->publish_state();
+  if (ir_common::AcState(mode, fan, temperature).apply_to(this))
+    this->publish_state();
   return true;
 }
 
@@ -6,6 +6,16 @@
 #include "esphome/components/sensor/sensor.h"
 #include "esphome/components/remote_receiver/remote_receiver.h"
 #include "esphome/core/log.h"
+#include "esphome/components/ir_common/configured_traits.h"
+#include "esphome/components/ir_common/ac_state.h"
+#include "esphome/components/ir_common/alloc_stats.h"
+#include "esphome/components/ir_common/loop_budget.h"
+#include "esphome/components/ir_common/codebook.h"
+#include "esphome/components/ir_common/frame_segmenter.h"
+#include "esphome/components/ir_common/line_coding.h"
+#include "esphome/components/ir_common/soft_bits.h"
+#include "esphome/components/ir_common/state_store.h"
+#include "esphome/components/ir_common/signal_quality.h"
 
 #include <array>
 #include <vector>
@@ -20,7 +30,8 @@ namespace mitsubishi_ac {
 
 class MitsubishiACClimate : public climate::Climate,
                             public Component,
-                            public remote_base::RemoteReceiverListener {
+                            public remote_base::RemoteReceiverListener,
+                            public ir_common::ConfiguredTraits {
  public:
   // ===== Lifecycle =====
   void setup() override;
@@ -34,15 +45,18 @@ class MitsubishiACClimate : public climate::Climate,
     this->transmitter_ = transmitter;
   }
   void set_sensor(sensor::Sensor *sensor) { this->sensor_ = sensor; }
+  void set_flash_write_delay(uint32_t delay) { this->state_store_.set_flash_delay(delay); }
+  void set_signal_quality_sensor(sensor::Sensor *sensor) { this->signal_quality_sensor_ = sensor; }
 
  protected:
   // ===== Helpers =====
   void transmit_hex_variable(const uint8_t *data, size_t len);
-  void transmit_raw_code_(const int32_t *data, size_t len);
 
   // ===== Internal State =====
   remote_transmitter::RemoteTransmitterComponent *transmitter_{nullptr};
   sensor::Sensor *sensor_{nullptr};
+  sensor::Sensor *signal_quality_sensor_{nullptr};
+  ir_common::StateStore state_store_;
 
   // Future extension fields
   int swing_level_{0};   // vertical vane level (0–5)
@@ -0,0 +1,66 @@
+// Generated by tools/gen_codebook.py from codebooks/mitsubishi_ac.json -- do not edit.
+// 33 codes, 826 bytes.
+#include "mitsubishi_ac_codebook.h"
+#include "esphome/core/hal.h"
+
+namespace esphome {
+namespace mitsubishi_ac {
+
+const uint8_t MITSUBISHI_AC_CODEBOOK[] PROGMEM = {
+    0x49, 0x52, 0x43, 0x42, 0x01, 0x01, 0x21, 0x00, 0x09, 0x00, 0x18, 0x00, 0x26, 0x00, 0x0E, 0x00,
+    0x02, 0x00, 0x2E, 0x00, 0x04, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x7B, 0x00, 0x51, 0x00,
+    0xBB, 0x08, 0x02, 0x02, 0x36, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25,
+    0xC0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x05, 0x04, 0x00, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0x40, 0xE0, 0xDC, 0x00, 0x00, 0x00, 0x00, 0xBF,
+    0x00, 0x00, 0x02, 0x03, 0x30, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25,
+    0xC0, 0xE0, 0x40, 0x00, 0x00, 0x00, 0x00, 0xA3, 0x00, 0x00, 0x02, 0x05, 0x36, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0x20, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xBF,
+    0x00, 0x00, 0x02, 0x03, 0x32, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25,
+    0xC0, 0x60, 0x40, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x02, 0x05, 0x30, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0xE0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x04, 0x32, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25,
+    0xC0, 0x60, 0xDC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x02, 0x04, 0x36, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0x20, 0xDC, 0x00, 0x00, 0x00, 0x00, 0xDF,
+    0x00, 0x00, 0x02, 0x04, 0x30, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25,
+    0xC0, 0xE0, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x02, 0x32, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+    0x00, 0x00, 0x02, 0x02, 0x34, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25,
+    0xC0, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x05, 0x05, 0x00, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0x40, 0xE0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x02, 0x04, 0x2C, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25,
+    0xC0, 0x90, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x2C, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3,
+    0x00, 0x00, 0x02, 0x05, 0x34, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25,
+    0xC0, 0xA0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x02, 0x04, 0x2E, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0x10, 0xDC, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x02, 0x05, 0x2C, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25,
+    0xC0, 0x90, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x05, 0xE0, 0xE0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x05, 0x32, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25,
+    0xC0, 0x60, 0xBC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0x05, 0x2E, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0x10, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x05, 0x02, 0x00, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25,
+    0x40, 0xE0, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x04, 0x05, 0x00, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xE0, 0xE0, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x02, 0x03, 0x2E, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25,
+    0xC0, 0x10, 0x40, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x02, 0x02, 0x2E, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x02, 0x02, 0x30, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25,
+    0xC0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x02, 0x03, 0x36, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xC0, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00, 0x43,
+    0x00, 0x00, 0x05, 0x03, 0x00, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25,
+    0x40, 0xE0, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x04, 0x04, 0x00, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xE0, 0xE0, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x02, 0x03, 0x34, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25,
+    0xC0, 0xA0, 0x40, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x04, 0x02, 0x00, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xE0, 0xE0, 0x1C, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x02, 0x04, 0x34, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25,
+    0xC0, 0xA0, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x04, 0x03, 0x00, 0xFF, 0x0E, 0x00,
+    0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25, 0xE0, 0xE0, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x02, 0x03, 0x2C, 0xFF, 0x0E, 0x00, 0x00, 0x00, 0xC4, 0xD3, 0x64, 0x80, 0x00, 0x25,
+    0xC0, 0x90, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x00, 0x00,
+};
+const size_t MITSUBISHI_AC_CODEBOOK_SIZE = sizeof(MITSUBISHI_AC_CODEBOOK);
+
+}  // namespace mitsubishi_ac
+}  // namespace esphome
@@ -0,0 +1,15 @@
+#pragma once
+
+// Generated by tools/gen_codebook.py from codebooks/mitsubishi_ac.json -- do not edit.
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace mitsubishi_ac {
+
+extern const uint8_t MITSUBISHI_AC_CODEBOOK[];
+extern const size_t MITSUBISHI_AC_CODEBOOK_SIZE;
+
+}  // namespace mitsubishi_ac
+}  // namespace esphome
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "esphome/core/automation.h"
+#include "raw_ac.h"
+#include <string>
+
+namespace esphome {
+namespace raw_ac {
+
+// raw_ac.learn: capture the next frame from the physical remote for a state
+template<typename... Ts> class LearnAction : public Action<Ts...>, public Parented<RawACClimate> {
+ public:
+  TEMPLATABLE_VALUE(std::string, mode)
+  TEMPLATABLE_VALUE(std::string, fan_mode)
+  TEMPLATABLE_VALUE(float, target_temperature)
+
+  void play(Ts... x) override {
+    this->parent_->start_learning(this->mode_.value(x...), this->fan_mode_.value(x...),
+                                  this->target_temperature_.value(x...));
+  }
+};
+
+// raw_ac.clear_learned: forget every learned code
+template<typename... Ts> class ClearLearnedAction : public Action<Ts...>, public Parented<RawACClimate> {
+ public:
+  void play(Ts... x) override { this->parent_->clear_learned(); }
+};
+
+}  // namespace raw_ac
+}  // namespace esphome
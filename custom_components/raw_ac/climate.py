@@ -1,34 +1,69 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
-from esphome.components import climate, remote_transmitter, sensor
+from esphome import automation
+from esphome.components import climate, remote_transmitter, sensor, remote_receiver, remote_base
+from esphome.components import ir_common
 from esphome.const import (
+    CONF_FAN_MODE,
     CONF_ID,
+    CONF_MODE,
     CONF_SENSOR,  # Keep this import
+    CONF_TARGET_TEMPERATURE,
 )
 
+CONF_RECEIVER_ID = "receiver_id"
+CONF_LEARN_SLOTS = "learn_slots"
+CONF_LEARN_TIMEOUT = "learn_timeout"
+
+AUTO_LOAD = ["ir_common"]
+
 # ... (namespace and class definitions are the same) ...
 raw_ac_ns = cg.esphome_ns.namespace("raw_ac")
 RawACClimate = raw_ac_ns.class_(
-    "RawACClimate", climate.Climate, cg.Component
+    "RawACClimate", climate.Climate, cg.Component, remote_base.RemoteReceiverListener
 )
+LearnAction = raw_ac_ns.class_("LearnAction", automation.Action)
+ClearLearnedAction = raw_ac_ns.class_("ClearLearnedAction", automation.Action)
 
 
+# The built-in codebook's states (learned codes add theirs at runtime);
+# YAML may narrow them to what the unit has
+TRAITS_SCHEMA = ir_common.traits_schema(
+    ["OFF", "COOL", "FAN_ONLY"],
+    ["AUTO", "LOW", "MEDIUM", "HIGH"],
+    (16, 30),
+    default_range=(22, 27),
+)
+
 # Use the new climate_schema function
-CONFIG_SCHEMA = climate.climate_schema(RawACClimate).extend(
-    {
-        # Keep your existing keys inside here
-        cv.Required(remote_transmitter.CONF_TRANSMITTER_ID): cv.use_id(
-            remote_transmitter.RemoteTransmitterComponent
-        ),
-        cv.Optional(CONF_SENSOR): cv.use_id(sensor.Sensor),
-    }
-).extend(cv.COMPONENT_SCHEMA)
+CONFIG_SCHEMA = cv.All(
+    climate.climate_schema(RawACClimate).extend(
+        {
+            # Keep your existing keys inside here
+            cv.Required(remote_transmitter.CONF_TRANSMITTER_ID): cv.use_id(
+                remote_transmitter.RemoteTransmitterComponent
+            ),
+            cv.Optional(CONF_SENSOR): cv.use_id(sensor.Sensor),
+            # Learning mode: frames from the physical remote arrive through this receiver
+            cv.Optional(CONF_RECEIVER_ID): cv.use_id(
+                remote_receiver.RemoteReceiverComponent
+            ),
+            # Each slot is one 84-byte frame in flash; ESP8266 flash preferences
+            # hold about 512 bytes in total, so keep this small there.
+            cv.Optional(CONF_LEARN_SLOTS, default=4): cv.int_range(min=1, max=16),
+            cv.Optional(CONF_LEARN_TIMEOUT, default="30s"): cv.positive_time_period_milliseconds,
+        }
+    ).extend(ir_common.PUBLISH_GATE_SCHEMA).extend(TRAITS_SCHEMA).extend(ir_common.STATE_STORE_SCHEMA).extend(cv.COMPONENT_SCHEMA),
+    ir_common.validate_temperature_range,
+)
 
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     
     await cg.register_component(var, config)
     await climate.register_climate(var, config)
+    await ir_common.traits_to_code(var, config)
+    await ir_common.state_store_to_code(var, config)
 
     transmitter = await cg.get_variable(config[remote_transmitter.CONF_TRANSMITTER_ID])
     cg.add(var.set_transmitter(transmitter))
@@ -37,4 +72,51 @@ async def to_code(config):
     # This only adds the sensor to C++ if it exists in the YAML
     if CONF_SENSOR in config:
         sens = await cg.get_variable(config[CONF_SENSOR])
-        cg.add(var.set_sensor(sens))
\ No newline at end of file
+        cg.add(var.set_sensor(sens))
+    await ir_common.publish_gate_to_code(var, config)
+
+    if CONF_RECEIVER_ID in config:
+        receiver = await cg.get_variable(config[CONF_RECEIVER_ID])
+        cg.add(receiver.register_listener(var))
+        cg.add(var.set_receiver(receiver))
+    cg.add(var.set_learn_slots(config[CONF_LEARN_SLOTS]))
+    cg.add(var.set_learn_timeout(config[CONF_LEARN_TIMEOUT]))
+
+
+# ======================================================================
+# ===                            ACTIONS                             ===
+# ======================================================================
+# Names are the codebook/ESPHome enum names, e.g. mode: COOL, fan_mode: LOW.
+# Templatable, so an `api: actions:` entry can pass them straight through.
+RAW_AC_LEARN_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.use_id(RawACClimate),
+        cv.Required(CONF_MODE): cv.templatable(cv.string),
+        cv.Optional(CONF_FAN_MODE, default="AUTO"): cv.templatable(cv.string),
+        cv.Optional(CONF_TARGET_TEMPERATURE, default=0): cv.templatable(cv.float_),
+    }
+)
+
+
+@automation.register_action("raw_ac.learn", LearnAction, RAW_AC_LEARN_SCHEMA)
+async def raw_ac_learn_to_code(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    mode = await cg.templatable(config[CONF_MODE], args, cg.std_string)
+    cg.add(var.set_mode(mode))
+    fan_mode = await cg.templatable(config[CONF_FAN_MODE], args, cg.std_string)
+    cg.add(var.set_fan_mode(fan_mode))
+    temperature = await cg.templatable(config[CONF_TARGET_TEMPERATURE], args, cg.float_)
+    cg.add(var.set_target_temperature(temperature))
+    return var
+
+
+@automation.register_action(
+    "raw_ac.clear_learned",
+    ClearLearnedAction,
+    automation.maybe_simple_id({cv.GenerateID(): cv.use_id(RawACClimate)}),
+)
+async def raw_ac_clear_learned_to_code(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    return var
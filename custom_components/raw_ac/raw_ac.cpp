@@ -1,6 +1,8 @@
 #include "raw_ac.h"
+#include "raw_ac_codebook.h"
+#include "esphome/core/hal.h"
 #include "esphome/core/log.h"
-#include <vector> // Required for sending raw codes
+#include <algorithm>
 
 namespace esphome {
 namespace raw_ac {
@@ -8,119 +10,296 @@ namespace raw_ac {
 static const char *const TAG = "raw_ac.climate";
 
 // ======================================================================
-// ===                PASTE YOUR "CODE BOOK" HERE                     ===
+// ===                          CODE BOOK                             ===
 // ======================================================================
-// IMPORTANT: You MUST define all the variables you use below.
-// The placeholders below WILL cause errors until you replace them.
-
-const uint32_t IR_FREQUENCY = 38000; // 38kHz. Change if yours is different.
-
-static const int32_t CODE_OFF[] = {3463, -1704, 442, -1278, 422, -1297, 422, -443, 423, -441, 424, -438, 443, -1282, 423, -443, 423, -441, 443, -1277, 423, -1295, 442, -421, 423, -1295, 427, -437, 443, -424, 422, -1298, 442, -1255, 449, -437, 423, -1274, 466, -1280, 441, -424, 423, -441, 443, -1282, 422, -438, 444, -423, 423, -1275, 443, -438, 443, -404, 467, -419, 445, -421, 443, -422, 525, -343, 424, -441, 445, -421, 447, -420, 445, -421, 424, -438, 424, -441, 423, -441, 443, -401, 446, -438, 444, -421, 443, -421, 444, -425, 424, -440, 424, -438, 424, -1295, 422, -422, 464, -1280, 444, -1276, 446, -1279, 568, -301, 421, -439, 423, -439, 443, -403, 470, -417, 444, -422, 423, -439, 424, -1275, 467, -1281, 423, -438, 424, -443, 443, -423, 424, -441, 443, -421, 423, -441, 443, -421, 444, -420, 425, -442, 424, -438, 424, -443, 443, -423, 423, -439, 444, -423, 423, -441, 443, -422, 443, -421, 443, -426, 423, -441, 423, -439, 423, -417, 469, -421, 442, -425, 445, -420, 444, -420, 445, -420, 445, -426, 422, -445, 440, -423, 447, -420, 444, -423, 422, -440, 423, -440, 424, -441, 443, -424, 423, -416, 446, -441, 443, -421, 447, -422, 424, -419, 445, -439, 423, -439, 444, -422, 424, -440, 444, -421, 444, -424, 445, -1276, 442, -1282, 443, -1279, 423, -1300, 441, -1257, 445, -441, 421, -1295, 446};
-static const int32_t CODE_COOL_22_AUTO[] = {3437, -1727, 446, -1278, 420, -1297, 421, -445, 427, -438, 423, -437, 443, -1281, 423, -445, 423, -439, 444, -1277, 422, -1271, 467, -422, 424, -1294, 423, -438, 449, -421, 423, -1271, 468, -1279, 418, -447, 420, -1299, 439, -1257, 446, -444, 420, -444, 423, -1277, 445, -442, 422, -441, 423, -1301, 419, -436, 444, -427, 423, -441, 424, -438, 447, -417, 447, -424, 424, -441, 444, -422, 448, -422, 422, -441, 424, -441, 423, -441, 423, -439, 444, -424, 424, -439, 423, -439, 444, -421, 443, -1280, 424, -443, 423, -439, 444, -1284, 419, -441, 423, -1297, 423, -1298, 442, -1259, 447, -436, 424, -443, 423, -441, 444, -420, 444, -427, 423, -441, 424, -440, 425, -1294, 423, -1297, 422, -437, 445, -419, 444, -420, 424, -442, 424, -439, 424, -440, 423, -441, 424, -440, 424, -441, 423, -441, 424, -438, 444, -425, 423, -439, 424, -438, 448, -416, 447, -422, 424, -443, 423, -437, 423, -416, 468, -421, 424, -441, 423, -439, 423, -437, 423, -441, 423, -441, 424, -443, 423, -439, 444, -420, 444, -423, 446, -418, 447, -424, 424, -438, 424, -436, 444, -427, 423, -441, 424, -438, 446, -421, 424, -436, 445, -423, 440, -421, 423, -443, 424, -440, 444, -421, 423, -446, 423, -439, 444, -420, 423, -1298, 422, -441, 424, -440, 424, -441, 423, -441, 423, -1299, 422, -1298, 423};
-static const int32_t CODE_COOL_23_AUTO[]    = {3437, -1727, 446, -1278, 420, -1297, 421, -445, 427, -438, 423, -437, 443, -1281, 423, -445, 423, -439, 444, -1277, 422, -1271, 467, -422, 424, -1294, 423, -438, 449, -421, 423, -1271, 468, -1279, 418, -447, 420, -1299, 439, -1257, 446, -444, 420, -444, 423, -1277, 445, -442, 422, -441, 423, -1301, 419, -436, 444, -427, 423, -441, 424, -438, 447, -417, 447, -424, 424, -441, 444, -422, 448, -422, 422, -441, 424, -441, 423, -441, 423, -439, 444, -424, 424, -439, 423, -439, 444, -421, 443, -1280, 424, -443, 423, -439, 444, -1284, 419, -441, 423, -1297, 423, -1298, 442, -1259, 447, -436, 424, -443, 423, -441, 444, -420, 444, -427, 423, -441, 424, -440, 425, -1294, 423, -1297, 422, -437, 445, -419, 444, -420, 424, -442, 424, -439, 424, -440, 423, -441, 424, -440, 424, -441, 423, -441, 424, -438, 444, -425, 423, -439, 424, -438, 448, -416, 447, -422, 424, -443, 423, -437, 423, -416, 468, -421, 424, -441, 423, -439, 423, -437, 423, -441, 423, -441, 424, -443, 423, -439, 444, -420, 444, -423, 446, -418, 447, -424, 424, -438, 424, -436, 444, -427, 423, -441, 424, -438, 446, -421, 424, -436, 445, -423, 440, -421, 423, -443, 424, -440, 444, -421, 423, -446, 423, -439, 444, -420, 423, -1298, 422, -441, 424, -440, 424, -441, 423, -441, 423, -1299, 422, -1298, 423}; 
-static const int32_t CODE_COOL_24_AUTO[]    = {3437, -1727, 446, -1278, 420, -1297, 421, -445, 427, -438, 423, -437, 443, -1281, 423, -445, 423, -439, 444, -1277, 422, -1271, 467, -422, 424, -1294, 423, -438, 449, -421, 423, -1271, 468, -1279, 418, -447, 420, -1299, 439, -1257, 446, -444, 420, -444, 423, -1277, 445, -442, 422, -441, 423, -1301, 419, -436, 444, -427, 423, -441, 424, -438, 447, -417, 447, -424, 424, -441, 444, -422, 448, -422, 422, -441, 424, -441, 423, -441, 423, -439, 444, -424, 424, -439, 423, -439, 444, -421, 443, -1280, 424, -443, 423, -439, 444, -1284, 419, -441, 423, -1297, 423, -1298, 442, -1259, 447, -436, 424, -443, 423, -441, 444, -420, 444, -427, 423, -441, 424, -440, 425, -1294, 423, -1297, 422, -437, 445, -419, 444, -420, 424, -442, 424, -439, 424, -440, 423, -441, 424, -440, 424, -441, 423, -441, 424, -438, 444, -425, 423, -439, 424, -438, 448, -416, 447, -422, 424, -443, 423, -437, 423, -416, 468, -421, 424, -441, 423, -439, 423, -437, 423, -441, 423, -441, 424, -443, 423, -439, 444, -420, 444, -423, 446, -418, 447, -424, 424, -438, 424, -436, 444, -427, 423, -441, 424, -438, 446, -421, 424, -436, 445, -423, 440, -421, 423, -443, 424, -440, 444, -421, 423, -446, 423, -439, 444, -420, 423, -1298, 422, -441, 424, -440, 424, -441, 423, -441, 423, -1299, 422, -1298, 423};          
-static const int32_t CODE_COOL_25_AUTO[]    = {3437, -1727, 446, -1278, 420, -1297, 421, -445, 427, -438, 423, -437, 443, -1281, 423, -445, 423, -439, 444, -1277, 422, -1271, 467, -422, 424, -1294, 423, -438, 449, -421, 423, -1271, 468, -1279, 418, -447, 420, -1299, 439, -1257, 446, -444, 420, -444, 423, -1277, 445, -442, 422, -441, 423, -1301, 419, -436, 444, -427, 423, -441, 424, -438, 447, -417, 447, -424, 424, -441, 444, -422, 448, -422, 422, -441, 424, -441, 423, -441, 423, -439, 444, -424, 424, -439, 423, -439, 444, -421, 443, -1280, 424, -443, 423, -439, 444, -1284, 419, -441, 423, -1297, 423, -1298, 442, -1259, 447, -436, 424, -443, 423, -441, 444, -420, 444, -427, 423, -441, 424, -440, 425, -1294, 423, -1297, 422, -437, 445, -419, 444, -420, 424, -442, 424, -439, 424, -440, 423, -441, 424, -440, 424, -441, 423, -441, 424, -438, 444, -425, 423, -439, 424, -438, 448, -416, 447, -422, 424, -443, 423, -437, 423, -416, 468, -421, 424, -441, 423, -439, 423, -437, 423, -441, 423, -441, 424, -443, 423, -439, 444, -420, 444, -423, 446, -418, 447, -424, 424, -438, 424, -436, 444, -427, 423, -441, 424, -438, 446, -421, 424, -436, 445, -423, 440, -421, 423, -443, 424, -440, 444, -421, 423, -446, 423, -439, 444, -420, 423, -1298, 422, -441, 424, -440, 424, -441, 423, -441, 423, -1299, 422, -1298, 423};
-static const int32_t CODE_COOL_26_AUTO[]    = {3437, -1727, 446, -1278, 420, -1297, 421, -445, 427, -438, 423, -437, 443, -1281, 423, -445, 423, -439, 444, -1277, 422, -1271, 467, -422, 424, -1294, 423, -438, 449, -421, 423, -1271, 468, -1279, 418, -447, 420, -1299, 439, -1257, 446, -444, 420, -444, 423, -1277, 445, -442, 422, -441, 423, -1301, 419, -436, 444, -427, 423, -441, 424, -438, 447, -417, 447, -424, 424, -441, 444, -422, 448, -422, 422, -441, 424, -441, 423, -441, 423, -439, 444, -424, 424, -439, 423, -439, 444, -421, 443, -1280, 424, -443, 423, -439, 444, -1284, 419, -441, 423, -1297, 423, -1298, 442, -1259, 447, -436, 424, -443, 423, -441, 444, -420, 444, -427, 423, -441, 424, -440, 425, -1294, 423, -1297, 422, -437, 445, -419, 444, -420, 424, -442, 424, -439, 424, -440, 423, -441, 424, -440, 424, -441, 423, -441, 424, -438, 444, -425, 423, -439, 424, -438, 448, -416, 447, -422, 424, -443, 423, -437, 423, -416, 468, -421, 424, -441, 423, -439, 423, -437, 423, -441, 423, -441, 424, -443, 423, -439, 444, -420, 444, -423, 446, -418, 447, -424, 424, -438, 424, -436, 444, -427, 423, -441, 424, -438, 446, -421, 424, -436, 445, -423, 440, -421, 423, -443, 424, -440, 444, -421, 423, -446, 423, -439, 444, -420, 423, -1298, 422, -441, 424, -440, 424, -441, 423, -441, 423, -1299, 422, -1298, 423};
-static const int32_t CODE_COOL_27_AUTO[]    = {3437, -1727, 446, -1278, 420, -1297, 421, -445, 427, -438, 423, -437, 443, -1281, 423, -445, 423, -439, 444, -1277, 422, -1271, 467, -422, 424, -1294, 423, -438, 449, -421, 423, -1271, 468, -1279, 418, -447, 420, -1299, 439, -1257, 446, -444, 420, -444, 423, -1277, 445, -442, 422, -441, 423, -1301, 419, -436, 444, -427, 423, -441, 424, -438, 447, -417, 447, -424, 424, -441, 444, -422, 448, -422, 422, -441, 424, -441, 423, -441, 423, -439, 444, -424, 424, -439, 423, -439, 444, -421, 443, -1280, 424, -443, 423, -439, 444, -1284, 419, -441, 423, -1297, 423, -1298, 442, -1259, 447, -436, 424, -443, 423, -441, 444, -420, 444, -427, 423, -441, 424, -440, 425, -1294, 423, -1297, 422, -437, 445, -419, 444, -420, 424, -442, 424, -439, 424, -440, 423, -441, 424, -440, 424, -441, 423, -441, 424, -438, 444, -425, 423, -439, 424, -438, 448, -416, 447, -422, 424, -443, 423, -437, 423, -416, 468, -421, 424, -441, 423, -439, 423, -437, 423, -441, 423, -441, 424, -443, 423, -439, 444, -420, 444, -423, 446, -418, 447, -424, 424, -438, 424, -436, 444, -427, 423, -441, 424, -438, 446, -421, 424, -436, 445, -423, 440, -421, 423, -443, 424, -440, 444, -421, 423, -446, 423, -439, 444, -420, 423, -1298, 422, -441, 424, -440, 424, -441, 423, -441, 423, -1299, 422, -1298, 423};
-static const int32_t CODE_COOL_22_LOW[]     = {3437, -1727, 446, -1278, 420, -1297, 421, -445, 427, -438, 423, -437, 443, -1281, 423, -445, 423, -439, 444, -1277, 422, -1271, 467, -422, 424, -1294, 423, -438, 449, -421, 423, -1271, 468, -1279, 418, -447, 420, -1299, 439, -1257, 446, -444, 420, -444, 423, -1277, 445, -442, 422, -441, 423, -1301, 419, -436, 444, -427, 423, -441, 424, -438, 447, -417, 447, -424, 424, -441, 444, -422, 448, -422, 422, -441, 424, -441, 423, -441, 423, -439, 444, -424, 424, -439, 423, -439, 444, -421, 443, -1280, 424, -443, 423, -439, 444, -1284, 419, -441, 423, -1297, 423, -1298, 442, -1259, 447, -436, 424, -443, 423, -441, 444, -420, 444, -427, 423, -441, 424, -440, 425, -1294, 423, -1297, 422, -437, 445, -419, 444, -420, 424, -442, 424, -439, 424, -440, 423, -441, 424, -440, 424, -441, 423, -441, 424, -438, 444, -425, 423, -439, 424, -438, 448, -416, 447, -422, 424, -443, 423, -437, 423, -416, 468, -421, 424, -441, 423, -439, 423, -437, 423, -441, 423, -441, 424, -443, 423, -439, 444, -420, 444, -423, 446, -418, 447, -424, 424, -438, 424, -436, 444, -427, 423, -441, 424, -438, 446, -421, 424, -436, 445, -423, 440, -421, 423, -443, 424, -440, 444, -421, 423, -446, 423, -439, 444, -420, 423, -1298, 422, -441, 424, -440, 424, -441, 423, -441, 423, -1299, 422, -1298, 423};
-static const int32_t CODE_COOL_23_LOW[]     = {3437, -1727, 446, -1278, 420, -1297, 421, -445, 427, -438, 423, -437, 443, -1281, 423, -445, 423, -439, 444, -1277, 422, -1271, 467, -422, 424, -1294, 423, -438, 449, -421, 423, -1271, 468, -1279, 418, -447, 420, -1299, 439, -1257, 446, -444, 420, -444, 423, -1277, 445, -442, 422, -441, 423, -1301, 419, -436, 444, -427, 423, -441, 424, -438, 447, -417, 447, -424, 424, -441, 444, -422, 448, -422, 422, -441, 424, -441, 423, -441, 423, -439, 444, -424, 424, -439, 423, -439, 444, -421, 443, -1280, 424, -443, 423, -439, 444, -1284, 419, -441, 423, -1297, 423, -1298, 442, -1259, 447, -436, 424, -443, 423, -441, 444, -420, 444, -427, 423, -441, 424, -440, 425, -1294, 423, -1297, 422, -437, 445, -419, 444, -420, 424, -442, 424, -439, 424, -440, 423, -441, 424, -440, 424, -441, 423, -441, 424, -438, 444, -425, 423, -439, 424, -438, 448, -416, 447, -422, 424, -443, 423, -437, 423, -416, 468, -421, 424, -441, 423, -439, 423, -437, 423, -441, 423, -441, 424, -443, 423, -439, 444, -420, 444, -423, 446, -418, 447, -424, 424, -438, 424, -436, 444, -427, 423, -441, 424, -438, 446, -421, 424, -436, 445, -423, 440, -421, 423, -443, 424, -440, 444, -421, 423, -446, 423, -439, 444, -420, 423, -1298, 422, -441, 424, -440, 424, -441, 423, -441, 423, -1299, 422, -1298, 423};
-static const int32_t CODE_COOL_24_LOW[]     = {3437, -1727, 446, -1278, 420, -1297, 421, -445, 427, -438, 423, -437, 443, -1281, 423, -445, 423, -439, 444, -1277, 422, -1271, 467, -422, 424, -1294, 423, -438, 449, -421, 423, -1271, 468, -1279, 418, -447, 420, -1299, 439, -1257, 446, -444, 420, -444, 423, -1277, 445, -442, 422, -441, 423, -1301, 419, -436, 444, -427, 423, -441, 424, -438, 447, -417, 447, -424, 424, -441, 444, -422, 448, -422, 422, -441, 424, -441, 423, -441, 423, -439, 444, -424, 424, -439, 423, -439, 444, -421, 443, -1280, 424, -443, 423, -439, 444, -1284, 419, -441, 423, -1297, 423, -1298, 442, -1259, 447, -436, 424, -443, 423, -441, 444, -420, 444, -427, 423, -441, 424, -440, 425, -1294, 423, -1297, 422, -437, 445, -419, 444, -420, 424, -442, 424, -439, 424, -440, 423, -441, 424, -440, 424, -441, 423, -441, 424, -438, 444, -425, 423, -439, 424, -438, 448, -416, 447, -422, 424, -443, 423, -437, 423, -416, 468, -421, 424, -441, 423, -439, 423, -437, 423, -441, 423, -441, 424, -443, 423, -439, 444, -420, 444, -423, 446, -418, 447, -424, 424, -438, 424, -436, 444, -427, 423, -441, 424, -438, 446, -421, 424, -436, 445, -423, 440, -421, 423, -443, 424, -440, 444, -421, 423, -446, 423, -439, 444, -420, 423, -1298, 422, -441, 424, -440, 424, -441, 423, -441, 423, -1299, 422, -1298, 423};
-static const int32_t CODE_COOL_25_LOW[]     = {3437, -1727, 446, -1278, 420, -1297, 421, -445, 427, -438, 423, -437, 443, -1281, 423, -445, 423, -439, 444, -1277, 422, -1271, 467, -422, 424, -1294, 423, -438, 449, -421, 423, -1271, 468, -1279, 418, -447, 420, -1299, 439, -1257, 446, -444, 420, -444, 423, -1277, 445, -442, 422, -441, 423, -1301, 419, -436, 444, -427, 423, -441, 424, -438, 447, -417, 447, -424, 424, -441, 444, -422, 448, -422, 422, -441, 424, -441, 423, -441, 423, -439, 444, -424, 424, -439, 423, -439, 444, -421, 443, -1280, 424, -443, 423, -439, 444, -1284, 419, -441, 423, -1297, 423, -1298, 442, -1259, 447, -436, 424, -443, 423, -441, 444, -420, 444, -427, 423, -441, 424, -440, 425, -1294, 423, -1297, 422, -437, 445, -419, 444, -420, 424, -442, 424, -439, 424, -440, 423, -441, 424, -440, 424, -441, 423, -441, 424, -438, 444, -425, 423, -439, 424, -438, 448, -416, 447, -422, 424, -443, 423, -437, 423, -416, 468, -421, 424, -441, 423, -439, 423, -437, 423, -441, 423, -441, 424, -443, 423, -439, 444, -420, 444, -423, 446, -418, 447, -424, 424, -438, 424, -436, 444, -427, 423, -441, 424, -438, 446, -421, 424, -436, 445, -423, 440, -421, 423, -443, 424, -440, 444, -421, 423, -446, 423, -439, 444, -420, 423, -1298, 422, -441, 424, -440, 424, -441, 423, -441, 423, -1299, 422, -1298, 423};
-static const int32_t CODE_COOL_26_LOW[]     = {3437, -1727, 446, -1278, 420, -1297, 421, -445, 427, -438, 423, -437, 443, -1281, 423, -445, 423, -439, 444, -1277, 422, -1271, 467, -422, 424, -1294, 423, -438, 449, -421, 423, -1271, 468, -1279, 418, -447, 420, -1299, 439, -1257, 446, -444, 420, -444, 423, -1277, 445, -442, 422, -441, 423, -1301, 419, -436, 444, -427, 423, -441, 424, -438, 447, -417, 447, -424, 424, -441, 444, -422, 448, -422, 422, -441, 424, -441, 423, -441, 423, -439, 444, -424, 424, -439, 423, -439, 444, -421, 443, -1280, 424, -443, 423, -439, 444, -1284, 419, -441, 423, -1297, 423, -1298, 442, -1259, 447, -436, 424, -443, 423, -441, 444, -420, 444, -427, 423, -441, 424, -440, 425, -1294, 423, -1297, 422, -437, 445, -419, 444, -420, 424, -442, 424, -439, 424, -440, 423, -441, 424, -440, 424, -441, 423, -441, 424, -438, 444, -425, 423, -439, 424, -438, 448, -416, 447, -422, 424, -443, 423, -437, 423, -416, 468, -421, 424, -441, 423, -439, 423, -437, 423, -441, 423, -441, 424, -443, 423, -439, 444, -420, 444, -423, 446, -418, 447, -424, 424, -438, 424, -436, 444, -427, 423, -441, 424, -438, 446, -421, 424, -436, 445, -423, 440, -421, 423, -443, 424, -440, 444, -421, 423, -446, 423, -439, 444, -420, 423, -1298, 422, -441, 424, -440, 424, -441, 423, -441, 423, -1299, 422, -1298, 423};
-static const int32_t CODE_COOL_27_LOW[]     = {3437, -1727, 446, -1278, 420, -1297, 421, -445, 427, -438, 423, -437, 443, -1281, 423, -445, 423, -439, 444, -1277, 422, -1271, 467, -422, 424, -1294, 423, -438, 449, -421, 423, -1271, 468, -1279, 418, -447, 420, -1299, 439, -1257, 446, -444, 420, -444, 423, -1277, 445, -442, 422, -441, 423, -1301, 419, -436, 444, -427, 423, -441, 424, -438, 447, -417, 447, -424, 424, -441, 444, -422, 448, -422, 422, -441, 424, -441, 423, -441, 423, -439, 444, -424, 424, -439, 423, -439, 444, -421, 443, -1280, 424, -443, 423, -439, 444, -1284, 419, -441, 423, -1297, 423, -1298, 442, -1259, 447, -436, 424, -443, 423, -441, 444, -420, 444, -427, 423, -441, 424, -440, 425, -1294, 423, -1297, 422, -437, 445, -419, 444, -420, 424, -442, 424, -439, 424, -440, 423, -441, 424, -440, 424, -441, 423, -441, 424, -438, 444, -425, 423, -439, 424, -438, 448, -416, 447, -422, 424, -443, 423, -437, 423, -416, 468, -421, 424, -441, 423, -439, 423, -437, 423, -441, 423, -441, 424, -443, 423, -439, 444, -420, 444, -423, 446, -418, 447, -424, 424, -438, 424, -436, 444, -427, 423, -441, 424, -438, 446, -421, 424, -436, 445, -423, 440, -421, 423, -443, 424, -440, 444, -421, 423, -446, 423, -439, 444, -420, 423, -1298, 422, -441, 424, -440, 424, -441, 423, -441, 423, -1299, 422, -1298, 423};
-static const int32_t CODE_COOL_22_MEDIUM[]  = {3437, -1727, 446, -1278, 420, -1297, 421, -445, 427, -438, 423, -437, 443, -1281, 423, -445, 423, -439, 444, -1277, 422, -1271, 467, -422, 424, -1294, 423, -438, 449, -421, 423, -1271, 468, -1279, 418, -447, 420, -1299, 439, -1257, 446, -444, 420, -444, 423, -1277, 445, -442, 422, -441, 423, -1301, 419, -436, 444, -427, 423, -441, 424, -438, 447, -417, 447, -424, 424, -441, 444, -422, 448, -422, 422, -441, 424, -441, 423, -441, 423, -439, 444, -424, 424, -439, 423, -439, 444, -421, 443, -1280, 424, -443, 423, -439, 444, -1284, 419, -441, 423, -1297, 423, -1298, 442, -1259, 447, -436, 424, -443, 423, -441, 444, -420, 444, -427, 423, -441, 424, -440, 425, -1294, 423, -1297, 422, -437, 445, -419, 444, -420, 424, -442, 424, -439, 424, -440, 423, -441, 424, -440, 424, -441, 423, -441, 424, -438, 444, -425, 423, -439, 424, -438, 448, -416, 447, -422, 424, -443, 423, -437, 423, -416, 468, -421, 424, -441, 423, -439, 423, -437, 423, -441, 423, -441, 424, -443, 423, -439, 444, -420, 444, -423, 446, -418, 447, -424, 424, -438, 424, -436, 444, -427, 423, -441, 424, -438, 446, -421, 424, -436, 445, -423, 440, -421, 423, -443, 424, -440, 444, -421, 423, -446, 423, -439, 444, -420, 423, -1298, 422, -441, 424, -440, 424, -441, 423, -441, 423, -1299, 422, -1298, 423};
-static const int32_t CODE_COOL_23_MEDIUM[]  = {3437, -1727, 446, -1278, 420, -1297, 421, -445, 427, -438, 423, -437, 443, -1281, 423, -445, 423, -439, 444, -1277, 422, -1271, 467, -422, 424, -1294, 423, -438, 449, -421, 423, -1271, 468, -1279, 418, -447, 420, -1299, 439, -1257, 446, -444, 420, -444, 423, -1277, 445, -442, 422, -441, 423, -1301, 419, -436, 444, -427, 423, -441, 424, -438, 447, -417, 447, -424, 424, -441, 444, -422, 448, -422, 422, -441, 424, -441, 423, -441, 423, -439, 444, -424, 424, -439, 423, -439, 444, -421, 443, -1280, 424, -443, 423, -439, 444, -1284, 419, -441, 423, -1297, 423, -1298, 442, -1259, 447, -436, 424, -443, 423, -441, 444, -420, 444, -427, 423, -441, 424, -440, 425, -1294, 423, -1297, 422, -437, 445, -419, 444, -420, 424, -442, 424, -439, 424, -440, 423, -441, 424, -440, 424, -441, 423, -441, 424, -438, 444, -425, 423, -439, 424, -438, 448, -416, 447, -422, 424, -443, 423, -437, 423, -416, 468, -421, 424, -441, 423, -439, 423, -437, 423, -441, 423, -441, 424, -443, 423, -439, 444, -420, 444, -423, 446, -418, 447, -424, 424, -438, 424, -436, 444, -427, 423, -441, 424, -438, 446, -421, 424, -436, 445, -423, 440, -421, 423, -443, 424, -440, 444, -421, 423, -446, 423, -439, 444, -420, 423, -1298, 422, -441, 424, -440, 424, -441, 423, -441, 423, -1299, 422, -1298, 423};
-static const int32_t CODE_COOL_24_MEDIUM[]  = {3437, -1727, 446, -1278, 420, -1297, 421, -445, 427, -438, 423, -437, 443, -1281, 423, -445, 423, -439, 444, -1277, 422, -1271, 467, -422, 424, -1294, 423, -438, 449, -421, 423, -1271, 468, -1279, 418, -447, 420, -1299, 439, -1257, 446, -444, 420, -444, 423, -1277, 445, -442, 422, -441, 423, -1301, 419, -436, 444, -427, 423, -441, 424, -438, 447, -417, 447, -424, 424, -441, 444, -422, 448, -422, 422, -441, 424, -441, 423, -441, 423, -439, 444, -424, 424, -439, 423, -439, 444, -421, 443, -1280, 424, -443, 423, -439, 444, -1284, 419, -441, 423, -1297, 423, -1298, 442, -1259, 447, -436, 424, -443, 423, -441, 444, -420, 444, -427, 423, -441, 424, -440, 425, -1294, 423, -1297, 422, -437, 445, -419, 444, -420, 424, -442, 424, -439, 424, -440, 423, -441, 424, -440, 424, -441, 423, -441, 424, -438, 444, -425, 423, -439, 424, -438, 448, -416, 447, -422, 424, -443, 423, -437, 423, -416, 468, -421, 424, -441, 423, -439, 423, -437, 423, -441, 423, -441, 424, -443, 423, -439, 444, -420, 444, -423, 446, -418, 447, -424, 424, -438, 424, -436, 444, -427, 423, -441, 424, -438, 446, -421, 424, -436, 445, -423, 440, -421, 423, -443, 424, -440, 444, -421, 423, -446, 423, -439, 444, -420, 423, -1298, 422, -441, 424, -440, 424, -441, 423, -441, 423, -1299, 422, -1298, 423};
-static const int32_t CODE_COOL_25_MEDIUM[]  = {3437, -1727, 446, -1278, 420, -1297, 421, -445, 427, -438, 423, -437, 443, -1281, 423, -445, 423, -439, 444, -1277, 422, -1271, 467, -422, 424, -1294, 423, -438, 449, -421, 423, -1271, 468, -1279, 418, -447, 420, -1299, 439, -1257, 446, -444, 420, -444, 423, -1277, 445, -442, 422, -441, 423, -1301, 419, -436, 444, -427, 423, -441, 424, -438, 447, -417, 447, -424, 424, -441, 444, -422, 448, -422, 422, -441, 424, -441, 423, -441, 423, -439, 444, -424, 424, -439, 423, -439, 444, -421, 443, -1280, 424, -443, 423, -439, 444, -1284, 419, -441, 423, -1297, 423, -1298, 442, -1259, 447, -436, 424, -443, 423, -441, 444, -420, 444, -427, 423, -441, 424, -440, 425, -1294, 423, -1297, 422, -437, 445, -419, 444, -420, 424, -442, 424, -439, 424, -440, 423, -441, 424, -440, 424, -441, 423, -441, 424, -438, 444, -425, 423, -439, 424, -438, 448, -416, 447, -422, 424, -443, 423, -437, 423, -416, 468, -421, 424, -441, 423, -439, 423, -437, 423, -441, 423, -441, 424, -443, 423, -439, 444, -420, 444, -423, 446, -418, 447, -424, 424, -438, 424, -436, 444, -427, 423, -441, 424, -438, 446, -421, 424, -436, 445, -423, 440, -421, 423, -443, 424, -440, 444, -421, 423, -446, 423, -439, 444, -420, 423, -1298, 422, -441, 424, -440, 424, -441, 423, -441, 423, -1299, 422, -1298, 423};
-static const int32_t CODE_COOL_26_MEDIUM[]  = {3437, -1727, 446, -1278, 420, -1297, 421, -445, 427, -438, 423, -437, 443, -1281, 423, -445, 423, -439, 444, -1277, 422, -1271, 467, -422, 424, -1294, 423, -438, 449, -421, 423, -1271, 468, -1279, 418, -447, 420, -1299, 439, -1257, 446, -444, 420, -444, 423, -1277, 445, -442, 422, -441, 423, -1301, 419, -436, 444, -427, 423, -441, 424, -438, 447, -417, 447, -424, 424, -441, 444, -422, 448, -422, 422, -441, 424, -441, 423, -441, 423, -439, 444, -424, 424, -439, 423, -439, 444, -421, 443, -1280, 424, -443, 423, -439, 444, -1284, 419, -441, 423, -1297, 423, -1298, 442, -1259, 447, -436, 424, -443, 423, -441, 444, -420, 444, -427, 423, -441, 424, -440, 425, -1294, 423, -1297, 422, -437, 445, -419, 444, -420, 424, -442, 424, -439, 424, -440, 423, -441, 424, -440, 424, -441, 423, -441, 424, -438, 444, -425, 423, -439, 424, -438, 448, -416, 447, -422, 424, -443, 423, -437, 423, -416, 468, -421, 424, -441, 423, -439, 423, -437, 423, -441, 423, -441, 424, -443, 423, -439, 444, -420, 444, -423, 446, -418, 447, -424, 424, -438, 424, -436, 444, -427, 423, -441, 424, -438, 446, -421, 424, -436, 445, -423, 440, -421, 423, -443, 424, -440, 444, -421, 423, -446, 423, -439, 444, -420, 423, -1298, 422, -441, 424, -440, 424, -441, 423, -441, 423, -1299, 422, -1298, 423};
-static const int32_t CODE_COOL_27_MEDIUM[]  = {3437, -1727, 446, -1278, 420, -1297, 421, -445, 427, -438, 423, -437, 443, -1281, 423, -445, 423, -439, 444, -1277, 422, -1271, 467, -422, 424, -1294, 423, -438, 449, -421, 423, -1271, 468, -1279, 418, -447, 420, -1299, 439, -1257, 446, -444, 420, -444, 423, -1277, 445, -442, 422, -441, 423, -1301, 419, -436, 444, -427, 423, -441, 424, -438, 447, -417, 447, -424, 424, -441, 444, -422, 448, -422, 422, -441, 424, -441, 423, -441, 423, -439, 444, -424, 424, -439, 423, -439, 444, -421, 443, -1280, 424, -443, 423, -439, 444, -1284, 419, -441, 423, -1297, 423, -1298, 442, -1259, 447, -436, 424, -443, 423, -441, 444, -420, 444, -427, 423, -441, 424, -440, 425, -1294, 423, -1297, 422, -437, 445, -419, 444, -420, 424, -442, 424, -439, 424, -440, 423, -441, 424, -440, 424, -441, 423, -441, 424, -438, 444, -425, 423, -439, 424, -438, 448, -416, 447, -422, 424, -443, 423, -437, 423, -416, 468, -421, 424, -441, 423, -439, 423, -437, 423, -441, 423, -441, 424, -443, 423, -439, 444, -420, 444, -423, 446, -418, 447, -424, 424, -438, 424, -436, 444, -427, 423, -441, 424, -438, 446, -421, 424, -436, 445, -423, 440, -421, 423, -443, 424, -440, 444, -421, 423, -446, 423, -439, 444, -420, 423, -1298, 422, -441, 424, -440, 424, -441, 423, -441, 423, -1299, 422, -1298, 423};
-static const int32_t CODE_COOL_22_HIGH[]    = {3437, -1727, 446, -1278, 420, -1297, 421, -445, 427, -438, 423, -437, 443, -1281, 423, -445, 423, -439, 444, -1277, 422, -1271, 467, -422, 424, -1294, 423, -438, 449, -421, 423, -1271, 468, -1279, 418, -447, 420, -1299, 439, -1257, 446, -444, 420, -444, 423, -1277, 445, -442, 422, -441, 423, -1301, 419, -436, 444, -427, 423, -441, 424, -438, 447, -417, 447, -424, 424, -441, 444, -422, 448, -422, 422, -441, 424, -441, 423, -441, 423, -439, 444, -424, 424, -439, 423, -439, 444, -421, 443, -1280, 424, -443, 423, -439, 444, -1284, 419, -441, 423, -1297, 423, -1298, 442, -1259, 447, -436, 424, -443, 423, -441, 444, -420, 444, -427, 423, -441, 424, -440, 425, -1294, 423, -1297, 422, -437, 445, -419, 444, -420, 424, -442, 424, -439, 424, -440, 423, -441, 424, -440, 424, -441, 423, -441, 424, -438, 444, -425, 423, -439, 424, -438, 448, -416, 447, -422, 424, -443, 423, -437, 423, -416, 468, -421, 424, -441, 423, -439, 423, -437, 423, -441, 423, -441, 424, -443, 423, -439, 444, -420, 444, -423, 446, -418, 447, -424, 424, -438, 424, -436, 444, -427, 423, -441, 424, -438, 446, -421, 424, -436, 445, -423, 440, -421, 423, -443, 424, -440, 444, -421, 423, -446, 423, -439, 444, -420, 423, -1298, 422, -441, 424, -440, 424, -441, 423, -441, 423, -1299, 422, -1298, 423};
-static const int32_t CODE_COOL_23_HIGH[]    = {3437, -1727, 446, -1278, 420, -1297, 421, -445, 427, -438, 423, -437, 443, -1281, 423, -445, 423, -439, 444, -1277, 422, -1271, 467, -422, 424, -1294, 423, -438, 449, -421, 423, -1271, 468, -1279, 418, -447, 420, -1299, 439, -1257, 446, -444, 420, -444, 423, -1277, 445, -442, 422, -441, 423, -1301, 419, -436, 444, -427, 423, -441, 424, -438, 447, -417, 447, -424, 424, -441, 444, -422, 448, -422, 422, -441, 424, -441, 423, -441, 423, -439, 444, -424, 424, -439, 423, -439, 444, -421, 443, -1280, 424, -443, 423, -439, 444, -1284, 419, -441, 423, -1297, 423, -1298, 442, -1259, 447, -436, 424, -443, 423, -441, 444, -420, 444, -427, 423, -441, 424, -440, 425, -1294, 423, -1297, 422, -437, 445, -419, 444, -420, 424, -442, 424, -439, 424, -440, 423, -441, 424, -440, 424, -441, 423, -441, 424, -438, 444, -425, 423, -439, 424, -438, 448, -416, 447, -422, 424, -443, 423, -437, 423, -416, 468, -421, 424, -441, 423, -439, 423, -437, 423, -441, 423, -441, 424, -443, 423, -439, 444, -420, 444, -423, 446, -418, 447, -424, 424, -438, 424, -436, 444, -427, 423, -441, 424, -438, 446, -421, 424, -436, 445, -423, 440, -421, 423, -443, 424, -440, 444, -421, 423, -446, 423, -439, 444, -420, 423, -1298, 422, -441, 424, -440, 424, -441, 423, -441, 423, -1299, 422, -1298, 423};
-static const int32_t CODE_COOL_24_HIGH[]    = {3437, -1727, 446, -1278, 420, -1297, 421, -445, 427, -438, 423, -437, 443, -1281, 423, -445, 423, -439, 444, -1277, 422, -1271, 467, -422, 424, -1294, 423, -438, 449, -421, 423, -1271, 468, -1279, 418, -447, 420, -1299, 439, -1257, 446, -444, 420, -444, 423, -1277, 445, -442, 422, -441, 423, -1301, 419, -436, 444, -427, 423, -441, 424, -438, 447, -417, 447, -424, 424, -441, 444, -422, 448, -422, 422, -441, 424, -441, 423, -441, 423, -439, 444, -424, 424, -439, 423, -439, 444, -421, 443, -1280, 424, -443, 423, -439, 444, -1284, 419, -441, 423, -1297, 423, -1298, 442, -1259, 447, -436, 424, -443, 423, -441, 444, -420, 444, -427, 423, -441, 424, -440, 425, -1294, 423, -1297, 422, -437, 445, -419, 444, -420, 424, -442, 424, -439, 424, -440, 423, -441, 424, -440, 424, -441, 423, -441, 424, -438, 444, -425, 423, -439, 424, -438, 448, -416, 447, -422, 424, -443, 423, -437, 423, -416, 468, -421, 424, -441, 423, -439, 423, -437, 423, -441, 423, -441, 424, -443, 423, -439, 444, -420, 444, -423, 446, -418, 447, -424, 424, -438, 424, -436, 444, -427, 423, -441, 424, -438, 446, -421, 424, -436, 445, -423, 440, -421, 423, -443, 424, -440, 444, -421, 423, -446, 423, -439, 444, -420, 423, -1298, 422, -441, 424, -440, 424, -441, 423, -441, 423, -1299, 422, -1298, 423};
-static const int32_t CODE_COOL_25_HIGH[]    = {3437, -1727, 446, -1278, 420, -1297, 421, -445, 427, -438, 423, -437, 443, -1281, 423, -445, 423, -439, 444, -1277, 422, -1271, 467, -422, 424, -1294, 423, -438, 449, -421, 423, -1271, 468, -1279, 418, -447, 420, -1299, 439, -1257, 446, -444, 420, -444, 423, -1277, 445, -442, 422, -441, 423, -1301, 419, -436, 444, -427, 423, -441, 424, -438, 447, -417, 447, -424, 424, -441, 444, -422, 448, -422, 422, -441, 424, -441, 423, -441, 423, -439, 444, -424, 424, -439, 423, -439, 444, -421, 443, -1280, 424, -443, 423, -439, 444, -1284, 419, -441, 423, -1297, 423, -1298, 442, -1259, 447, -436, 424, -443, 423, -441, 444, -420, 444, -427, 423, -441, 424, -440, 425, -1294, 423, -1297, 422, -437, 445, -419, 444, -420, 424, -442, 424, -439, 424, -440, 423, -441, 424, -440, 424, -441, 423, -441, 424, -438, 444, -425, 423, -439, 424, -438, 448, -416, 447, -422, 424, -443, 423, -437, 423, -416, 468, -421, 424, -441, 423, -439, 423, -437, 423, -441, 423, -441, 424, -443, 423, -439, 444, -420, 444, -423, 446, -418, 447, -424, 424, -438, 424, -436, 444, -427, 423, -441, 424, -438, 446, -421, 424, -436, 445, -423, 440, -421, 423, -443, 424, -440, 444, -421, 423, -446, 423, -439, 444, -420, 423, -1298, 422, -441, 424, -440, 424, -441, 423, -441, 423, -1299, 422, -1298, 423};
-static const int32_t CODE_COOL_26_HIGH[]    = {3437, -1727, 446, -1278, 420, -1297, 421, -445, 427, -438, 423, -437, 443, -1281, 423, -445, 423, -439, 444, -1277, 422, -1271, 467, -422, 424, -1294, 423, -438, 449, -421, 423, -1271, 468, -1279, 418, -447, 420, -1299, 439, -1257, 446, -444, 420, -444, 423, -1277, 445, -442, 422, -441, 423, -1301, 419, -436, 444, -427, 423, -441, 424, -438, 447, -417, 447, -424, 424, -441, 444, -422, 448, -422, 422, -441, 424, -441, 423, -441, 423, -439, 444, -424, 424, -439, 423, -439, 444, -421, 443, -1280, 424, -443, 423, -439, 444, -1284, 419, -441, 423, -1297, 423, -1298, 442, -1259, 447, -436, 424, -443, 423, -441, 444, -420, 444, -427, 423, -441, 424, -440, 425, -1294, 423, -1297, 422, -437, 445, -419, 444, -420, 424, -442, 424, -439, 424, -440, 423, -441, 424, -440, 424, -441, 423, -441, 424, -438, 444, -425, 423, -439, 424, -438, 448, -416, 447, -422, 424, -443, 423, -437, 423, -416, 468, -421, 424, -441, 423, -439, 423, -437, 423, -441, 423, -441, 424, -443, 423, -439, 444, -420, 444, -423, 446, -418, 447, -424, 424, -438, 424, -436, 444, -427, 423, -441, 424, -438, 446, -421, 424, -436, 445, -423, 440, -421, 423, -443, 424, -440, 444, -421, 423, -446, 423, -439, 444, -420, 423, -1298, 422, -441, 424, -440, 424, -441, 423, -441, 423, -1299, 422, -1298, 423};
-static const int32_t CODE_COOL_27_HIGH[]    = {3437, -1727, 446, -1278, 420, -1297, 421, -445, 427, -438, 423, -437, 443, -1281, 423, -445, 423, -439, 444, -1277, 422, -1271, 467, -422, 424, -1294, 423, -438, 449, -421, 423, -1271, 468, -1279, 418, -447, 420, -1299, 439, -1257, 446, -444, 420, -444, 423, -1277, 445, -442, 422, -441, 423, -1301, 419, -436, 444, -427, 423, -441, 424, -438, 447, -417, 447, -424, 424, -441, 444, -422, 448, -422, 422, -441, 424, -441, 423, -441, 423, -439, 444, -424, 424, -439, 423, -439, 444, -421, 443, -1280, 424, -443, 423, -439, 444, -1284, 419, -441, 423, -1297, 423, -1298, 442, -1259, 447, -436, 424, -443, 423, -441, 444, -420, 444, -427, 423, -441, 424, -440, 425, -1294, 423, -1297, 422, -437, 445, -419, 444, -420, 424, -442, 424, -439, 424, -440, 423, -441, 424, -440, 424, -441, 423, -441, 424, -438, 444, -425, 423, -439, 424, -438, 448, -416, 447, -422, 424, -443, 423, -437, 423, -416, 468, -421, 424, -441, 423, -439, 423, -437, 423, -441, 423, -441, 424, -443, 423, -439, 444, -420, 444, -423, 446, -418, 447, -424, 424, -438, 424, -436, 444, -427, 423, -441, 424, -438, 446, -421, 424, -436, 445, -423, 440, -421, 423, -443, 424, -440, 444, -421, 423, -446, 423, -439, 444, -420, 423, -1298, 422, -441, 424, -440, 424, -441, 423, -441, 423, -1299, 422, -1298, 423};
-static const int32_t CODE_FAN_LOW[]         = {3437, -1727, 446, -1278, 420, -1297, 421, -445, 427, -438, 423, -437, 443, -1281, 423, -445, 423, -439, 444, -1277, 422, -1271, 467, -422, 424, -1294, 423, -438, 449, -421, 423, -1271, 468, -1279, 418, -447, 420, -1299, 439, -1257, 446, -444, 420, -444, 423, -1277, 445, -442, 422, -441, 423, -1301, 419, -436, 444, -427, 423, -441, 424, -438, 447, -417, 447, -424, 424, -441, 444, -422, 448, -422, 422, -441, 424, -441, 423, -441, 423, -439, 444, -424, 424, -439, 423, -439, 444, -421, 443, -1280, 424, -443, 423, -439, 444, -1284, 419, -441, 423, -1297, 423, -1298, 442, -1259, 447, -436, 424, -443, 423, -441, 444, -420, 444, -427, 423, -441, 424, -440, 425, -1294, 423, -1297, 422, -437, 445, -419, 444, -420, 424, -442, 424, -439, 424, -440, 423, -441, 424, -440, 424, -441, 423, -441, 424, -438, 444, -425, 423, -439, 424, -438, 448, -416, 447, -422, 424, -443, 423, -437, 423, -416, 468, -421, 424, -441, 423, -439, 423, -437, 423, -441, 423, -441, 424, -443, 423, -439, 444, -420, 444, -423, 446, -418, 447, -424, 424, -438, 424, -436, 444, -427, 423, -441, 424, -438, 446, -421, 424, -436, 445, -423, 440, -421, 423, -443, 424, -440, 444, -421, 423, -446, 423, -439, 444, -420, 423, -1298, 422, -441, 424, -440, 424, -441, 423, -441, 423, -1299, 422, -1298, 423};
-static const int32_t CODE_FAN_MEDIUM[]      = {3437, -1727, 446, -1278, 420, -1297, 421, -445, 427, -438, 423, -437, 443, -1281, 423, -445, 423, -439, 444, -1277, 422, -1271, 467, -422, 424, -1294, 423, -438, 449, -421, 423, -1271, 468, -1279, 418, -447, 420, -1299, 439, -1257, 446, -444, 420, -444, 423, -1277, 445, -442, 422, -441, 423, -1301, 419, -436, 444, -427, 423, -441, 424, -438, 447, -417, 447, -424, 424, -441, 444, -422, 448, -422, 422, -441, 424, -441, 423, -441, 423, -439, 444, -424, 424, -439, 423, -439, 444, -421, 443, -1280, 424, -443, 423, -439, 444, -1284, 419, -441, 423, -1297, 423, -1298, 442, -1259, 447, -436, 424, -443, 423, -441, 444, -420, 444, -427, 423, -441, 424, -440, 425, -1294, 423, -1297, 422, -437, 445, -419, 444, -420, 424, -442, 424, -439, 424, -440, 423, -441, 424, -440, 424, -441, 423, -441, 424, -438, 444, -425, 423, -439, 424, -438, 448, -416, 447, -422, 424, -443, 423, -437, 423, -416, 468, -421, 424, -441, 423, -439, 423, -437, 423, -441, 423, -441, 424, -443, 423, -439, 444, -420, 444, -423, 446, -418, 447, -424, 424, -438, 424, -436, 444, -427, 423, -441, 424, -438, 446, -421, 424, -436, 445, -423, 440, -421, 423, -443, 424, -440, 444, -421, 423, -446, 423, -439, 444, -420, 423, -1298, 422, -441, 424, -440, 424, -441, 423, -441, 423, -1299, 422, -1298, 423};
-static const int32_t CODE_FAN_HIGH[]        = {3437, -1727, 446, -1278, 420, -1297, 421, -445, 427, -438, 423, -437, 443, -1281, 423, -445, 423, -439, 444, -1277, 422, -1271, 467, -422, 424, -1294, 423, -438, 449, -421, 423, -1271, 468, -1279, 418, -447, 420, -1299, 439, -1257, 446, -444, 420, -444, 423, -1277, 445, -442, 422, -441, 423, -1301, 419, -436, 444, -427, 423, -441, 424, -438, 447, -417, 447, -424, 424, -441, 444, -422, 448, -422, 422, -441, 424, -441, 423, -441, 423, -439, 444, -424, 424, -439, 423, -439, 444, -421, 443, -1280, 424, -443, 423, -439, 444, -1284, 419, -441, 423, -1297, 423, -1298, 442, -1259, 447, -436, 424, -443, 423, -441, 444, -420, 444, -427, 423, -441, 424, -440, 425, -1294, 423, -1297, 422, -437, 445, -419, 444, -420, 424, -442, 424, -439, 424, -440, 423, -441, 424, -440, 424, -441, 423, -441, 424, -438, 444, -425, 423, -439, 424, -438, 448, -416, 447, -422, 424, -443, 423, -437, 423, -416, 468, -421, 424, -441, 423, -439, 423, -437, 423, -441, 423, -441, 424, -443, 423, -439, 444, -420, 444, -423, 446, -418, 447, -424, 424, -438, 424, -436, 444, -427, 423, -441, 424, -438, 446, -421, 424, -436, 445, -423, 440, -421, 423, -443, 424, -440, 444, -421, 423, -446, 423, -439, 444, -420, 423, -1298, 422, -441, 424, -440, 424, -441, 423, -441, 423, -1299, 422, -1298, 423};
-
-
-const size_t RAW_CODE_LENGTH = sizeof(CODE_OFF) / sizeof(CODE_OFF[0]);
+// The raw captures live in codebooks/raw_ac.json and are packed into
+// raw_ac_codebook.cpp by tools/gen_codebook.py (int16 timings, perfect-hash
+// index over the climate state). Regenerate that file to add codes.
+static const ir_common::Codebook CODEBOOK(RAW_AC_CODEBOOK, RAW_AC_CODEBOOK_SIZE);
+
+// OFF does not depend on fan or temperature, FAN_ONLY not on temperature.
+// Learned codes are stored under the same keys as the built-in ones.
+static uint32_t state_key(uint8_t mode, uint8_t fan, float temperature) {
+  if (mode == climate::CLIMATE_MODE_OFF)
+    return ir_common::AcState(mode, ir_common::CODEBOOK_ANY, 0).packed();
+  if (mode == climate::CLIMATE_MODE_FAN_ONLY)
+    temperature = 0;
+  return ir_common::AcState(mode, fan, temperature).packed();
+}
 
-// ======================================================================
+// Shorter captures are noise or a stray button, not an A/C state frame.
+static const size_t LEARN_MIN_TIMINGS = 16;
 
 // --- Standard Setup and Dump Functions (Restored) ---
 void RawACClimate::setup() {
+  this->publish_gate_.attach(this);
   if (this->sensor_) {
     this->sensor_->add_on_state_callback([this](float state) {
       this->current_temperature = state;
-      this->publish_state();
+      this->publish_changes_();
     });
     this->current_temperature = this->sensor_->state;
   } else {
     this->current_temperature = NAN;
   }
 
-  auto restore = this->restore_state_();
-  if (restore.has_value()) {
-    restore->apply(this);
+  this->mode = climate::CLIMATE_MODE_OFF;
+  this->target_temperature = 24;
+  this->fan_mode = climate::CLIMATE_FAN_AUTO;
+
+  // Last state from RTC (warm boot) or the delayed flash copy (cold boot);
+  // nodes upgraded from the stock climate restore fall back to it once
+  this->state_store_.setup(this->get_object_id_hash() ^ ir_common::STATE_STORE_KEY);
+  ir_common::AcState restored;
+  if (this->state_store_.load(&restored)) {
+    restored.apply_to(this);
   } else {
-    this->mode = climate::CLIMATE_MODE_OFF;
-    this->target_temperature = 24;
-    this->fan_mode = climate::CLIMATE_FAN_AUTO;
+    auto restore = this->restore_state_();
+    if (restore.has_value())
+      restore->apply(this);
+  }
+  this->state_store_.attach(this);
+  this->set_interval("persist", this->state_store_.poll_interval(),
+                     [this]() { this->state_store_.commit_if_due(millis()); });
+  this->set_interval("publish", this->publish_gate_.poll_interval(), [this]() {
+    if (this->publish_gate_.take_due(millis()))
+      this->publish_changes_();
+  });
+
+  this->learned_.setup(this->get_object_id_hash() ^ 0x4C45524E /* "LERN" */, this->learn_slots_);
+  this->invalidate_traits_();
+  if (this->receiver_ != nullptr)
+    this->rebuild_matcher_();
+}
+
+// Sensor callbacks and held-back publishes
+static ir_common::BudgetSite PUBLISH_BUDGET{"raw_ac.publish"};
+
+void RawACClimate::publish_changes_() {
+  ir_common::BudgetGuard budget_guard(PUBLISH_BUDGET);
+  uint32_t now = millis();
+  uint32_t wait = this->publish_gate_.wait_ms(*this, now);
+  if (wait == 0) {
+    this->publish_state();
+  } else if (wait != ir_common::PUBLISH_NOT_NEEDED) {
+    // Re-checked then, so only the latest reading goes out
+    this->publish_gate_.hold(now, wait);
   }
 }
 
 void RawACClimate::dump_config() {
   ESP_LOGCONFIG(TAG, "Carrier AC Climate Component");
+  ESP_LOGCONFIG(TAG, "  Codebook: %u codes%s", CODEBOOK.size(), CODEBOOK.is_valid() ? "" : " (INVALID BLOB)");
+  ESP_LOGCONFIG(TAG, "  Learned: %u codes in %u/%u frame slots%s", (unsigned) this->learned_.key_count(),
+                (unsigned) this->learned_.frame_count(), (unsigned) this->learned_.frame_slots(),
+                this->receiver_ == nullptr ? " (no receiver_id, learning disabled)" : "");
+}
+
+// ======================================================================
+// ===                          LEARNING MODE                         ===
+// ======================================================================
+void RawACClimate::start_learning(const std::string &mode, const std::string &fan_mode, float temperature) {
+  if (this->receiver_ == nullptr) {
+    ESP_LOGE(TAG, "Cannot learn: no receiver_id configured");
+    return;
+  }
+  uint8_t mode_value, fan_value;
+  if (!ir_common::codebook_mode_from_name(mode, &mode_value)) {
+    ESP_LOGE(TAG, "Cannot learn: unknown mode '%s'", mode.c_str());
+    return;
+  }
+  if (!ir_common::codebook_fan_from_name(fan_mode, &fan_value)) {
+    ESP_LOGE(TAG, "Cannot learn: unknown fan mode '%s'", fan_mode.c_str());
+    return;
+  }
+  if (mode_value != climate::CLIMATE_MODE_OFF && mode_value != climate::CLIMATE_MODE_FAN_ONLY && temperature <= 0) {
+    ESP_LOGE(TAG, "Cannot learn: mode %s needs a target temperature", mode.c_str());
+    return;
+  }
+
+  this->learn_key_ = state_key(mode_value, fan_value, temperature);
+  this->learning_ = true;
+  ESP_LOGI(TAG, "Learning %s / %s / %.1f°C: set the remote to this state and press a button within %us",
+           mode.c_str(), fan_mode.c_str(), temperature, (unsigned) (this->learn_timeout_ / 1000));
+  this->set_timeout("learn", this->learn_timeout_, [this]() {
+    this->learning_ = false;
+    ESP_LOGW(TAG, "Learning timed out, nothing stored");
+  });
+}
+
+void RawACClimate::clear_learned() {
+  this->learning_ = false;
+  this->cancel_timeout("learn");
+  this->learned_.clear();
+  this->rebuild_matcher_();
+  this->invalidate_traits_();
+  ESP_LOGI(TAG, "Learned codes cleared");
+}
+
+void RawACClimate::rebuild_matcher_() {
+  this->matcher_.clear();
+  this->matcher_.add_learned(&this->learned_);
+  this->matcher_.add_codebook(&CODEBOOK);
+}
+
+// Learning writes flash and is not steady state, so only matching is guarded
+static ir_common::AllocSite MATCH_SITE{"raw_ac.match"};
+static ir_common::AllocSite CONTROL_SITE{"raw_ac.control"};
+static ir_common::BudgetSite CONTROL_BUDGET{"raw_ac.control"};
+// Learning and matching both run from here
+static ir_common::BudgetSite RECEIVE_BUDGET{"raw_ac.on_receive"};
+
+bool RawACClimate::on_receive(remote_base::RemoteReceiveData data) {
+  ir_common::BudgetGuard budget_guard(RECEIVE_BUDGET);
+  const auto &raw = data.get_raw_data();
+  if (this->learning_)
+    return this->learn_capture_(raw);
+  return this->match_capture_(raw);
+}
+
+bool RawACClimate::learn_capture_(const remote_base::RawTimings &raw) {
+  if (raw.size() < LEARN_MIN_TIMINGS) {
+    ESP_LOGD(TAG, "Ignoring %u-timing capture while learning", (unsigned) raw.size());
+    return false;
+  }
+  ir_common::QuantisedFrame frame;
+  if (!ir_common::quantise_frame(raw.data(), raw.size(), &frame)) {
+    ESP_LOGW(TAG, "Capture of %u timings is too long or too irregular to learn, press again",
+             (unsigned) raw.size());
+    return false;
+  }
+
+  this->learning_ = false;
+  this->cancel_timeout("learn");
+  switch (this->learned_.store(this->learn_key_, frame)) {
+    case ir_common::LearnedCodebook::STORED:
+      ESP_LOGI(TAG, "Learned %u-timing code (key 0x%08X)", frame.length, this->learn_key_);
+      break;
+    case ir_common::LearnedCodebook::DEDUPLICATED:
+      ESP_LOGI(TAG, "Learned code (key 0x%08X) matches an existing frame, sharing it", this->learn_key_);
+      break;
+    case ir_common::LearnedCodebook::FULL:
+      ESP_LOGE(TAG, "Learned codebook is full (%u frame slots), raise learn_slots or clear it",
+               (unsigned) this->learned_.frame_slots());
+      break;
+  }
+  this->rebuild_matcher_();
+  this->invalidate_traits_();
+  return true;
+}
+
+// ======================================================================
+// ===                     RECEIVE (STATE FEEDBACK)                   ===
+// ======================================================================
+bool RawACClimate::match_capture_(const remote_base::RawTimings &raw) {
+  ir_common::AllocGuard alloc_guard(MATCH_SITE);
+  if (raw.size() < LEARN_MIN_TIMINGS)
+    return false;
+
+  uint32_t start = micros();
+  uint32_t keys[8];
+  size_t n = this->matcher_.match(raw.data(), raw.size(), keys, 8);
+  ESP_LOGV(TAG, "Matched %u-timing capture to %u keys in %uus", (unsigned) raw.size(), (unsigned) n,
+           (unsigned) (micros() - start));
+  if (n == 0)
+    return false;
+
+  // The frame may stand for several states; keep ours if it is one of them
+  uint32_t current = state_key(this->mode, this->fan_mode.value_or(climate::CLIMATE_FAN_AUTO),
+                               this->target_temperature);
+  for (size_t i = 0; i < n; i++) {
+    if (keys[i] == current) {
+      ESP_LOGD(TAG, "Received code matches current state");
+      return true;
+    }
+  }
+  if (n > 1)
+    ESP_LOGD(TAG, "Received code is shared by %u states, using the first", (unsigned) n);
+
+  if (ir_common::AcState(keys[0]).apply_to(this)) {
+    ESP_LOGI(TAG, "Remote set %s, %.1f°C", climate_mode_to_string(this->mode), this->target_temperature);
+    this->publish_state();
+  }
+  return true;
 }
 
-// --- Helper function to send the raw code (Restored) ---
-void RawACClimate::transmit_raw_code_(const int32_t *data, size_t len) {
+// --- Helper functions to send a code from either codebook ---
+bool RawACClimate::transmit_first_(std::initializer_list<uint32_t> keys) {
+  ir_common::CodebookRecord record;
+  for (uint32_t key : keys) {
+    const ir_common::QuantisedFrame *learned = this->learned_.find(key);
+    if (learned != nullptr) {
+      this->transmit_learned_(*learned);
+      return true;
+    }
+    if (CODEBOOK.find(key, &record)) {
+      this->transmit_record_(record);
+      return true;
+    }
+  }
+  return false;
+}
+
+// Timings go straight into the transmitter's own buffer, which keeps its
+// capacity between sends: no per-transmit vector or copy.
+template<typename TimingAt> void RawACClimate::transmit_timings_(size_t length, TimingAt timing_at) {
   if (this->transmitter_ == nullptr) {
     ESP_LOGE(TAG, "Transmitter not set up!");
     return;
   }
-  if (len == 0 || data == nullptr) {
+  if (length == 0) {
       ESP_LOGE(TAG, "Invalid raw code data provided!");
       return;
   }
-
-  std::vector<int32_t> data_vec(data, data + len);
   auto call = this->transmitter_->transmit();
-  auto *raw_obj = call.get_data();
-  raw_obj->set_carrier_frequency(IR_FREQUENCY);
-  raw_obj->set_data(data_vec);
+  auto *dst = call.get_data();
+  dst->set_carrier_frequency(CODEBOOK.carrier_frequency());
+  dst->reserve(length);
+  for (size_t i = 0; i < length; i++) {
+    int32_t t = timing_at(i);
+    if (t > 0)
+      dst->mark(t);
+    else
+      dst->space(-t);
+  }
   call.perform();
 }
 
-// --- Define component features (Restored) ---
-climate::ClimateTraits RawACClimate::traits() {
-  auto traits = climate::ClimateTraits();
-  traits.set_supports_current_temperature(this->sensor_ != nullptr);
-
-  traits.set_supported_modes({
-      climate::CLIMATE_MODE_OFF,
-      climate::CLIMATE_MODE_COOL,
-      climate::CLIMATE_MODE_FAN_ONLY
-  });
+void RawACClimate::transmit_record_(const ir_common::CodebookRecord &record) {
+  this->transmit_timings_(record.length, [&record](size_t i) { return ir_common::Codebook::read_timing(record, i); });
+}
 
-  traits.set_supported_fan_modes({
-      climate::CLIMATE_FAN_LOW,
-      climate::CLIMATE_FAN_MEDIUM,
-      climate::CLIMATE_FAN_HIGH,
-      climate::CLIMATE_FAN_AUTO
-  });
+void RawACClimate::transmit_learned_(const ir_common::QuantisedFrame &frame) {
+  this->transmit_timings_(frame.length, [&frame](size_t i) { return frame.timing(i); });
+}
 
-  traits.set_visual_min_temperature(22.0f);
-  traits.set_visual_max_temperature(27.0f);
-  traits.set_visual_temperature_step(1.0f);
+// --- Define component features (Restored) ---
+climate::ClimateTraits RawACClimate::traits() {
+  // Built once from YAML plus the learned codes, rebuilt when those change
+  return this->cached_traits_(this->sensor_ != nullptr);
+}
 
-  return traits;
+// Learned codes can add modes, fan speeds and temperatures the built-in codebook lacks
+void RawACClimate::extend_traits_(climate::ClimateTraits &traits) {
+  float min_temp = this->min_temperature_, max_temp = this->max_temperature_;
+  for (size_t i = 0; i < this->learned_.key_count(); i++) {
+    ir_common::AcState state(this->learned_.key_at(i));
+    traits.add_supported_mode(static_cast<climate::ClimateMode>(state.mode()));
+    if (state.has_fan())
+      traits.add_supported_fan_mode(static_cast<climate::ClimateFanMode>(state.fan()));
+    if (state.has_temperature()) {
+      min_temp = std::min(min_temp, state.temperature());
+      max_temp = std::max(max_temp, state.temperature());
+    }
+  }
+  traits.set_visual_min_temperature(min_temp);
+  traits.set_visual_max_temperature(max_temp);
 }
 
 // --- Main control function (Restored) ---
 void RawACClimate::control(const climate::ClimateCall &call) {
+  ir_common::AllocGuard alloc_guard(CONTROL_SITE);
+  ir_common::BudgetGuard budget_guard(CONTROL_BUDGET);
   if (call.get_mode().has_value())
     this->mode = *call.get_mode();
   if (call.get_target_temperature().has_value())
@@ -133,17 +312,12 @@ void RawACClimate::control(const climate::ClimateCall &call) {
 }
 
 void RawACClimate::send_ir_code_() {
-  const int32_t *code_to_send = nullptr;
-  size_t code_len = 0;
+  bool found = false;
 
   // --- 1. Check for OFF state ---
   if (this->mode == climate::CLIMATE_MODE_OFF) {
     ESP_LOGD(TAG, "Sending OFF code");
-    code_to_send = CODE_OFF; // Make sure CODE_OFF is defined above!
-    // Check if CODE_OFF is actually defined before calculating size
-    if (code_to_send != nullptr) {
-        code_len = sizeof(CODE_OFF) / sizeof(CODE_OFF[0]);
-    }
+    found = this->transmit_first_({state_key(climate::CLIMATE_MODE_OFF, ir_common::CODEBOOK_ANY, 0)});
   }
 
   // --- 2. Check for FAN ONLY state ---
@@ -153,105 +327,42 @@ void RawACClimate::send_ir_code_() {
         return;
     }
     ESP_LOGD(TAG, "Sending FAN ONLY code: %s", climate_fan_mode_to_string(this->fan_mode.value()));
-    switch (*this->fan_mode) {
-      case climate::CLIMATE_FAN_LOW:
-        code_to_send = CODE_FAN_LOW; // Make sure this is defined above!
-        code_len = sizeof(CODE_FAN_LOW) / sizeof(CODE_FAN_LOW[0]);
-        break;
-      case climate::CLIMATE_FAN_MEDIUM:
-        code_to_send = CODE_FAN_MEDIUM; // Make sure this is defined above!
-        code_len = sizeof(CODE_FAN_MEDIUM) / sizeof(CODE_FAN_MEDIUM[0]);
-        break;
-      case climate::CLIMATE_FAN_HIGH:
-      default:
-        code_to_send = CODE_FAN_HIGH; // Make sure this is defined above!
-        code_len = sizeof(CODE_FAN_HIGH) / sizeof(CODE_FAN_HIGH[0]);
-        break;
-    }
+    // Fan speeds without a captured code fall back to HIGH
+    found = this->transmit_first_({state_key(climate::CLIMATE_MODE_FAN_ONLY, *this->fan_mode, 0),
+                                   state_key(climate::CLIMATE_MODE_FAN_ONLY, climate::CLIMATE_FAN_HIGH, 0)});
   }
 
   // --- 3. Check for COOL state ---
   else if (this->mode == climate::CLIMATE_MODE_COOL) {
-    // --- FIX: Remove .has_value() check for target_temperature ---
     if (!this->fan_mode.has_value()) {
         ESP_LOGW(TAG, "Fan mode not set, cannot send COOL command.");
         return;
     }
-    // --- FIX: Remove the '*' operator from target_temperature ---
-    int temp = (int)roundf(this->target_temperature); // Just use it directly
+    int temp = (int)roundf(this->target_temperature);
 
     ESP_LOGD(TAG, "Sending COOL code: %d°C, Fan: %s", temp, climate_fan_mode_to_string(this->fan_mode.value()));
 
-    switch (temp) {
-      case 22:
-        switch (*this->fan_mode) { // Still need * for fan_mode
-          case climate::CLIMATE_FAN_LOW:    code_to_send = CODE_COOL_22_LOW;    code_len = sizeof(CODE_COOL_22_LOW) / sizeof(CODE_COOL_22_LOW[0]); break;
-          case climate::CLIMATE_FAN_MEDIUM: code_to_send = CODE_COOL_22_MEDIUM; code_len = sizeof(CODE_COOL_22_MEDIUM) / sizeof(CODE_COOL_22_MEDIUM[0]); break;
-          case climate::CLIMATE_FAN_HIGH:   code_to_send = CODE_COOL_22_HIGH;   code_len = sizeof(CODE_COOL_22_HIGH) / sizeof(CODE_COOL_22_HIGH[0]); break;
-          default:                          code_to_send = CODE_COOL_22_AUTO;   code_len = sizeof(CODE_COOL_22_AUTO) / sizeof(CODE_COOL_22_AUTO[0]); break;
-        }
-        break;
-
-      case 23:
-        switch (*this->fan_mode) { // Still need * for fan_mode
-          case climate::CLIMATE_FAN_LOW:    code_to_send = CODE_COOL_23_LOW;    code_len = sizeof(CODE_COOL_23_LOW) / sizeof(CODE_COOL_23_LOW[0]); break;
-          case climate::CLIMATE_FAN_MEDIUM: code_to_send = CODE_COOL_23_MEDIUM; code_len = sizeof(CODE_COOL_23_MEDIUM) / sizeof(CODE_COOL_23_MEDIUM[0]); break;
-          case climate::CLIMATE_FAN_HIGH:   code_to_send = CODE_COOL_23_HIGH;   code_len = sizeof(CODE_COOL_23_HIGH) / sizeof(CODE_COOL_23_HIGH[0]); break;
-          default:                          code_to_send = CODE_COOL_23_AUTO;   code_len = sizeof(CODE_COOL_23_AUTO) / sizeof(CODE_COOL_23_AUTO[0]); break;
-        }
-        break;
-
-      case 24:
-        switch (*this->fan_mode) { // Still need * for fan_mode
-          case climate::CLIMATE_FAN_LOW:    code_to_send = CODE_COOL_24_LOW;    code_len = sizeof(CODE_COOL_24_LOW) / sizeof(CODE_COOL_24_LOW[0]); break;
-          case climate::CLIMATE_FAN_MEDIUM: code_to_send = CODE_COOL_24_MEDIUM; code_len = sizeof(CODE_COOL_24_MEDIUM) / sizeof(CODE_COOL_24_MEDIUM[0]); break;
-          case climate::CLIMATE_FAN_HIGH:   code_to_send = CODE_COOL_24_HIGH;   code_len = sizeof(CODE_COOL_24_HIGH) / sizeof(CODE_COOL_24_HIGH[0]); break;
-          default:                          code_to_send = CODE_COOL_24_AUTO;   code_len = sizeof(CODE_COOL_24_AUTO) / sizeof(CODE_COOL_24_AUTO[0]); break;
-        }
-        break;
-
-      case 25:
-        switch (*this->fan_mode) { // Still need * for fan_mode
-          case climate::CLIMATE_FAN_LOW:    code_to_send = CODE_COOL_25_LOW;    code_len = sizeof(CODE_COOL_25_LOW) / sizeof(CODE_COOL_25_LOW[0]); break;
-          case climate::CLIMATE_FAN_MEDIUM: code_to_send = CODE_COOL_25_MEDIUM; code_len = sizeof(CODE_COOL_25_MEDIUM) / sizeof(CODE_COOL_25_MEDIUM[0]); break;
-          case climate::CLIMATE_FAN_HIGH:   code_to_send = CODE_COOL_25_HIGH;   code_len = sizeof(CODE_COOL_25_HIGH) / sizeof(CODE_COOL_25_HIGH[0]); break;
-          default:                          code_to_send = CODE_COOL_25_AUTO;   code_len = sizeof(CODE_COOL_25_AUTO) / sizeof(CODE_COOL_25_AUTO[0]); break;
-        }
-        break;
-
-      case 26:
-        switch (*this->fan_mode) { // Still need * for fan_mode
-          case climate::CLIMATE_FAN_LOW:    code_to_send = CODE_COOL_26_LOW;    code_len = sizeof(CODE_COOL_26_LOW) / sizeof(CODE_COOL_26_LOW[0]); break;
-          case climate::CLIMATE_FAN_MEDIUM: code_to_send = CODE_COOL_26_MEDIUM; code_len = sizeof(CODE_COOL_26_MEDIUM) / sizeof(CODE_COOL_26_MEDIUM[0]); break;
-          case climate::CLIMATE_FAN_HIGH:   code_to_send = CODE_COOL_26_HIGH;   code_len = sizeof(CODE_COOL_26_HIGH) / sizeof(CODE_COOL_26_HIGH[0]); break;
-          default:                          code_to_send = CODE_COOL_26_AUTO;   code_len = sizeof(CODE_COOL_26_AUTO) / sizeof(CODE_COOL_26_AUTO[0]); break;
-        }
-        break;
-
-      case 27:
-        switch (*this->fan_mode) { // Still need * for fan_mode
-          case climate::CLIMATE_FAN_LOW:    code_to_send = CODE_COOL_27_LOW;    code_len = sizeof(CODE_COOL_27_LOW) / sizeof(CODE_COOL_27_LOW[0]); break;
-          case climate::CLIMATE_FAN_MEDIUM: code_to_send = CODE_COOL_27_MEDIUM; code_len = sizeof(CODE_COOL_27_MEDIUM) / sizeof(CODE_COOL_27_MEDIUM[0]); break;
-          case climate::CLIMATE_FAN_HIGH:   code_to_send = CODE_COOL_27_HIGH;   code_len = sizeof(CODE_COOL_27_HIGH) / sizeof(CODE_COOL_27_HIGH[0]); break;
-          default:                          code_to_send = CODE_COOL_27_AUTO;   code_len = sizeof(CODE_COOL_27_AUTO) / sizeof(CODE_COOL_27_AUTO[0]); break;
-        }
-        break;
-
-      default:
-        ESP_LOGW(TAG, "Temperature %d°C not supported. Sending 24°C/Auto.", temp);
-        code_to_send = CODE_COOL_24_AUTO;
-        code_len = sizeof(CODE_COOL_24_AUTO) / sizeof(CODE_COOL_24_AUTO[0]);
-        break;
+    // Unknown fan speeds use AUTO; unsupported temperatures send 24°C/Auto
+    found = this->transmit_first_({state_key(climate::CLIMATE_MODE_COOL, *this->fan_mode, temp),
+                                   state_key(climate::CLIMATE_MODE_COOL, climate::CLIMATE_FAN_AUTO, temp)});
+    if (!found) {
+      ESP_LOGW(TAG, "Temperature %d°C not supported. Sending 24°C/Auto.", temp);
+      found = this->transmit_first_({state_key(climate::CLIMATE_MODE_COOL, climate::CLIMATE_FAN_AUTO, 24)});
     }
   }
 
-  // --- 4. Transmit the selected code ---
-  if (code_to_send != nullptr && code_len > 0) {
-    this->transmit_raw_code_(code_to_send, code_len);
-  } else {
+  // --- 4. Other modes only exist as learned codes ---
+  else {
+    climate::ClimateFanMode fan = this->fan_mode.value_or(climate::CLIMATE_FAN_AUTO);
+    ESP_LOGD(TAG, "Sending learned %s code: %.1f°C", climate_mode_to_string(this->mode), this->target_temperature);
+    found = this->transmit_first_({state_key(this->mode, fan, this->target_temperature),
+                                   state_key(this->mode, climate::CLIMATE_FAN_AUTO, this->target_temperature)});
+  }
+
+  if (!found) {
     ESP_LOGE(TAG, "Could not find a matching IR code for the current state!");
   }
 }
 
 }  // namespace raw_ac
-}  // namespace esphome
\ No newline at end of file
+}  // namespace esphome
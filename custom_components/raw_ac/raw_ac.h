@@ -4,17 +4,38 @@
 #include "esphome/components/climate/climate.h"
 #include "esphome/components/remote_transmitter/remote_transmitter.h"
 #include "esphome/components/sensor/sensor.h"
+#include "esphome/components/remote_receiver/remote_receiver.h"
+#include "esphome/components/ir_common/configured_traits.h"
+#include "esphome/components/ir_common/ac_state.h"
+#include "esphome/components/ir_common/alloc_stats.h"
+#include "esphome/components/ir_common/loop_budget.h"
+#include "esphome/components/ir_common/codebook.h"
+#include "esphome/components/ir_common/learned_codebook.h"
+#include "esphome/components/ir_common/frame_matcher.h"
+#include "esphome/components/ir_common/publish_gate.h"
+#include "esphome/components/ir_common/state_store.h"
+#include <initializer_list>
+#include <string>
 
 namespace esphome {
 namespace raw_ac {
 
-class RawACClimate : public climate::Climate, public Component {
+class RawACClimate : public climate::Climate,
+                     public Component,
+                     public remote_base::RemoteReceiverListener,
+                     public ir_common::ConfiguredTraits {
  public:
   // --- Setter functions called by Python ---
   void set_transmitter(remote_transmitter::RemoteTransmitterComponent *transmitter) {
     this->transmitter_ = transmitter;
   }
   void set_sensor(sensor::Sensor *sensor) { this->sensor_ = sensor; }
+  void set_flash_write_delay(uint32_t delay) { this->state_store_.set_flash_delay(delay); }
+  void set_receiver(remote_receiver::RemoteReceiverComponent *receiver) { this->receiver_ = receiver; }
+  void set_learn_slots(uint8_t slots) { this->learn_slots_ = slots; }
+  void set_learn_timeout(uint32_t timeout) { this->learn_timeout_ = timeout; }
+  void set_min_publish_interval(uint32_t interval) { this->publish_gate_.set_min_interval(interval); }
+  void set_current_temperature_deadband(float deadband) { this->publish_gate_.set_temperature_deadband(deadband); }
 
   // --- Functions we MUST override ---
   
@@ -28,18 +49,53 @@ class RawACClimate : public climate::Climate, public Component {
   void setup() override;
   void dump_config() override;
 
+  // Receives frames from the physical remote: learns them while learning,
+  // otherwise matches them against the codebooks and publishes the state
+  bool on_receive(remote_base::RemoteReceiveData data) override;
+
+  // --- Learning mode (raw_ac.learn / raw_ac.clear_learned actions) ---
+  // Arms capture of the next frame for the given state. Names are the
+  // ESPHome enum names ("COOL", "FAN_ONLY", "LOW", ...), case-insensitive.
+  void start_learning(const std::string &mode, const std::string &fan_mode, float temperature);
+  void clear_learned();
+
  protected:
   // --- Our Helper Functions ---
   
   // Sends the correct IR code based on the current internal state
   void send_ir_code_();
 
-  // Helper to physically send the raw code
-  void transmit_raw_code_(const int32_t *data, size_t len);
+  // Sends the first key found, learned codes before the built-in codebook
+  bool transmit_first_(std::initializer_list<uint32_t> keys);
+
+  // Helpers to physically send a raw code from either codebook
+  void transmit_record_(const ir_common::CodebookRecord &record);
+  void transmit_learned_(const ir_common::QuantisedFrame &frame);
+  template<typename TimingAt> void transmit_timings_(size_t length, TimingAt timing_at);
+
+  // Publishes now, after the rate limit, or not at all (see PublishGate)
+  void publish_changes_();
+
+  void extend_traits_(climate::ClimateTraits &traits) override;
+
+  // Rebuilds the receive matcher after the learned codebook changes
+  void rebuild_matcher_();
+  bool learn_capture_(const remote_base::RawTimings &raw);
+  bool match_capture_(const remote_base::RawTimings &raw);
 
   // --- Member Variables ---
   remote_transmitter::RemoteTransmitterComponent *transmitter_{nullptr};
   sensor::Sensor *sensor_{nullptr};
+  ir_common::StateStore state_store_;
+  remote_receiver::RemoteReceiverComponent *receiver_{nullptr};
+  ir_common::PublishGate publish_gate_;
+
+  ir_common::LearnedCodebook learned_;
+  ir_common::FrameMatcher matcher_;
+  uint8_t learn_slots_{4};
+  uint32_t learn_timeout_{30000};
+  bool learning_{false};
+  uint32_t learn_key_{0};
 };
 
 }  // namespace raw_ac
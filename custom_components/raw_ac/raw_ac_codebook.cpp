@@ -0,0 +1,828 @@
+// Generated by tools/gen_codebook.py from codebooks/raw_ac.json -- do not edit.
+// 28 codes, 13022 bytes.
+#include "raw_ac_codebook.h"
+#include "esphome/core/hal.h"
+
+namespace esphome {
+namespace raw_ac {
+
+const uint8_t RAW_AC_CODEBOOK[] PROGMEM = {
+    0x49, 0x52, 0x43, 0x42, 0x01, 0x00, 0x1C, 0x00, 0x07, 0x00, 0xD0, 0x01, 0x26, 0x00, 0xE3, 0x00,
+    0x06, 0x00, 0x0F, 0x00, 0x15, 0x00, 0x02, 0x00, 0x03, 0x00, 0x63, 0x00, 0x25, 0x00, 0x02, 0x02,
+    0x34, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x6D, 0x0D, 0x41, 0xF9, 0xBE, 0x01, 0x02, 0xFB, 0xA4, 0x01,
+    0xEF, 0xFA, 0xA5, 0x01, 0x43, 0xFE, 0xAB, 0x01, 0x4A, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xBB, 0x01,
+    0xFF, 0xFA, 0xA7, 0x01, 0x43, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x03, 0xFB, 0xA6, 0x01,
+    0x09, 0xFB, 0xD3, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0xF2, 0xFA, 0xA7, 0x01, 0x4A, 0xFE, 0xC1, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x09, 0xFB, 0xD4, 0x01, 0x01, 0xFB, 0xA2, 0x01, 0x41, 0xFE, 0xA4, 0x01,
+    0xED, 0xFA, 0xB7, 0x01, 0x17, 0xFB, 0xBE, 0x01, 0x44, 0xFE, 0xA4, 0x01, 0x44, 0xFE, 0xA7, 0x01,
+    0x03, 0xFB, 0xBD, 0x01, 0x46, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEB, 0xFA, 0xA3, 0x01,
+    0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBF, 0x01,
+    0x5F, 0xFE, 0xBF, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xBC, 0x01, 0x5A, 0xFE, 0xC0, 0x01,
+    0x5A, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xBB, 0x01, 0x00, 0xFB, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0xFC, 0xFA, 0xA3, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEF, 0xFA, 0xA7, 0x01, 0xEE, 0xFA, 0xBA, 0x01,
+    0x15, 0xFB, 0xBF, 0x01, 0x4C, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA9, 0x01,
+    0xF2, 0xFA, 0xA7, 0x01, 0xEF, 0xFA, 0xA6, 0x01, 0x4B, 0xFE, 0xBD, 0x01, 0x5D, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xA8, 0x01, 0x46, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01,
+    0x4A, 0xFE, 0xBC, 0x01, 0x57, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xC0, 0x01,
+    0x60, 0xFE, 0xBF, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xA7, 0x01,
+    0x60, 0xFE, 0xD4, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA7, 0x01,
+    0x4B, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xBC, 0x01, 0x59, 0xFE, 0xBE, 0x01, 0x5E, 0xFE, 0xBF, 0x01,
+    0x58, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBE, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBD, 0x01,
+    0x59, 0xFE, 0xB8, 0x01, 0x5B, 0xFE, 0xA7, 0x01, 0x45, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x42, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xA7, 0x01,
+    0xEE, 0xFA, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA7, 0x01, 0xED, 0xFA, 0xA6, 0x01, 0xEE, 0xFA, 0xA7, 0x01, 0x00, 0x00, 0x02, 0x05,
+    0x36, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x6D, 0x0D, 0x41, 0xF9, 0xBE, 0x01, 0x02, 0xFB, 0xA4, 0x01,
+    0xEF, 0xFA, 0xA5, 0x01, 0x43, 0xFE, 0xAB, 0x01, 0x4A, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xBB, 0x01,
+    0xFF, 0xFA, 0xA7, 0x01, 0x43, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x03, 0xFB, 0xA6, 0x01,
+    0x09, 0xFB, 0xD3, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0xF2, 0xFA, 0xA7, 0x01, 0x4A, 0xFE, 0xC1, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x09, 0xFB, 0xD4, 0x01, 0x01, 0xFB, 0xA2, 0x01, 0x41, 0xFE, 0xA4, 0x01,
+    0xED, 0xFA, 0xB7, 0x01, 0x17, 0xFB, 0xBE, 0x01, 0x44, 0xFE, 0xA4, 0x01, 0x44, 0xFE, 0xA7, 0x01,
+    0x03, 0xFB, 0xBD, 0x01, 0x46, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEB, 0xFA, 0xA3, 0x01,
+    0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBF, 0x01,
+    0x5F, 0xFE, 0xBF, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xBC, 0x01, 0x5A, 0xFE, 0xC0, 0x01,
+    0x5A, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xBB, 0x01, 0x00, 0xFB, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0xFC, 0xFA, 0xA3, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEF, 0xFA, 0xA7, 0x01, 0xEE, 0xFA, 0xBA, 0x01,
+    0x15, 0xFB, 0xBF, 0x01, 0x4C, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA9, 0x01,
+    0xF2, 0xFA, 0xA7, 0x01, 0xEF, 0xFA, 0xA6, 0x01, 0x4B, 0xFE, 0xBD, 0x01, 0x5D, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xA8, 0x01, 0x46, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01,
+    0x4A, 0xFE, 0xBC, 0x01, 0x57, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xC0, 0x01,
+    0x60, 0xFE, 0xBF, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xA7, 0x01,
+    0x60, 0xFE, 0xD4, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA7, 0x01,
+    0x4B, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xBC, 0x01, 0x59, 0xFE, 0xBE, 0x01, 0x5E, 0xFE, 0xBF, 0x01,
+    0x58, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBE, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBD, 0x01,
+    0x59, 0xFE, 0xB8, 0x01, 0x5B, 0xFE, 0xA7, 0x01, 0x45, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x42, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xA7, 0x01,
+    0xEE, 0xFA, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA7, 0x01, 0xED, 0xFA, 0xA6, 0x01, 0xEE, 0xFA, 0xA7, 0x01, 0x00, 0x00, 0x02, 0x04,
+    0x2E, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x6D, 0x0D, 0x41, 0xF9, 0xBE, 0x01, 0x02, 0xFB, 0xA4, 0x01,
+    0xEF, 0xFA, 0xA5, 0x01, 0x43, 0xFE, 0xAB, 0x01, 0x4A, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xBB, 0x01,
+    0xFF, 0xFA, 0xA7, 0x01, 0x43, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x03, 0xFB, 0xA6, 0x01,
+    0x09, 0xFB, 0xD3, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0xF2, 0xFA, 0xA7, 0x01, 0x4A, 0xFE, 0xC1, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x09, 0xFB, 0xD4, 0x01, 0x01, 0xFB, 0xA2, 0x01, 0x41, 0xFE, 0xA4, 0x01,
+    0xED, 0xFA, 0xB7, 0x01, 0x17, 0xFB, 0xBE, 0x01, 0x44, 0xFE, 0xA4, 0x01, 0x44, 0xFE, 0xA7, 0x01,
+    0x03, 0xFB, 0xBD, 0x01, 0x46, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEB, 0xFA, 0xA3, 0x01,
+    0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBF, 0x01,
+    0x5F, 0xFE, 0xBF, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xBC, 0x01, 0x5A, 0xFE, 0xC0, 0x01,
+    0x5A, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xBB, 0x01, 0x00, 0xFB, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0xFC, 0xFA, 0xA3, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEF, 0xFA, 0xA7, 0x01, 0xEE, 0xFA, 0xBA, 0x01,
+    0x15, 0xFB, 0xBF, 0x01, 0x4C, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA9, 0x01,
+    0xF2, 0xFA, 0xA7, 0x01, 0xEF, 0xFA, 0xA6, 0x01, 0x4B, 0xFE, 0xBD, 0x01, 0x5D, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xA8, 0x01, 0x46, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01,
+    0x4A, 0xFE, 0xBC, 0x01, 0x57, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xC0, 0x01,
+    0x60, 0xFE, 0xBF, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xA7, 0x01,
+    0x60, 0xFE, 0xD4, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA7, 0x01,
+    0x4B, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xBC, 0x01, 0x59, 0xFE, 0xBE, 0x01, 0x5E, 0xFE, 0xBF, 0x01,
+    0x58, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBE, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBD, 0x01,
+    0x59, 0xFE, 0xB8, 0x01, 0x5B, 0xFE, 0xA7, 0x01, 0x45, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x42, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xA7, 0x01,
+    0xEE, 0xFA, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA7, 0x01, 0xED, 0xFA, 0xA6, 0x01, 0xEE, 0xFA, 0xA7, 0x01, 0x00, 0x00, 0x02, 0x04,
+    0x30, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x6D, 0x0D, 0x41, 0xF9, 0xBE, 0x01, 0x02, 0xFB, 0xA4, 0x01,
+    0xEF, 0xFA, 0xA5, 0x01, 0x43, 0xFE, 0xAB, 0x01, 0x4A, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xBB, 0x01,
+    0xFF, 0xFA, 0xA7, 0x01, 0x43, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x03, 0xFB, 0xA6, 0x01,
+    0x09, 0xFB, 0xD3, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0xF2, 0xFA, 0xA7, 0x01, 0x4A, 0xFE, 0xC1, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x09, 0xFB, 0xD4, 0x01, 0x01, 0xFB, 0xA2, 0x01, 0x41, 0xFE, 0xA4, 0x01,
+    0xED, 0xFA, 0xB7, 0x01, 0x17, 0xFB, 0xBE, 0x01, 0x44, 0xFE, 0xA4, 0x01, 0x44, 0xFE, 0xA7, 0x01,
+    0x03, 0xFB, 0xBD, 0x01, 0x46, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEB, 0xFA, 0xA3, 0x01,
+    0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBF, 0x01,
+    0x5F, 0xFE, 0xBF, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xBC, 0x01, 0x5A, 0xFE, 0xC0, 0x01,
+    0x5A, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xBB, 0x01, 0x00, 0xFB, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0xFC, 0xFA, 0xA3, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEF, 0xFA, 0xA7, 0x01, 0xEE, 0xFA, 0xBA, 0x01,
+    0x15, 0xFB, 0xBF, 0x01, 0x4C, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA9, 0x01,
+    0xF2, 0xFA, 0xA7, 0x01, 0xEF, 0xFA, 0xA6, 0x01, 0x4B, 0xFE, 0xBD, 0x01, 0x5D, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xA8, 0x01, 0x46, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01,
+    0x4A, 0xFE, 0xBC, 0x01, 0x57, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xC0, 0x01,
+    0x60, 0xFE, 0xBF, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xA7, 0x01,
+    0x60, 0xFE, 0xD4, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA7, 0x01,
+    0x4B, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xBC, 0x01, 0x59, 0xFE, 0xBE, 0x01, 0x5E, 0xFE, 0xBF, 0x01,
+    0x58, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBE, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBD, 0x01,
+    0x59, 0xFE, 0xB8, 0x01, 0x5B, 0xFE, 0xA7, 0x01, 0x45, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x42, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xA7, 0x01,
+    0xEE, 0xFA, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA7, 0x01, 0xED, 0xFA, 0xA6, 0x01, 0xEE, 0xFA, 0xA7, 0x01, 0x00, 0x00, 0x02, 0x05,
+    0x32, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x6D, 0x0D, 0x41, 0xF9, 0xBE, 0x01, 0x02, 0xFB, 0xA4, 0x01,
+    0xEF, 0xFA, 0xA5, 0x01, 0x43, 0xFE, 0xAB, 0x01, 0x4A, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xBB, 0x01,
+    0xFF, 0xFA, 0xA7, 0x01, 0x43, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x03, 0xFB, 0xA6, 0x01,
+    0x09, 0xFB, 0xD3, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0xF2, 0xFA, 0xA7, 0x01, 0x4A, 0xFE, 0xC1, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x09, 0xFB, 0xD4, 0x01, 0x01, 0xFB, 0xA2, 0x01, 0x41, 0xFE, 0xA4, 0x01,
+    0xED, 0xFA, 0xB7, 0x01, 0x17, 0xFB, 0xBE, 0x01, 0x44, 0xFE, 0xA4, 0x01, 0x44, 0xFE, 0xA7, 0x01,
+    0x03, 0xFB, 0xBD, 0x01, 0x46, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEB, 0xFA, 0xA3, 0x01,
+    0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBF, 0x01,
+    0x5F, 0xFE, 0xBF, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xBC, 0x01, 0x5A, 0xFE, 0xC0, 0x01,
+    0x5A, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xBB, 0x01, 0x00, 0xFB, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0xFC, 0xFA, 0xA3, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEF, 0xFA, 0xA7, 0x01, 0xEE, 0xFA, 0xBA, 0x01,
+    0x15, 0xFB, 0xBF, 0x01, 0x4C, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA9, 0x01,
+    0xF2, 0xFA, 0xA7, 0x01, 0xEF, 0xFA, 0xA6, 0x01, 0x4B, 0xFE, 0xBD, 0x01, 0x5D, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xA8, 0x01, 0x46, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01,
+    0x4A, 0xFE, 0xBC, 0x01, 0x57, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xC0, 0x01,
+    0x60, 0xFE, 0xBF, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xA7, 0x01,
+    0x60, 0xFE, 0xD4, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA7, 0x01,
+    0x4B, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xBC, 0x01, 0x59, 0xFE, 0xBE, 0x01, 0x5E, 0xFE, 0xBF, 0x01,
+    0x58, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBE, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBD, 0x01,
+    0x59, 0xFE, 0xB8, 0x01, 0x5B, 0xFE, 0xA7, 0x01, 0x45, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x42, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xA7, 0x01,
+    0xEE, 0xFA, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA7, 0x01, 0xED, 0xFA, 0xA6, 0x01, 0xEE, 0xFA, 0xA7, 0x01, 0x00, 0x00, 0x04, 0x04,
+    0x00, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x6D, 0x0D, 0x41, 0xF9, 0xBE, 0x01, 0x02, 0xFB, 0xA4, 0x01,
+    0xEF, 0xFA, 0xA5, 0x01, 0x43, 0xFE, 0xAB, 0x01, 0x4A, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xBB, 0x01,
+    0xFF, 0xFA, 0xA7, 0x01, 0x43, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x03, 0xFB, 0xA6, 0x01,
+    0x09, 0xFB, 0xD3, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0xF2, 0xFA, 0xA7, 0x01, 0x4A, 0xFE, 0xC1, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x09, 0xFB, 0xD4, 0x01, 0x01, 0xFB, 0xA2, 0x01, 0x41, 0xFE, 0xA4, 0x01,
+    0xED, 0xFA, 0xB7, 0x01, 0x17, 0xFB, 0xBE, 0x01, 0x44, 0xFE, 0xA4, 0x01, 0x44, 0xFE, 0xA7, 0x01,
+    0x03, 0xFB, 0xBD, 0x01, 0x46, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEB, 0xFA, 0xA3, 0x01,
+    0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBF, 0x01,
+    0x5F, 0xFE, 0xBF, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xBC, 0x01, 0x5A, 0xFE, 0xC0, 0x01,
+    0x5A, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xBB, 0x01, 0x00, 0xFB, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0xFC, 0xFA, 0xA3, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEF, 0xFA, 0xA7, 0x01, 0xEE, 0xFA, 0xBA, 0x01,
+    0x15, 0xFB, 0xBF, 0x01, 0x4C, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA9, 0x01,
+    0xF2, 0xFA, 0xA7, 0x01, 0xEF, 0xFA, 0xA6, 0x01, 0x4B, 0xFE, 0xBD, 0x01, 0x5D, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xA8, 0x01, 0x46, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01,
+    0x4A, 0xFE, 0xBC, 0x01, 0x57, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xC0, 0x01,
+    0x60, 0xFE, 0xBF, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xA7, 0x01,
+    0x60, 0xFE, 0xD4, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA7, 0x01,
+    0x4B, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xBC, 0x01, 0x59, 0xFE, 0xBE, 0x01, 0x5E, 0xFE, 0xBF, 0x01,
+    0x58, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBE, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBD, 0x01,
+    0x59, 0xFE, 0xB8, 0x01, 0x5B, 0xFE, 0xA7, 0x01, 0x45, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x42, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xA7, 0x01,
+    0xEE, 0xFA, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA7, 0x01, 0xED, 0xFA, 0xA6, 0x01, 0xEE, 0xFA, 0xA7, 0x01, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x87, 0x0D, 0x58, 0xF9, 0xBA, 0x01, 0x02, 0xFB, 0xA6, 0x01,
+    0xEF, 0xFA, 0xA6, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBB, 0x01,
+    0xFE, 0xFA, 0xA7, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xBB, 0x01, 0x03, 0xFB, 0xA7, 0x01,
+    0xF1, 0xFA, 0xBA, 0x01, 0x5B, 0xFE, 0xA7, 0x01, 0xF1, 0xFA, 0xAB, 0x01, 0x4B, 0xFE, 0xBB, 0x01,
+    0x58, 0xFE, 0xA6, 0x01, 0xEE, 0xFA, 0xBA, 0x01, 0x19, 0xFB, 0xC1, 0x01, 0x4B, 0xFE, 0xA7, 0x01,
+    0x06, 0xFB, 0xD2, 0x01, 0x00, 0xFB, 0xB9, 0x01, 0x58, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xBB, 0x01,
+    0xFE, 0xFA, 0xA6, 0x01, 0x4A, 0xFE, 0xBC, 0x01, 0x59, 0xFE, 0xA7, 0x01, 0x05, 0xFB, 0xBB, 0x01,
+    0x4A, 0xFE, 0xBB, 0x01, 0x6C, 0xFE, 0xD3, 0x01, 0x5D, 0xFE, 0xBD, 0x01, 0x5B, 0xFE, 0xBB, 0x01,
+    0x5A, 0xFE, 0x0D, 0x02, 0xA9, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xBD, 0x01, 0x5B, 0xFE, 0xBF, 0x01,
+    0x5C, 0xFE, 0xBD, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xBB, 0x01, 0x6F, 0xFE, 0xBE, 0x01, 0x4A, 0xFE, 0xBC, 0x01, 0x5B, 0xFE, 0xBB, 0x01,
+    0x5B, 0xFE, 0xBC, 0x01, 0x57, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xA8, 0x01,
+    0xF1, 0xFA, 0xA6, 0x01, 0x5A, 0xFE, 0xD0, 0x01, 0x00, 0xFB, 0xBC, 0x01, 0x04, 0xFB, 0xBE, 0x01,
+    0x01, 0xFB, 0x38, 0x02, 0xD3, 0xFE, 0xA5, 0x01, 0x49, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBB, 0x01,
+    0x6D, 0xFE, 0xD6, 0x01, 0x5F, 0xFE, 0xBC, 0x01, 0x5A, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA8, 0x01,
+    0x05, 0xFB, 0xD3, 0x01, 0xFF, 0xFA, 0xA7, 0x01, 0x4A, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xBB, 0x01,
+    0x59, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xBB, 0x01, 0x5B, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xBB, 0x01,
+    0x5B, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xA9, 0x01, 0x46, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xA8, 0x01,
+    0x45, 0xFE, 0xBB, 0x01, 0x59, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x59, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xBB, 0x01, 0x5A, 0xFE, 0xBB, 0x01, 0x5B, 0xFE, 0xBB, 0x01, 0x56, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA7, 0x01, 0x5F, 0xFE, 0xD5, 0x01, 0x5B, 0xFE, 0xBA, 0x01,
+    0x57, 0xFE, 0xBD, 0x01, 0x5C, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xBD, 0x01, 0x5C, 0xFE, 0xBD, 0x01,
+    0x56, 0xFE, 0xA6, 0x01, 0x43, 0xFE, 0xB8, 0x01, 0x59, 0xFE, 0xBF, 0x01, 0x5C, 0xFE, 0xBC, 0x01,
+    0x59, 0xFE, 0xA6, 0x01, 0x48, 0xFE, 0xA7, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xBB, 0x01,
+    0x58, 0xFE, 0xA7, 0x01, 0x60, 0xFE, 0xBE, 0x01, 0x47, 0xFE, 0xBB, 0x01, 0x5B, 0xFE, 0xBF, 0x01,
+    0x5A, 0xFE, 0xA8, 0x01, 0x5D, 0xFE, 0xBD, 0x01, 0x49, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0x5A, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xBC, 0x01, 0x5B, 0xFE, 0xBC, 0x01, 0x58, 0xFE, 0xBD, 0x01,
+    0x04, 0xFB, 0xBA, 0x01, 0xFE, 0xFA, 0xBB, 0x01, 0x01, 0xFB, 0xA7, 0x01, 0xEC, 0xFA, 0xB9, 0x01,
+    0x17, 0xFB, 0xBD, 0x01, 0x47, 0xFE, 0xA5, 0x01, 0xF1, 0xFA, 0xBE, 0x01, 0x00, 0x00, 0x04, 0x05,
+    0x00, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x6D, 0x0D, 0x41, 0xF9, 0xBE, 0x01, 0x02, 0xFB, 0xA4, 0x01,
+    0xEF, 0xFA, 0xA5, 0x01, 0x43, 0xFE, 0xAB, 0x01, 0x4A, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xBB, 0x01,
+    0xFF, 0xFA, 0xA7, 0x01, 0x43, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x03, 0xFB, 0xA6, 0x01,
+    0x09, 0xFB, 0xD3, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0xF2, 0xFA, 0xA7, 0x01, 0x4A, 0xFE, 0xC1, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x09, 0xFB, 0xD4, 0x01, 0x01, 0xFB, 0xA2, 0x01, 0x41, 0xFE, 0xA4, 0x01,
+    0xED, 0xFA, 0xB7, 0x01, 0x17, 0xFB, 0xBE, 0x01, 0x44, 0xFE, 0xA4, 0x01, 0x44, 0xFE, 0xA7, 0x01,
+    0x03, 0xFB, 0xBD, 0x01, 0x46, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEB, 0xFA, 0xA3, 0x01,
+    0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBF, 0x01,
+    0x5F, 0xFE, 0xBF, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xBC, 0x01, 0x5A, 0xFE, 0xC0, 0x01,
+    0x5A, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xBB, 0x01, 0x00, 0xFB, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0xFC, 0xFA, 0xA3, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEF, 0xFA, 0xA7, 0x01, 0xEE, 0xFA, 0xBA, 0x01,
+    0x15, 0xFB, 0xBF, 0x01, 0x4C, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA9, 0x01,
+    0xF2, 0xFA, 0xA7, 0x01, 0xEF, 0xFA, 0xA6, 0x01, 0x4B, 0xFE, 0xBD, 0x01, 0x5D, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xA8, 0x01, 0x46, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01,
+    0x4A, 0xFE, 0xBC, 0x01, 0x57, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xC0, 0x01,
+    0x60, 0xFE, 0xBF, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xA7, 0x01,
+    0x60, 0xFE, 0xD4, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA7, 0x01,
+    0x4B, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xBC, 0x01, 0x59, 0xFE, 0xBE, 0x01, 0x5E, 0xFE, 0xBF, 0x01,
+    0x58, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBE, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBD, 0x01,
+    0x59, 0xFE, 0xB8, 0x01, 0x5B, 0xFE, 0xA7, 0x01, 0x45, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x42, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xA7, 0x01,
+    0xEE, 0xFA, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA7, 0x01, 0xED, 0xFA, 0xA6, 0x01, 0xEE, 0xFA, 0xA7, 0x01, 0x00, 0x00, 0x02, 0x03,
+    0x2E, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x6D, 0x0D, 0x41, 0xF9, 0xBE, 0x01, 0x02, 0xFB, 0xA4, 0x01,
+    0xEF, 0xFA, 0xA5, 0x01, 0x43, 0xFE, 0xAB, 0x01, 0x4A, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xBB, 0x01,
+    0xFF, 0xFA, 0xA7, 0x01, 0x43, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x03, 0xFB, 0xA6, 0x01,
+    0x09, 0xFB, 0xD3, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0xF2, 0xFA, 0xA7, 0x01, 0x4A, 0xFE, 0xC1, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x09, 0xFB, 0xD4, 0x01, 0x01, 0xFB, 0xA2, 0x01, 0x41, 0xFE, 0xA4, 0x01,
+    0xED, 0xFA, 0xB7, 0x01, 0x17, 0xFB, 0xBE, 0x01, 0x44, 0xFE, 0xA4, 0x01, 0x44, 0xFE, 0xA7, 0x01,
+    0x03, 0xFB, 0xBD, 0x01, 0x46, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEB, 0xFA, 0xA3, 0x01,
+    0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBF, 0x01,
+    0x5F, 0xFE, 0xBF, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xBC, 0x01, 0x5A, 0xFE, 0xC0, 0x01,
+    0x5A, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xBB, 0x01, 0x00, 0xFB, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0xFC, 0xFA, 0xA3, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEF, 0xFA, 0xA7, 0x01, 0xEE, 0xFA, 0xBA, 0x01,
+    0x15, 0xFB, 0xBF, 0x01, 0x4C, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA9, 0x01,
+    0xF2, 0xFA, 0xA7, 0x01, 0xEF, 0xFA, 0xA6, 0x01, 0x4B, 0xFE, 0xBD, 0x01, 0x5D, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xA8, 0x01, 0x46, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01,
+    0x4A, 0xFE, 0xBC, 0x01, 0x57, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xC0, 0x01,
+    0x60, 0xFE, 0xBF, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xA7, 0x01,
+    0x60, 0xFE, 0xD4, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA7, 0x01,
+    0x4B, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xBC, 0x01, 0x59, 0xFE, 0xBE, 0x01, 0x5E, 0xFE, 0xBF, 0x01,
+    0x58, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBE, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBD, 0x01,
+    0x59, 0xFE, 0xB8, 0x01, 0x5B, 0xFE, 0xA7, 0x01, 0x45, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x42, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xA7, 0x01,
+    0xEE, 0xFA, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA7, 0x01, 0xED, 0xFA, 0xA6, 0x01, 0xEE, 0xFA, 0xA7, 0x01, 0x00, 0x00, 0x02, 0x05,
+    0x34, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x6D, 0x0D, 0x41, 0xF9, 0xBE, 0x01, 0x02, 0xFB, 0xA4, 0x01,
+    0xEF, 0xFA, 0xA5, 0x01, 0x43, 0xFE, 0xAB, 0x01, 0x4A, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xBB, 0x01,
+    0xFF, 0xFA, 0xA7, 0x01, 0x43, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x03, 0xFB, 0xA6, 0x01,
+    0x09, 0xFB, 0xD3, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0xF2, 0xFA, 0xA7, 0x01, 0x4A, 0xFE, 0xC1, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x09, 0xFB, 0xD4, 0x01, 0x01, 0xFB, 0xA2, 0x01, 0x41, 0xFE, 0xA4, 0x01,
+    0xED, 0xFA, 0xB7, 0x01, 0x17, 0xFB, 0xBE, 0x01, 0x44, 0xFE, 0xA4, 0x01, 0x44, 0xFE, 0xA7, 0x01,
+    0x03, 0xFB, 0xBD, 0x01, 0x46, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEB, 0xFA, 0xA3, 0x01,
+    0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBF, 0x01,
+    0x5F, 0xFE, 0xBF, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xBC, 0x01, 0x5A, 0xFE, 0xC0, 0x01,
+    0x5A, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xBB, 0x01, 0x00, 0xFB, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0xFC, 0xFA, 0xA3, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEF, 0xFA, 0xA7, 0x01, 0xEE, 0xFA, 0xBA, 0x01,
+    0x15, 0xFB, 0xBF, 0x01, 0x4C, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA9, 0x01,
+    0xF2, 0xFA, 0xA7, 0x01, 0xEF, 0xFA, 0xA6, 0x01, 0x4B, 0xFE, 0xBD, 0x01, 0x5D, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xA8, 0x01, 0x46, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01,
+    0x4A, 0xFE, 0xBC, 0x01, 0x57, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xC0, 0x01,
+    0x60, 0xFE, 0xBF, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xA7, 0x01,
+    0x60, 0xFE, 0xD4, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA7, 0x01,
+    0x4B, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xBC, 0x01, 0x59, 0xFE, 0xBE, 0x01, 0x5E, 0xFE, 0xBF, 0x01,
+    0x58, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBE, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBD, 0x01,
+    0x59, 0xFE, 0xB8, 0x01, 0x5B, 0xFE, 0xA7, 0x01, 0x45, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x42, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xA7, 0x01,
+    0xEE, 0xFA, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA7, 0x01, 0xED, 0xFA, 0xA6, 0x01, 0xEE, 0xFA, 0xA7, 0x01, 0x00, 0x00, 0x02, 0x04,
+    0x2C, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x6D, 0x0D, 0x41, 0xF9, 0xBE, 0x01, 0x02, 0xFB, 0xA4, 0x01,
+    0xEF, 0xFA, 0xA5, 0x01, 0x43, 0xFE, 0xAB, 0x01, 0x4A, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xBB, 0x01,
+    0xFF, 0xFA, 0xA7, 0x01, 0x43, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x03, 0xFB, 0xA6, 0x01,
+    0x09, 0xFB, 0xD3, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0xF2, 0xFA, 0xA7, 0x01, 0x4A, 0xFE, 0xC1, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x09, 0xFB, 0xD4, 0x01, 0x01, 0xFB, 0xA2, 0x01, 0x41, 0xFE, 0xA4, 0x01,
+    0xED, 0xFA, 0xB7, 0x01, 0x17, 0xFB, 0xBE, 0x01, 0x44, 0xFE, 0xA4, 0x01, 0x44, 0xFE, 0xA7, 0x01,
+    0x03, 0xFB, 0xBD, 0x01, 0x46, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEB, 0xFA, 0xA3, 0x01,
+    0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBF, 0x01,
+    0x5F, 0xFE, 0xBF, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xBC, 0x01, 0x5A, 0xFE, 0xC0, 0x01,
+    0x5A, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xBB, 0x01, 0x00, 0xFB, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0xFC, 0xFA, 0xA3, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEF, 0xFA, 0xA7, 0x01, 0xEE, 0xFA, 0xBA, 0x01,
+    0x15, 0xFB, 0xBF, 0x01, 0x4C, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA9, 0x01,
+    0xF2, 0xFA, 0xA7, 0x01, 0xEF, 0xFA, 0xA6, 0x01, 0x4B, 0xFE, 0xBD, 0x01, 0x5D, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xA8, 0x01, 0x46, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01,
+    0x4A, 0xFE, 0xBC, 0x01, 0x57, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xC0, 0x01,
+    0x60, 0xFE, 0xBF, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xA7, 0x01,
+    0x60, 0xFE, 0xD4, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA7, 0x01,
+    0x4B, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xBC, 0x01, 0x59, 0xFE, 0xBE, 0x01, 0x5E, 0xFE, 0xBF, 0x01,
+    0x58, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBE, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBD, 0x01,
+    0x59, 0xFE, 0xB8, 0x01, 0x5B, 0xFE, 0xA7, 0x01, 0x45, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x42, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xA7, 0x01,
+    0xEE, 0xFA, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA7, 0x01, 0xED, 0xFA, 0xA6, 0x01, 0xEE, 0xFA, 0xA7, 0x01, 0x00, 0x00, 0x02, 0x03,
+    0x36, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x6D, 0x0D, 0x41, 0xF9, 0xBE, 0x01, 0x02, 0xFB, 0xA4, 0x01,
+    0xEF, 0xFA, 0xA5, 0x01, 0x43, 0xFE, 0xAB, 0x01, 0x4A, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xBB, 0x01,
+    0xFF, 0xFA, 0xA7, 0x01, 0x43, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x03, 0xFB, 0xA6, 0x01,
+    0x09, 0xFB, 0xD3, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0xF2, 0xFA, 0xA7, 0x01, 0x4A, 0xFE, 0xC1, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x09, 0xFB, 0xD4, 0x01, 0x01, 0xFB, 0xA2, 0x01, 0x41, 0xFE, 0xA4, 0x01,
+    0xED, 0xFA, 0xB7, 0x01, 0x17, 0xFB, 0xBE, 0x01, 0x44, 0xFE, 0xA4, 0x01, 0x44, 0xFE, 0xA7, 0x01,
+    0x03, 0xFB, 0xBD, 0x01, 0x46, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEB, 0xFA, 0xA3, 0x01,
+    0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBF, 0x01,
+    0x5F, 0xFE, 0xBF, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xBC, 0x01, 0x5A, 0xFE, 0xC0, 0x01,
+    0x5A, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xBB, 0x01, 0x00, 0xFB, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0xFC, 0xFA, 0xA3, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEF, 0xFA, 0xA7, 0x01, 0xEE, 0xFA, 0xBA, 0x01,
+    0x15, 0xFB, 0xBF, 0x01, 0x4C, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA9, 0x01,
+    0xF2, 0xFA, 0xA7, 0x01, 0xEF, 0xFA, 0xA6, 0x01, 0x4B, 0xFE, 0xBD, 0x01, 0x5D, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xA8, 0x01, 0x46, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01,
+    0x4A, 0xFE, 0xBC, 0x01, 0x57, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xC0, 0x01,
+    0x60, 0xFE, 0xBF, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xA7, 0x01,
+    0x60, 0xFE, 0xD4, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA7, 0x01,
+    0x4B, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xBC, 0x01, 0x59, 0xFE, 0xBE, 0x01, 0x5E, 0xFE, 0xBF, 0x01,
+    0x58, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBE, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBD, 0x01,
+    0x59, 0xFE, 0xB8, 0x01, 0x5B, 0xFE, 0xA7, 0x01, 0x45, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x42, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xA7, 0x01,
+    0xEE, 0xFA, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA7, 0x01, 0xED, 0xFA, 0xA6, 0x01, 0xEE, 0xFA, 0xA7, 0x01, 0x00, 0x00, 0x02, 0x02,
+    0x32, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x6D, 0x0D, 0x41, 0xF9, 0xBE, 0x01, 0x02, 0xFB, 0xA4, 0x01,
+    0xEF, 0xFA, 0xA5, 0x01, 0x43, 0xFE, 0xAB, 0x01, 0x4A, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xBB, 0x01,
+    0xFF, 0xFA, 0xA7, 0x01, 0x43, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x03, 0xFB, 0xA6, 0x01,
+    0x09, 0xFB, 0xD3, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0xF2, 0xFA, 0xA7, 0x01, 0x4A, 0xFE, 0xC1, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x09, 0xFB, 0xD4, 0x01, 0x01, 0xFB, 0xA2, 0x01, 0x41, 0xFE, 0xA4, 0x01,
+    0xED, 0xFA, 0xB7, 0x01, 0x17, 0xFB, 0xBE, 0x01, 0x44, 0xFE, 0xA4, 0x01, 0x44, 0xFE, 0xA7, 0x01,
+    0x03, 0xFB, 0xBD, 0x01, 0x46, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEB, 0xFA, 0xA3, 0x01,
+    0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBF, 0x01,
+    0x5F, 0xFE, 0xBF, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xBC, 0x01, 0x5A, 0xFE, 0xC0, 0x01,
+    0x5A, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xBB, 0x01, 0x00, 0xFB, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0xFC, 0xFA, 0xA3, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEF, 0xFA, 0xA7, 0x01, 0xEE, 0xFA, 0xBA, 0x01,
+    0x15, 0xFB, 0xBF, 0x01, 0x4C, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA9, 0x01,
+    0xF2, 0xFA, 0xA7, 0x01, 0xEF, 0xFA, 0xA6, 0x01, 0x4B, 0xFE, 0xBD, 0x01, 0x5D, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xA8, 0x01, 0x46, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01,
+    0x4A, 0xFE, 0xBC, 0x01, 0x57, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xC0, 0x01,
+    0x60, 0xFE, 0xBF, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xA7, 0x01,
+    0x60, 0xFE, 0xD4, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA7, 0x01,
+    0x4B, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xBC, 0x01, 0x59, 0xFE, 0xBE, 0x01, 0x5E, 0xFE, 0xBF, 0x01,
+    0x58, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBE, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBD, 0x01,
+    0x59, 0xFE, 0xB8, 0x01, 0x5B, 0xFE, 0xA7, 0x01, 0x45, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x42, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xA7, 0x01,
+    0xEE, 0xFA, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA7, 0x01, 0xED, 0xFA, 0xA6, 0x01, 0xEE, 0xFA, 0xA7, 0x01, 0x00, 0x00, 0x02, 0x02,
+    0x30, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x6D, 0x0D, 0x41, 0xF9, 0xBE, 0x01, 0x02, 0xFB, 0xA4, 0x01,
+    0xEF, 0xFA, 0xA5, 0x01, 0x43, 0xFE, 0xAB, 0x01, 0x4A, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xBB, 0x01,
+    0xFF, 0xFA, 0xA7, 0x01, 0x43, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x03, 0xFB, 0xA6, 0x01,
+    0x09, 0xFB, 0xD3, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0xF2, 0xFA, 0xA7, 0x01, 0x4A, 0xFE, 0xC1, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x09, 0xFB, 0xD4, 0x01, 0x01, 0xFB, 0xA2, 0x01, 0x41, 0xFE, 0xA4, 0x01,
+    0xED, 0xFA, 0xB7, 0x01, 0x17, 0xFB, 0xBE, 0x01, 0x44, 0xFE, 0xA4, 0x01, 0x44, 0xFE, 0xA7, 0x01,
+    0x03, 0xFB, 0xBD, 0x01, 0x46, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEB, 0xFA, 0xA3, 0x01,
+    0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBF, 0x01,
+    0x5F, 0xFE, 0xBF, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xBC, 0x01, 0x5A, 0xFE, 0xC0, 0x01,
+    0x5A, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xBB, 0x01, 0x00, 0xFB, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0xFC, 0xFA, 0xA3, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEF, 0xFA, 0xA7, 0x01, 0xEE, 0xFA, 0xBA, 0x01,
+    0x15, 0xFB, 0xBF, 0x01, 0x4C, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA9, 0x01,
+    0xF2, 0xFA, 0xA7, 0x01, 0xEF, 0xFA, 0xA6, 0x01, 0x4B, 0xFE, 0xBD, 0x01, 0x5D, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xA8, 0x01, 0x46, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01,
+    0x4A, 0xFE, 0xBC, 0x01, 0x57, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xC0, 0x01,
+    0x60, 0xFE, 0xBF, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xA7, 0x01,
+    0x60, 0xFE, 0xD4, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA7, 0x01,
+    0x4B, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xBC, 0x01, 0x59, 0xFE, 0xBE, 0x01, 0x5E, 0xFE, 0xBF, 0x01,
+    0x58, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBE, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBD, 0x01,
+    0x59, 0xFE, 0xB8, 0x01, 0x5B, 0xFE, 0xA7, 0x01, 0x45, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x42, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xA7, 0x01,
+    0xEE, 0xFA, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA7, 0x01, 0xED, 0xFA, 0xA6, 0x01, 0xEE, 0xFA, 0xA7, 0x01, 0x00, 0x00, 0x02, 0x05,
+    0x30, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x6D, 0x0D, 0x41, 0xF9, 0xBE, 0x01, 0x02, 0xFB, 0xA4, 0x01,
+    0xEF, 0xFA, 0xA5, 0x01, 0x43, 0xFE, 0xAB, 0x01, 0x4A, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xBB, 0x01,
+    0xFF, 0xFA, 0xA7, 0x01, 0x43, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x03, 0xFB, 0xA6, 0x01,
+    0x09, 0xFB, 0xD3, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0xF2, 0xFA, 0xA7, 0x01, 0x4A, 0xFE, 0xC1, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x09, 0xFB, 0xD4, 0x01, 0x01, 0xFB, 0xA2, 0x01, 0x41, 0xFE, 0xA4, 0x01,
+    0xED, 0xFA, 0xB7, 0x01, 0x17, 0xFB, 0xBE, 0x01, 0x44, 0xFE, 0xA4, 0x01, 0x44, 0xFE, 0xA7, 0x01,
+    0x03, 0xFB, 0xBD, 0x01, 0x46, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEB, 0xFA, 0xA3, 0x01,
+    0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBF, 0x01,
+    0x5F, 0xFE, 0xBF, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xBC, 0x01, 0x5A, 0xFE, 0xC0, 0x01,
+    0x5A, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xBB, 0x01, 0x00, 0xFB, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0xFC, 0xFA, 0xA3, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEF, 0xFA, 0xA7, 0x01, 0xEE, 0xFA, 0xBA, 0x01,
+    0x15, 0xFB, 0xBF, 0x01, 0x4C, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA9, 0x01,
+    0xF2, 0xFA, 0xA7, 0x01, 0xEF, 0xFA, 0xA6, 0x01, 0x4B, 0xFE, 0xBD, 0x01, 0x5D, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xA8, 0x01, 0x46, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01,
+    0x4A, 0xFE, 0xBC, 0x01, 0x57, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xC0, 0x01,
+    0x60, 0xFE, 0xBF, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xA7, 0x01,
+    0x60, 0xFE, 0xD4, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA7, 0x01,
+    0x4B, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xBC, 0x01, 0x59, 0xFE, 0xBE, 0x01, 0x5E, 0xFE, 0xBF, 0x01,
+    0x58, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBE, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBD, 0x01,
+    0x59, 0xFE, 0xB8, 0x01, 0x5B, 0xFE, 0xA7, 0x01, 0x45, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x42, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xA7, 0x01,
+    0xEE, 0xFA, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA7, 0x01, 0xED, 0xFA, 0xA6, 0x01, 0xEE, 0xFA, 0xA7, 0x01, 0x00, 0x00, 0x02, 0x03,
+    0x2C, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x6D, 0x0D, 0x41, 0xF9, 0xBE, 0x01, 0x02, 0xFB, 0xA4, 0x01,
+    0xEF, 0xFA, 0xA5, 0x01, 0x43, 0xFE, 0xAB, 0x01, 0x4A, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xBB, 0x01,
+    0xFF, 0xFA, 0xA7, 0x01, 0x43, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x03, 0xFB, 0xA6, 0x01,
+    0x09, 0xFB, 0xD3, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0xF2, 0xFA, 0xA7, 0x01, 0x4A, 0xFE, 0xC1, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x09, 0xFB, 0xD4, 0x01, 0x01, 0xFB, 0xA2, 0x01, 0x41, 0xFE, 0xA4, 0x01,
+    0xED, 0xFA, 0xB7, 0x01, 0x17, 0xFB, 0xBE, 0x01, 0x44, 0xFE, 0xA4, 0x01, 0x44, 0xFE, 0xA7, 0x01,
+    0x03, 0xFB, 0xBD, 0x01, 0x46, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEB, 0xFA, 0xA3, 0x01,
+    0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBF, 0x01,
+    0x5F, 0xFE, 0xBF, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xBC, 0x01, 0x5A, 0xFE, 0xC0, 0x01,
+    0x5A, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xBB, 0x01, 0x00, 0xFB, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0xFC, 0xFA, 0xA3, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEF, 0xFA, 0xA7, 0x01, 0xEE, 0xFA, 0xBA, 0x01,
+    0x15, 0xFB, 0xBF, 0x01, 0x4C, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA9, 0x01,
+    0xF2, 0xFA, 0xA7, 0x01, 0xEF, 0xFA, 0xA6, 0x01, 0x4B, 0xFE, 0xBD, 0x01, 0x5D, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xA8, 0x01, 0x46, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01,
+    0x4A, 0xFE, 0xBC, 0x01, 0x57, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xC0, 0x01,
+    0x60, 0xFE, 0xBF, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xA7, 0x01,
+    0x60, 0xFE, 0xD4, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA7, 0x01,
+    0x4B, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xBC, 0x01, 0x59, 0xFE, 0xBE, 0x01, 0x5E, 0xFE, 0xBF, 0x01,
+    0x58, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBE, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBD, 0x01,
+    0x59, 0xFE, 0xB8, 0x01, 0x5B, 0xFE, 0xA7, 0x01, 0x45, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x42, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xA7, 0x01,
+    0xEE, 0xFA, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA7, 0x01, 0xED, 0xFA, 0xA6, 0x01, 0xEE, 0xFA, 0xA7, 0x01, 0x00, 0x00, 0x02, 0x03,
+    0x34, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x6D, 0x0D, 0x41, 0xF9, 0xBE, 0x01, 0x02, 0xFB, 0xA4, 0x01,
+    0xEF, 0xFA, 0xA5, 0x01, 0x43, 0xFE, 0xAB, 0x01, 0x4A, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xBB, 0x01,
+    0xFF, 0xFA, 0xA7, 0x01, 0x43, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x03, 0xFB, 0xA6, 0x01,
+    0x09, 0xFB, 0xD3, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0xF2, 0xFA, 0xA7, 0x01, 0x4A, 0xFE, 0xC1, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x09, 0xFB, 0xD4, 0x01, 0x01, 0xFB, 0xA2, 0x01, 0x41, 0xFE, 0xA4, 0x01,
+    0xED, 0xFA, 0xB7, 0x01, 0x17, 0xFB, 0xBE, 0x01, 0x44, 0xFE, 0xA4, 0x01, 0x44, 0xFE, 0xA7, 0x01,
+    0x03, 0xFB, 0xBD, 0x01, 0x46, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEB, 0xFA, 0xA3, 0x01,
+    0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBF, 0x01,
+    0x5F, 0xFE, 0xBF, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xBC, 0x01, 0x5A, 0xFE, 0xC0, 0x01,
+    0x5A, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xBB, 0x01, 0x00, 0xFB, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0xFC, 0xFA, 0xA3, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEF, 0xFA, 0xA7, 0x01, 0xEE, 0xFA, 0xBA, 0x01,
+    0x15, 0xFB, 0xBF, 0x01, 0x4C, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA9, 0x01,
+    0xF2, 0xFA, 0xA7, 0x01, 0xEF, 0xFA, 0xA6, 0x01, 0x4B, 0xFE, 0xBD, 0x01, 0x5D, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xA8, 0x01, 0x46, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01,
+    0x4A, 0xFE, 0xBC, 0x01, 0x57, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xC0, 0x01,
+    0x60, 0xFE, 0xBF, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xA7, 0x01,
+    0x60, 0xFE, 0xD4, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA7, 0x01,
+    0x4B, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xBC, 0x01, 0x59, 0xFE, 0xBE, 0x01, 0x5E, 0xFE, 0xBF, 0x01,
+    0x58, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBE, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBD, 0x01,
+    0x59, 0xFE, 0xB8, 0x01, 0x5B, 0xFE, 0xA7, 0x01, 0x45, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x42, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xA7, 0x01,
+    0xEE, 0xFA, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA7, 0x01, 0xED, 0xFA, 0xA6, 0x01, 0xEE, 0xFA, 0xA7, 0x01, 0x00, 0x00, 0x04, 0x03,
+    0x00, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x6D, 0x0D, 0x41, 0xF9, 0xBE, 0x01, 0x02, 0xFB, 0xA4, 0x01,
+    0xEF, 0xFA, 0xA5, 0x01, 0x43, 0xFE, 0xAB, 0x01, 0x4A, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xBB, 0x01,
+    0xFF, 0xFA, 0xA7, 0x01, 0x43, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x03, 0xFB, 0xA6, 0x01,
+    0x09, 0xFB, 0xD3, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0xF2, 0xFA, 0xA7, 0x01, 0x4A, 0xFE, 0xC1, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x09, 0xFB, 0xD4, 0x01, 0x01, 0xFB, 0xA2, 0x01, 0x41, 0xFE, 0xA4, 0x01,
+    0xED, 0xFA, 0xB7, 0x01, 0x17, 0xFB, 0xBE, 0x01, 0x44, 0xFE, 0xA4, 0x01, 0x44, 0xFE, 0xA7, 0x01,
+    0x03, 0xFB, 0xBD, 0x01, 0x46, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEB, 0xFA, 0xA3, 0x01,
+    0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBF, 0x01,
+    0x5F, 0xFE, 0xBF, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xBC, 0x01, 0x5A, 0xFE, 0xC0, 0x01,
+    0x5A, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xBB, 0x01, 0x00, 0xFB, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0xFC, 0xFA, 0xA3, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEF, 0xFA, 0xA7, 0x01, 0xEE, 0xFA, 0xBA, 0x01,
+    0x15, 0xFB, 0xBF, 0x01, 0x4C, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA9, 0x01,
+    0xF2, 0xFA, 0xA7, 0x01, 0xEF, 0xFA, 0xA6, 0x01, 0x4B, 0xFE, 0xBD, 0x01, 0x5D, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xA8, 0x01, 0x46, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01,
+    0x4A, 0xFE, 0xBC, 0x01, 0x57, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xC0, 0x01,
+    0x60, 0xFE, 0xBF, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xA7, 0x01,
+    0x60, 0xFE, 0xD4, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA7, 0x01,
+    0x4B, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xBC, 0x01, 0x59, 0xFE, 0xBE, 0x01, 0x5E, 0xFE, 0xBF, 0x01,
+    0x58, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBE, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBD, 0x01,
+    0x59, 0xFE, 0xB8, 0x01, 0x5B, 0xFE, 0xA7, 0x01, 0x45, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x42, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xA7, 0x01,
+    0xEE, 0xFA, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA7, 0x01, 0xED, 0xFA, 0xA6, 0x01, 0xEE, 0xFA, 0xA7, 0x01, 0x00, 0x00, 0x02, 0x05,
+    0x2E, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x6D, 0x0D, 0x41, 0xF9, 0xBE, 0x01, 0x02, 0xFB, 0xA4, 0x01,
+    0xEF, 0xFA, 0xA5, 0x01, 0x43, 0xFE, 0xAB, 0x01, 0x4A, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xBB, 0x01,
+    0xFF, 0xFA, 0xA7, 0x01, 0x43, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x03, 0xFB, 0xA6, 0x01,
+    0x09, 0xFB, 0xD3, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0xF2, 0xFA, 0xA7, 0x01, 0x4A, 0xFE, 0xC1, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x09, 0xFB, 0xD4, 0x01, 0x01, 0xFB, 0xA2, 0x01, 0x41, 0xFE, 0xA4, 0x01,
+    0xED, 0xFA, 0xB7, 0x01, 0x17, 0xFB, 0xBE, 0x01, 0x44, 0xFE, 0xA4, 0x01, 0x44, 0xFE, 0xA7, 0x01,
+    0x03, 0xFB, 0xBD, 0x01, 0x46, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEB, 0xFA, 0xA3, 0x01,
+    0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBF, 0x01,
+    0x5F, 0xFE, 0xBF, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xBC, 0x01, 0x5A, 0xFE, 0xC0, 0x01,
+    0x5A, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xBB, 0x01, 0x00, 0xFB, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0xFC, 0xFA, 0xA3, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEF, 0xFA, 0xA7, 0x01, 0xEE, 0xFA, 0xBA, 0x01,
+    0x15, 0xFB, 0xBF, 0x01, 0x4C, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA9, 0x01,
+    0xF2, 0xFA, 0xA7, 0x01, 0xEF, 0xFA, 0xA6, 0x01, 0x4B, 0xFE, 0xBD, 0x01, 0x5D, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xA8, 0x01, 0x46, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01,
+    0x4A, 0xFE, 0xBC, 0x01, 0x57, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xC0, 0x01,
+    0x60, 0xFE, 0xBF, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xA7, 0x01,
+    0x60, 0xFE, 0xD4, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA7, 0x01,
+    0x4B, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xBC, 0x01, 0x59, 0xFE, 0xBE, 0x01, 0x5E, 0xFE, 0xBF, 0x01,
+    0x58, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBE, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBD, 0x01,
+    0x59, 0xFE, 0xB8, 0x01, 0x5B, 0xFE, 0xA7, 0x01, 0x45, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x42, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xA7, 0x01,
+    0xEE, 0xFA, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA7, 0x01, 0xED, 0xFA, 0xA6, 0x01, 0xEE, 0xFA, 0xA7, 0x01, 0x00, 0x00, 0x02, 0x04,
+    0x34, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x6D, 0x0D, 0x41, 0xF9, 0xBE, 0x01, 0x02, 0xFB, 0xA4, 0x01,
+    0xEF, 0xFA, 0xA5, 0x01, 0x43, 0xFE, 0xAB, 0x01, 0x4A, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xBB, 0x01,
+    0xFF, 0xFA, 0xA7, 0x01, 0x43, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x03, 0xFB, 0xA6, 0x01,
+    0x09, 0xFB, 0xD3, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0xF2, 0xFA, 0xA7, 0x01, 0x4A, 0xFE, 0xC1, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x09, 0xFB, 0xD4, 0x01, 0x01, 0xFB, 0xA2, 0x01, 0x41, 0xFE, 0xA4, 0x01,
+    0xED, 0xFA, 0xB7, 0x01, 0x17, 0xFB, 0xBE, 0x01, 0x44, 0xFE, 0xA4, 0x01, 0x44, 0xFE, 0xA7, 0x01,
+    0x03, 0xFB, 0xBD, 0x01, 0x46, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEB, 0xFA, 0xA3, 0x01,
+    0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBF, 0x01,
+    0x5F, 0xFE, 0xBF, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xBC, 0x01, 0x5A, 0xFE, 0xC0, 0x01,
+    0x5A, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xBB, 0x01, 0x00, 0xFB, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0xFC, 0xFA, 0xA3, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEF, 0xFA, 0xA7, 0x01, 0xEE, 0xFA, 0xBA, 0x01,
+    0x15, 0xFB, 0xBF, 0x01, 0x4C, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA9, 0x01,
+    0xF2, 0xFA, 0xA7, 0x01, 0xEF, 0xFA, 0xA6, 0x01, 0x4B, 0xFE, 0xBD, 0x01, 0x5D, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xA8, 0x01, 0x46, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01,
+    0x4A, 0xFE, 0xBC, 0x01, 0x57, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xC0, 0x01,
+    0x60, 0xFE, 0xBF, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xA7, 0x01,
+    0x60, 0xFE, 0xD4, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA7, 0x01,
+    0x4B, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xBC, 0x01, 0x59, 0xFE, 0xBE, 0x01, 0x5E, 0xFE, 0xBF, 0x01,
+    0x58, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBE, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBD, 0x01,
+    0x59, 0xFE, 0xB8, 0x01, 0x5B, 0xFE, 0xA7, 0x01, 0x45, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x42, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xA7, 0x01,
+    0xEE, 0xFA, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA7, 0x01, 0xED, 0xFA, 0xA6, 0x01, 0xEE, 0xFA, 0xA7, 0x01, 0x00, 0x00, 0x02, 0x02,
+    0x2C, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x6D, 0x0D, 0x41, 0xF9, 0xBE, 0x01, 0x02, 0xFB, 0xA4, 0x01,
+    0xEF, 0xFA, 0xA5, 0x01, 0x43, 0xFE, 0xAB, 0x01, 0x4A, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xBB, 0x01,
+    0xFF, 0xFA, 0xA7, 0x01, 0x43, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x03, 0xFB, 0xA6, 0x01,
+    0x09, 0xFB, 0xD3, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0xF2, 0xFA, 0xA7, 0x01, 0x4A, 0xFE, 0xC1, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x09, 0xFB, 0xD4, 0x01, 0x01, 0xFB, 0xA2, 0x01, 0x41, 0xFE, 0xA4, 0x01,
+    0xED, 0xFA, 0xB7, 0x01, 0x17, 0xFB, 0xBE, 0x01, 0x44, 0xFE, 0xA4, 0x01, 0x44, 0xFE, 0xA7, 0x01,
+    0x03, 0xFB, 0xBD, 0x01, 0x46, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEB, 0xFA, 0xA3, 0x01,
+    0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBF, 0x01,
+    0x5F, 0xFE, 0xBF, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xBC, 0x01, 0x5A, 0xFE, 0xC0, 0x01,
+    0x5A, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xBB, 0x01, 0x00, 0xFB, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0xFC, 0xFA, 0xA3, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEF, 0xFA, 0xA7, 0x01, 0xEE, 0xFA, 0xBA, 0x01,
+    0x15, 0xFB, 0xBF, 0x01, 0x4C, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA9, 0x01,
+    0xF2, 0xFA, 0xA7, 0x01, 0xEF, 0xFA, 0xA6, 0x01, 0x4B, 0xFE, 0xBD, 0x01, 0x5D, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xA8, 0x01, 0x46, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01,
+    0x4A, 0xFE, 0xBC, 0x01, 0x57, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xC0, 0x01,
+    0x60, 0xFE, 0xBF, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xA7, 0x01,
+    0x60, 0xFE, 0xD4, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA7, 0x01,
+    0x4B, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xBC, 0x01, 0x59, 0xFE, 0xBE, 0x01, 0x5E, 0xFE, 0xBF, 0x01,
+    0x58, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBE, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBD, 0x01,
+    0x59, 0xFE, 0xB8, 0x01, 0x5B, 0xFE, 0xA7, 0x01, 0x45, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x42, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xA7, 0x01,
+    0xEE, 0xFA, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA7, 0x01, 0xED, 0xFA, 0xA6, 0x01, 0xEE, 0xFA, 0xA7, 0x01, 0x00, 0x00, 0x02, 0x05,
+    0x2C, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x6D, 0x0D, 0x41, 0xF9, 0xBE, 0x01, 0x02, 0xFB, 0xA4, 0x01,
+    0xEF, 0xFA, 0xA5, 0x01, 0x43, 0xFE, 0xAB, 0x01, 0x4A, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xBB, 0x01,
+    0xFF, 0xFA, 0xA7, 0x01, 0x43, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x03, 0xFB, 0xA6, 0x01,
+    0x09, 0xFB, 0xD3, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0xF2, 0xFA, 0xA7, 0x01, 0x4A, 0xFE, 0xC1, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x09, 0xFB, 0xD4, 0x01, 0x01, 0xFB, 0xA2, 0x01, 0x41, 0xFE, 0xA4, 0x01,
+    0xED, 0xFA, 0xB7, 0x01, 0x17, 0xFB, 0xBE, 0x01, 0x44, 0xFE, 0xA4, 0x01, 0x44, 0xFE, 0xA7, 0x01,
+    0x03, 0xFB, 0xBD, 0x01, 0x46, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEB, 0xFA, 0xA3, 0x01,
+    0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBF, 0x01,
+    0x5F, 0xFE, 0xBF, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xBC, 0x01, 0x5A, 0xFE, 0xC0, 0x01,
+    0x5A, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xBB, 0x01, 0x00, 0xFB, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0xFC, 0xFA, 0xA3, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEF, 0xFA, 0xA7, 0x01, 0xEE, 0xFA, 0xBA, 0x01,
+    0x15, 0xFB, 0xBF, 0x01, 0x4C, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA9, 0x01,
+    0xF2, 0xFA, 0xA7, 0x01, 0xEF, 0xFA, 0xA6, 0x01, 0x4B, 0xFE, 0xBD, 0x01, 0x5D, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xA8, 0x01, 0x46, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01,
+    0x4A, 0xFE, 0xBC, 0x01, 0x57, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xC0, 0x01,
+    0x60, 0xFE, 0xBF, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xA7, 0x01,
+    0x60, 0xFE, 0xD4, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA7, 0x01,
+    0x4B, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xBC, 0x01, 0x59, 0xFE, 0xBE, 0x01, 0x5E, 0xFE, 0xBF, 0x01,
+    0x58, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBE, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBD, 0x01,
+    0x59, 0xFE, 0xB8, 0x01, 0x5B, 0xFE, 0xA7, 0x01, 0x45, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x42, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xA7, 0x01,
+    0xEE, 0xFA, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA7, 0x01, 0xED, 0xFA, 0xA6, 0x01, 0xEE, 0xFA, 0xA7, 0x01, 0x00, 0x00, 0x02, 0x02,
+    0x36, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x6D, 0x0D, 0x41, 0xF9, 0xBE, 0x01, 0x02, 0xFB, 0xA4, 0x01,
+    0xEF, 0xFA, 0xA5, 0x01, 0x43, 0xFE, 0xAB, 0x01, 0x4A, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xBB, 0x01,
+    0xFF, 0xFA, 0xA7, 0x01, 0x43, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x03, 0xFB, 0xA6, 0x01,
+    0x09, 0xFB, 0xD3, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0xF2, 0xFA, 0xA7, 0x01, 0x4A, 0xFE, 0xC1, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x09, 0xFB, 0xD4, 0x01, 0x01, 0xFB, 0xA2, 0x01, 0x41, 0xFE, 0xA4, 0x01,
+    0xED, 0xFA, 0xB7, 0x01, 0x17, 0xFB, 0xBE, 0x01, 0x44, 0xFE, 0xA4, 0x01, 0x44, 0xFE, 0xA7, 0x01,
+    0x03, 0xFB, 0xBD, 0x01, 0x46, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEB, 0xFA, 0xA3, 0x01,
+    0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBF, 0x01,
+    0x5F, 0xFE, 0xBF, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xBC, 0x01, 0x5A, 0xFE, 0xC0, 0x01,
+    0x5A, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xBB, 0x01, 0x00, 0xFB, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0xFC, 0xFA, 0xA3, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEF, 0xFA, 0xA7, 0x01, 0xEE, 0xFA, 0xBA, 0x01,
+    0x15, 0xFB, 0xBF, 0x01, 0x4C, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA9, 0x01,
+    0xF2, 0xFA, 0xA7, 0x01, 0xEF, 0xFA, 0xA6, 0x01, 0x4B, 0xFE, 0xBD, 0x01, 0x5D, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xA8, 0x01, 0x46, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01,
+    0x4A, 0xFE, 0xBC, 0x01, 0x57, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xC0, 0x01,
+    0x60, 0xFE, 0xBF, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xA7, 0x01,
+    0x60, 0xFE, 0xD4, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA7, 0x01,
+    0x4B, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xBC, 0x01, 0x59, 0xFE, 0xBE, 0x01, 0x5E, 0xFE, 0xBF, 0x01,
+    0x58, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBE, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBD, 0x01,
+    0x59, 0xFE, 0xB8, 0x01, 0x5B, 0xFE, 0xA7, 0x01, 0x45, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x42, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xA7, 0x01,
+    0xEE, 0xFA, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA7, 0x01, 0xED, 0xFA, 0xA6, 0x01, 0xEE, 0xFA, 0xA7, 0x01, 0x00, 0x00, 0x02, 0x03,
+    0x30, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x6D, 0x0D, 0x41, 0xF9, 0xBE, 0x01, 0x02, 0xFB, 0xA4, 0x01,
+    0xEF, 0xFA, 0xA5, 0x01, 0x43, 0xFE, 0xAB, 0x01, 0x4A, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xBB, 0x01,
+    0xFF, 0xFA, 0xA7, 0x01, 0x43, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x03, 0xFB, 0xA6, 0x01,
+    0x09, 0xFB, 0xD3, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0xF2, 0xFA, 0xA7, 0x01, 0x4A, 0xFE, 0xC1, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x09, 0xFB, 0xD4, 0x01, 0x01, 0xFB, 0xA2, 0x01, 0x41, 0xFE, 0xA4, 0x01,
+    0xED, 0xFA, 0xB7, 0x01, 0x17, 0xFB, 0xBE, 0x01, 0x44, 0xFE, 0xA4, 0x01, 0x44, 0xFE, 0xA7, 0x01,
+    0x03, 0xFB, 0xBD, 0x01, 0x46, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEB, 0xFA, 0xA3, 0x01,
+    0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBF, 0x01,
+    0x5F, 0xFE, 0xBF, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xBC, 0x01, 0x5A, 0xFE, 0xC0, 0x01,
+    0x5A, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xBB, 0x01, 0x00, 0xFB, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0xFC, 0xFA, 0xA3, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEF, 0xFA, 0xA7, 0x01, 0xEE, 0xFA, 0xBA, 0x01,
+    0x15, 0xFB, 0xBF, 0x01, 0x4C, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA9, 0x01,
+    0xF2, 0xFA, 0xA7, 0x01, 0xEF, 0xFA, 0xA6, 0x01, 0x4B, 0xFE, 0xBD, 0x01, 0x5D, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xA8, 0x01, 0x46, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01,
+    0x4A, 0xFE, 0xBC, 0x01, 0x57, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xC0, 0x01,
+    0x60, 0xFE, 0xBF, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xA7, 0x01,
+    0x60, 0xFE, 0xD4, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA7, 0x01,
+    0x4B, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xBC, 0x01, 0x59, 0xFE, 0xBE, 0x01, 0x5E, 0xFE, 0xBF, 0x01,
+    0x58, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBE, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBD, 0x01,
+    0x59, 0xFE, 0xB8, 0x01, 0x5B, 0xFE, 0xA7, 0x01, 0x45, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x42, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xA7, 0x01,
+    0xEE, 0xFA, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA7, 0x01, 0xED, 0xFA, 0xA6, 0x01, 0xEE, 0xFA, 0xA7, 0x01, 0x00, 0x00, 0x02, 0x03,
+    0x32, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x6D, 0x0D, 0x41, 0xF9, 0xBE, 0x01, 0x02, 0xFB, 0xA4, 0x01,
+    0xEF, 0xFA, 0xA5, 0x01, 0x43, 0xFE, 0xAB, 0x01, 0x4A, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xBB, 0x01,
+    0xFF, 0xFA, 0xA7, 0x01, 0x43, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x03, 0xFB, 0xA6, 0x01,
+    0x09, 0xFB, 0xD3, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0xF2, 0xFA, 0xA7, 0x01, 0x4A, 0xFE, 0xC1, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x09, 0xFB, 0xD4, 0x01, 0x01, 0xFB, 0xA2, 0x01, 0x41, 0xFE, 0xA4, 0x01,
+    0xED, 0xFA, 0xB7, 0x01, 0x17, 0xFB, 0xBE, 0x01, 0x44, 0xFE, 0xA4, 0x01, 0x44, 0xFE, 0xA7, 0x01,
+    0x03, 0xFB, 0xBD, 0x01, 0x46, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEB, 0xFA, 0xA3, 0x01,
+    0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBF, 0x01,
+    0x5F, 0xFE, 0xBF, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xBC, 0x01, 0x5A, 0xFE, 0xC0, 0x01,
+    0x5A, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xBB, 0x01, 0x00, 0xFB, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0xFC, 0xFA, 0xA3, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEF, 0xFA, 0xA7, 0x01, 0xEE, 0xFA, 0xBA, 0x01,
+    0x15, 0xFB, 0xBF, 0x01, 0x4C, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA9, 0x01,
+    0xF2, 0xFA, 0xA7, 0x01, 0xEF, 0xFA, 0xA6, 0x01, 0x4B, 0xFE, 0xBD, 0x01, 0x5D, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xA8, 0x01, 0x46, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01,
+    0x4A, 0xFE, 0xBC, 0x01, 0x57, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xC0, 0x01,
+    0x60, 0xFE, 0xBF, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xA7, 0x01,
+    0x60, 0xFE, 0xD4, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA7, 0x01,
+    0x4B, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xBC, 0x01, 0x59, 0xFE, 0xBE, 0x01, 0x5E, 0xFE, 0xBF, 0x01,
+    0x58, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBE, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBD, 0x01,
+    0x59, 0xFE, 0xB8, 0x01, 0x5B, 0xFE, 0xA7, 0x01, 0x45, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x42, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xA7, 0x01,
+    0xEE, 0xFA, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA7, 0x01, 0xED, 0xFA, 0xA6, 0x01, 0xEE, 0xFA, 0xA7, 0x01, 0x00, 0x00, 0x02, 0x04,
+    0x36, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x6D, 0x0D, 0x41, 0xF9, 0xBE, 0x01, 0x02, 0xFB, 0xA4, 0x01,
+    0xEF, 0xFA, 0xA5, 0x01, 0x43, 0xFE, 0xAB, 0x01, 0x4A, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xBB, 0x01,
+    0xFF, 0xFA, 0xA7, 0x01, 0x43, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x03, 0xFB, 0xA6, 0x01,
+    0x09, 0xFB, 0xD3, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0xF2, 0xFA, 0xA7, 0x01, 0x4A, 0xFE, 0xC1, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x09, 0xFB, 0xD4, 0x01, 0x01, 0xFB, 0xA2, 0x01, 0x41, 0xFE, 0xA4, 0x01,
+    0xED, 0xFA, 0xB7, 0x01, 0x17, 0xFB, 0xBE, 0x01, 0x44, 0xFE, 0xA4, 0x01, 0x44, 0xFE, 0xA7, 0x01,
+    0x03, 0xFB, 0xBD, 0x01, 0x46, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEB, 0xFA, 0xA3, 0x01,
+    0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBF, 0x01,
+    0x5F, 0xFE, 0xBF, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xBC, 0x01, 0x5A, 0xFE, 0xC0, 0x01,
+    0x5A, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xBB, 0x01, 0x00, 0xFB, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0xFC, 0xFA, 0xA3, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEF, 0xFA, 0xA7, 0x01, 0xEE, 0xFA, 0xBA, 0x01,
+    0x15, 0xFB, 0xBF, 0x01, 0x4C, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA9, 0x01,
+    0xF2, 0xFA, 0xA7, 0x01, 0xEF, 0xFA, 0xA6, 0x01, 0x4B, 0xFE, 0xBD, 0x01, 0x5D, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xA8, 0x01, 0x46, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01,
+    0x4A, 0xFE, 0xBC, 0x01, 0x57, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xC0, 0x01,
+    0x60, 0xFE, 0xBF, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xA7, 0x01,
+    0x60, 0xFE, 0xD4, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA7, 0x01,
+    0x4B, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xBC, 0x01, 0x59, 0xFE, 0xBE, 0x01, 0x5E, 0xFE, 0xBF, 0x01,
+    0x58, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBE, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBD, 0x01,
+    0x59, 0xFE, 0xB8, 0x01, 0x5B, 0xFE, 0xA7, 0x01, 0x45, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x42, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xA7, 0x01,
+    0xEE, 0xFA, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA7, 0x01, 0xED, 0xFA, 0xA6, 0x01, 0xEE, 0xFA, 0xA7, 0x01, 0x00, 0x00, 0x02, 0x04,
+    0x32, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x6D, 0x0D, 0x41, 0xF9, 0xBE, 0x01, 0x02, 0xFB, 0xA4, 0x01,
+    0xEF, 0xFA, 0xA5, 0x01, 0x43, 0xFE, 0xAB, 0x01, 0x4A, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xBB, 0x01,
+    0xFF, 0xFA, 0xA7, 0x01, 0x43, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x03, 0xFB, 0xA6, 0x01,
+    0x09, 0xFB, 0xD3, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0xF2, 0xFA, 0xA7, 0x01, 0x4A, 0xFE, 0xC1, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x09, 0xFB, 0xD4, 0x01, 0x01, 0xFB, 0xA2, 0x01, 0x41, 0xFE, 0xA4, 0x01,
+    0xED, 0xFA, 0xB7, 0x01, 0x17, 0xFB, 0xBE, 0x01, 0x44, 0xFE, 0xA4, 0x01, 0x44, 0xFE, 0xA7, 0x01,
+    0x03, 0xFB, 0xBD, 0x01, 0x46, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEB, 0xFA, 0xA3, 0x01,
+    0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBF, 0x01,
+    0x5F, 0xFE, 0xBF, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xBC, 0x01, 0x5A, 0xFE, 0xC0, 0x01,
+    0x5A, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xBB, 0x01, 0x00, 0xFB, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0xFC, 0xFA, 0xA3, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEF, 0xFA, 0xA7, 0x01, 0xEE, 0xFA, 0xBA, 0x01,
+    0x15, 0xFB, 0xBF, 0x01, 0x4C, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA9, 0x01,
+    0xF2, 0xFA, 0xA7, 0x01, 0xEF, 0xFA, 0xA6, 0x01, 0x4B, 0xFE, 0xBD, 0x01, 0x5D, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xA8, 0x01, 0x46, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01,
+    0x4A, 0xFE, 0xBC, 0x01, 0x57, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xC0, 0x01,
+    0x60, 0xFE, 0xBF, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xA7, 0x01,
+    0x60, 0xFE, 0xD4, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA7, 0x01,
+    0x4B, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xBC, 0x01, 0x59, 0xFE, 0xBE, 0x01, 0x5E, 0xFE, 0xBF, 0x01,
+    0x58, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBE, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBD, 0x01,
+    0x59, 0xFE, 0xB8, 0x01, 0x5B, 0xFE, 0xA7, 0x01, 0x45, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x42, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xA7, 0x01,
+    0xEE, 0xFA, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA7, 0x01, 0xED, 0xFA, 0xA6, 0x01, 0xEE, 0xFA, 0xA7, 0x01, 0x00, 0x00, 0x02, 0x02,
+    0x2E, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x6D, 0x0D, 0x41, 0xF9, 0xBE, 0x01, 0x02, 0xFB, 0xA4, 0x01,
+    0xEF, 0xFA, 0xA5, 0x01, 0x43, 0xFE, 0xAB, 0x01, 0x4A, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xBB, 0x01,
+    0xFF, 0xFA, 0xA7, 0x01, 0x43, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x03, 0xFB, 0xA6, 0x01,
+    0x09, 0xFB, 0xD3, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0xF2, 0xFA, 0xA7, 0x01, 0x4A, 0xFE, 0xC1, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x09, 0xFB, 0xD4, 0x01, 0x01, 0xFB, 0xA2, 0x01, 0x41, 0xFE, 0xA4, 0x01,
+    0xED, 0xFA, 0xB7, 0x01, 0x17, 0xFB, 0xBE, 0x01, 0x44, 0xFE, 0xA4, 0x01, 0x44, 0xFE, 0xA7, 0x01,
+    0x03, 0xFB, 0xBD, 0x01, 0x46, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEB, 0xFA, 0xA3, 0x01,
+    0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBF, 0x01,
+    0x5F, 0xFE, 0xBF, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xBC, 0x01, 0x5A, 0xFE, 0xC0, 0x01,
+    0x5A, 0xFE, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x58, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xBB, 0x01, 0x00, 0xFB, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01,
+    0xFC, 0xFA, 0xA3, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0xEF, 0xFA, 0xA7, 0x01, 0xEE, 0xFA, 0xBA, 0x01,
+    0x15, 0xFB, 0xBF, 0x01, 0x4C, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA9, 0x01,
+    0xF2, 0xFA, 0xA7, 0x01, 0xEF, 0xFA, 0xA6, 0x01, 0x4B, 0xFE, 0xBD, 0x01, 0x5D, 0xFE, 0xBC, 0x01,
+    0x5C, 0xFE, 0xA8, 0x01, 0x46, 0xFE, 0xA8, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01,
+    0x4A, 0xFE, 0xBC, 0x01, 0x57, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xC0, 0x01,
+    0x60, 0xFE, 0xBF, 0x01, 0x5A, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01, 0x4B, 0xFE, 0xA7, 0x01,
+    0x60, 0xFE, 0xD4, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xA7, 0x01,
+    0x4B, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA7, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x45, 0xFE, 0xA7, 0x01,
+    0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xBC, 0x01, 0x59, 0xFE, 0xBE, 0x01, 0x5E, 0xFE, 0xBF, 0x01,
+    0x58, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBC, 0x01, 0x55, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA8, 0x01, 0x4A, 0xFE, 0xBE, 0x01, 0x5B, 0xFE, 0xA8, 0x01, 0x4C, 0xFE, 0xBD, 0x01,
+    0x59, 0xFE, 0xB8, 0x01, 0x5B, 0xFE, 0xA7, 0x01, 0x45, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xBC, 0x01,
+    0x5B, 0xFE, 0xA7, 0x01, 0x42, 0xFE, 0xA7, 0x01, 0x49, 0xFE, 0xBC, 0x01, 0x5C, 0xFE, 0xA7, 0x01,
+    0xEE, 0xFA, 0xA6, 0x01, 0x47, 0xFE, 0xA8, 0x01, 0x48, 0xFE, 0xA8, 0x01, 0x47, 0xFE, 0xA7, 0x01,
+    0x47, 0xFE, 0xA7, 0x01, 0xED, 0xFA, 0xA6, 0x01, 0xEE, 0xFA, 0xA7, 0x01, 0x00, 0x00,
+};
+const size_t RAW_AC_CODEBOOK_SIZE = sizeof(RAW_AC_CODEBOOK);
+
+}  // namespace raw_ac
+}  // namespace esphome
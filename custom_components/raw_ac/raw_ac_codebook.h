@@ -0,0 +1,15 @@
+#pragma once
+
+// Generated by tools/gen_codebook.py from codebooks/raw_ac.json -- do not edit.
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace raw_ac {
+
+extern const uint8_t RAW_AC_CODEBOOK[];
+extern const size_t RAW_AC_CODEBOOK_SIZE;
+
+}  // namespace raw_ac
+}  // namespace esphome
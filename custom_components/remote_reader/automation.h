@@ -0,0 +1,22 @@
+#pragma once
+
+#include "esphome/core/automation.h"
+#include "remote_reader_ac.h"
+
+namespace esphome {
+namespace remote_reader_ac {
+
+// remote_reader.dump_histogram: log every non-empty mark/space bin
+template<typename... Ts> class DumpHistogramAction : public Action<Ts...>, public Parented<RemoteReaderACClimate> {
+ public:
+  void play(Ts... x) override { this->parent_->dump_histogram(); }
+};
+
+// remote_reader.clear_histogram: start counting again, e.g. before pressing a different remote
+template<typename... Ts> class ClearHistogramAction : public Action<Ts...>, public Parented<RemoteReaderACClimate> {
+ public:
+  void play(Ts... x) override { this->parent_->clear_histogram(); }
+};
+
+}  // namespace remote_reader_ac
+}  // namespace esphome
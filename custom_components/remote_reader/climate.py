@@ -1,10 +1,17 @@
 
 import esphome.codegen as cg
 import esphome.config_validation as cv
-from esphome.components import climate, remote_transmitter, sensor, remote_receiver, remote_base
-from esphome.const import CONF_ID, CONF_SENSOR
+from esphome import automation
+from esphome.components import climate, remote_transmitter, sensor, remote_receiver, remote_base, text_sensor
+from esphome.components import ir_common
+from esphome.const import CONF_ID, CONF_SENSOR, ENTITY_CATEGORY_DIAGNOSTIC, UNIT_PERCENT
 
 CONF_RECEIVER_ID = "receiver_id"
+CONF_PROTOCOL = "protocol"
+CONF_CONFIDENCE = "confidence"
+CONF_TIMING_HISTOGRAM = "timing_histogram"
+
+AUTO_LOAD = ["ir_common", "sensor", "text_sensor"]
 remote_reader_ac_ns = cg.esphome_ns.namespace("remote_reader_ac")
 
 Remote_readerACClimate = remote_reader_ac_ns.class_(
@@ -13,22 +20,49 @@ Remote_readerACClimate = remote_reader_ac_ns.class_(
     cg.Component,
     remote_base.RemoteReceiverListener
 )
+DumpHistogramAction = remote_reader_ac_ns.class_("DumpHistogramAction", automation.Action)
+ClearHistogramAction = remote_reader_ac_ns.class_("ClearHistogramAction", automation.Action)
+
+# What the protocol can send; YAML may narrow it to what the unit has
+TRAITS_SCHEMA = ir_common.traits_schema(
+    ["OFF", "COOL", "DRY", "FAN_ONLY"],
+    ["AUTO", "LOW", "MEDIUM", "HIGH"],
+    (16, 30),
+)
 
-CONFIG_SCHEMA = climate.climate_schema(Remote_readerACClimate).extend(
-    {
-        cv.Required(remote_transmitter.CONF_TRANSMITTER_ID): cv.use_id(
-            remote_transmitter.RemoteTransmitterComponent
-        ),
-        cv.Optional(CONF_SENSOR): cv.use_id(sensor.Sensor),
-        cv.Optional(CONF_RECEIVER_ID): cv.use_id(remote_receiver.RemoteReceiverComponent),
-    }
-).extend(cv.COMPONENT_SCHEMA)
+CONFIG_SCHEMA = cv.All(
+    climate.climate_schema(Remote_readerACClimate).extend(
+        {
+            cv.Required(remote_transmitter.CONF_TRANSMITTER_ID): cv.use_id(
+                remote_transmitter.RemoteTransmitterComponent
+            ),
+            cv.Optional(CONF_SENSOR): cv.use_id(sensor.Sensor),
+            cv.Optional(CONF_RECEIVER_ID): cv.use_id(remote_receiver.RemoteReceiverComponent),
+            # Best protocol match for the last capture and its 0-100 score
+            cv.Optional(CONF_PROTOCOL): text_sensor.text_sensor_schema(),
+            cv.Optional(CONF_CONFIDENCE): sensor.sensor_schema(
+                unit_of_measurement=UNIT_PERCENT,
+                accuracy_decimals=0,
+            ),
+            # Mark and space clusters of every capture since boot (or the last clear)
+            cv.Optional(CONF_TIMING_HISTOGRAM): text_sensor.text_sensor_schema(
+                icon="mdi:chart-histogram",
+                entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+            ),
+        }
+    ).extend(TRAITS_SCHEMA).extend(ir_common.STATE_STORE_SCHEMA)
+    .extend(ir_common.SIGNAL_QUALITY_SCHEMA).extend(cv.COMPONENT_SCHEMA),
+    ir_common.validate_temperature_range,
+)
 
 
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
     await climate.register_climate(var, config)
+    await ir_common.traits_to_code(var, config)
+    await ir_common.state_store_to_code(var, config)
+    await ir_common.signal_quality_to_code(var, config)
 
     transmitter = await cg.get_variable(config[remote_transmitter.CONF_TRANSMITTER_ID])
     cg.add(var.set_transmitter(transmitter))
@@ -39,4 +73,36 @@ async def to_code(config):
 
     if CONF_RECEIVER_ID in config:
         receiver = await cg.get_variable(config[CONF_RECEIVER_ID])
-        cg.add(receiver.register_listener(var))
\ No newline at end of file
+        cg.add(receiver.register_listener(var))
+
+    if CONF_PROTOCOL in config:
+        sens = await text_sensor.new_text_sensor(config[CONF_PROTOCOL])
+        cg.add(var.set_protocol_sensor(sens))
+
+    if CONF_CONFIDENCE in config:
+        sens = await sensor.new_sensor(config[CONF_CONFIDENCE])
+        cg.add(var.set_confidence_sensor(sens))
+
+    if CONF_TIMING_HISTOGRAM in config:
+        sens = await text_sensor.new_text_sensor(config[CONF_TIMING_HISTOGRAM])
+        cg.add(var.set_histogram_sensor(sens))
+
+
+# ======================================================================
+# ===                            ACTIONS                             ===
+# ======================================================================
+REMOTE_READER_ACTION_SCHEMA = automation.maybe_simple_id({cv.GenerateID(): cv.use_id(Remote_readerACClimate)})
+
+
+@automation.register_action("remote_reader.dump_histogram", DumpHistogramAction, REMOTE_READER_ACTION_SCHEMA)
+async def remote_reader_dump_histogram_to_code(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    return var
+
+
+@automation.register_action("remote_reader.clear_histogram", ClearHistogramAction, REMOTE_READER_ACTION_SCHEMA)
+async def remote_reader_clear_histogram_to_code(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    return var
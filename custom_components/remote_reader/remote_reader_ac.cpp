@@ -26,69 +26,64 @@ static const int32_t SPACE_ONE_US = -1600;
 static const int32_t FINAL_PULSE_US = 650;
 static const int32_t SPACE_ZERO_MAX_US = 700;
 static const int32_t SPACE_ONE_MIN_US = 1300;
+static const size_t READER_MAX_BYTES = 32;
+static const uint32_t HISTOGRAM_PUBLISH_INTERVAL = 60000;  // ms
 // ================================================================
 // ===                ENCODE / DECODE HELPERS                    ===
 // ================================================================
-static std::optional<std::vector<uint8_t>> decode_to_bytes(remote_base::RemoteReceiveData data) {
-  if (data.size() < 32) return std::nullopt;
+// Fixed output buffer: bits past READER_MAX_BYTES are dropped. Returns the byte count.
+static size_t decode_to_bytes(remote_base::RemoteReceiveData data, uint8_t *bytes) {
+  if (data.size() < 32) return 0;
 
-  std::vector<uint8_t> bytes;
+  size_t length = 0;
   uint8_t cur = 0;
   int bit_idx = 0;
+  int uncertain = 0;
+
+  // Nearer of the two nominal spaces; this reader has no checksum to repair
+  // against, so spaces in the 700..1300 µs band are only counted and reported.
+  const int32_t space_mid = (-SPACE_ZERO_US - SPACE_ONE_US) / 2;
 
   // skip header
-  for (size_t i = 2; i + 1 < data.size(); i += 2) {
+  for (size_t i = 2; i + 1 < data.size() && length < READER_MAX_BYTES; i += 2) {
     int32_t space = std::abs(data[i + 1]);
-    bool bit = (space >= SPACE_ONE_MIN_US);
+    bool bit = (space > space_mid);
+    if (space > SPACE_ZERO_MAX_US && space < SPACE_ONE_MIN_US) uncertain++;
     cur = (cur << 1) | (bit ? 1 : 0);
     bit_idx++;
     if (bit_idx % 8 == 0) {
-      bytes.push_back(cur);
+      bytes[length++] = cur;
       cur = 0;
     }
   }
 
-  if (bit_idx % 8 != 0) {
+  if (bit_idx % 8 != 0 && length < READER_MAX_BYTES) {
     cur <<= (8 - (bit_idx % 8));
-    bytes.push_back(cur);
+    bytes[length++] = cur;
   }
 
-  return bytes;
+  if (uncertain > 0) ESP_LOGW(TAG, "RX: %d uncertain bits (space between 0 and 1 timing)", uncertain);
+  return length;
 }
 
-static std::vector<int32_t> encode_bytes_to_raw(const std::vector<uint8_t> &bytes) {
-  std::vector<int32_t> raw;
-  raw.reserve(2 + bytes.size() * 16 + 1);
-  raw.push_back(HEADER_PULSE_US);
-  raw.push_back(HEADER_SPACE_US);
-  for (auto b : bytes) {
-    for (int i = 7; i >= 0; i--) {
-      raw.push_back(PULSE_DURATION_US);
-      raw.push_back(((b >> i) & 1) ? SPACE_ONE_US : SPACE_ZERO_US);
-    }
-  }
-  raw.push_back(FINAL_PULSE_US);
-  return raw;
-}
+static const ir_common::LineCoding CODING = {ir_common::LINE_PULSE_DISTANCE, HEADER_PULSE_US, -HEADER_SPACE_US,
+                                             PULSE_DURATION_US, -SPACE_ZERO_US, -SPACE_ONE_US, FINAL_PULSE_US,
+                                             false, false};
 
 // ================================================================
 // ===                  TRANSMIT FUNCTION                        ===
 // ================================================================
-void RemoteReaderACClimate::transmit_hex(const std::vector<uint8_t> &bytes) {
+void RemoteReaderACClimate::transmit_hex(const uint8_t *bytes, size_t length) {
   if (!this->transmitter_) {
     ESP_LOGE(TAG, "No transmitter configured!");
     return;
   }
-  std::ostringstream oss;
-  for (uint8_t b : bytes)
-    oss << std::hex << std::uppercase << std::setw(2) << std::setfill('0') << (int)b << " ";
-  ESP_LOGI(TAG, "TX bytes (%d): %s", (int)bytes.size(), oss.str().c_str());
+  char hex[ir_common::hex_buffer_size(READER_MAX_BYTES)];
+  ESP_LOGI(TAG, "TX bytes (%d): %s", (int) length, ir_common::format_hex_to(hex, sizeof(hex), bytes, length));
 
-  auto raw = encode_bytes_to_raw(bytes);
   auto call = this->transmitter_->transmit();
-  auto *raw_obj = call.get_data();
-  raw_obj->set_carrier_frequency(IR_FREQUENCY);
-  raw_obj->set_data(raw);
+  call.get_data()->set_carrier_frequency(IR_FREQUENCY);
+  ir_common::encode_line(CODING, bytes, length * 8, call.get_data());
   call.perform();
 }
 
@@ -99,73 +94,157 @@ void RemoteReaderACClimate::setup() {
   this->mode = climate::CLIMATE_MODE_OFF;
   this->target_temperature = 25.0f;
   this->fan_mode = climate::CLIMATE_FAN_AUTO;
+
+  // Last state from RTC (warm boot) or the delayed flash copy (cold boot)
+  this->state_store_.setup(this->get_object_id_hash() ^ ir_common::STATE_STORE_KEY);
+  ir_common::AcState restored;
+  if (this->state_store_.load(&restored))
+    restored.apply_to(this);
+  this->state_store_.attach(this);
+  this->set_interval("persist", this->state_store_.poll_interval(),
+                     [this]() { this->state_store_.commit_if_due(millis()); });
+  if (this->histogram_sensor_ != nullptr)
+    this->set_interval("histogram", HISTOGRAM_PUBLISH_INTERVAL, [this]() { this->publish_histogram_(); });
 }
 
 void RemoteReaderACClimate::dump_config() {
   ESP_LOGCONFIG(TAG, "Remote Reader AC Climate:");
   LOG_CLIMATE("", "Remote Reader AC", this);
+  LOG_TEXT_SENSOR("  ", "Protocol", this->protocol_sensor_);
+  LOG_SENSOR("  ", "Confidence", this->confidence_sensor_);
+  LOG_TEXT_SENSOR("  ", "Timing Histogram", this->histogram_sensor_);
+  LOG_SENSOR("  ", "Signal Quality", this->signal_quality_sensor_);
+  size_t count;
+  const ir_common::ProtocolInfo *protocols = ir_common::known_protocols(&count);
+  for (size_t i = 0; i < count; i++)
+    ESP_LOGCONFIG(TAG, "  Identifies: %s", protocols[i].name);
 }
 
 climate::ClimateTraits RemoteReaderACClimate::traits() {
-  climate::ClimateTraits t;
-  t.set_supports_current_temperature(false);
-  t.set_supported_modes({
-      climate::CLIMATE_MODE_OFF,
-      climate::CLIMATE_MODE_COOL,
-      climate::CLIMATE_MODE_DRY,
-      climate::CLIMATE_MODE_FAN_ONLY,
-  });
-  t.set_supported_fan_modes({
-      climate::CLIMATE_FAN_AUTO,
-      climate::CLIMATE_FAN_LOW,
-      climate::CLIMATE_FAN_MEDIUM,
-      climate::CLIMATE_FAN_HIGH,
-  });
-  return t;
+  // Modes, fans and range come from YAML (supported_modes, ...); built once
+  return this->cached_traits_(false);
 }
 
+static ir_common::BudgetSite CONTROL_BUDGET{"remote_reader.control"};
+static ir_common::AllocSite RECEIVE_SITE{"remote_reader.on_receive"};
+static ir_common::BudgetSite RECEIVE_BUDGET{"remote_reader.on_receive"};
+
 void RemoteReaderACClimate::control(const climate::ClimateCall &call) {
+  ir_common::BudgetGuard budget_guard(CONTROL_BUDGET);
   ESP_LOGI(TAG, "Control called (stub) — implement your send logic here.");
   this->publish_state();
 }
 
 // ================================================================
-// ===                  RECEIVE FUNCTION                         ===
+// ===               PROTOCOL IDENTIFICATION                     ===
 // ================================================================
-bool RemoteReaderACClimate::on_receive(remote_base::RemoteReceiveData data) {
-  auto decoded = decode_to_bytes(data);
-  if (!decoded.has_value()) return false;
+size_t RemoteReaderACClimate::identify_(const remote_base::RawTimings &raw, ir_common::ProtocolGuess *guesses) {
+  size_t n = ir_common::identify_protocol(raw.data(), raw.size(), guesses, ir_common::PROTOCOL_ID_MAX_GUESSES);
+
+  ESP_LOGI(TAG, "Protocol: %s (confidence %u%%)", n > 0 ? guesses[0].protocol->name : "unknown",
+           n > 0 ? guesses[0].confidence : 0);
+  char hex[ir_common::hex_buffer_size(sizeof(guesses[0].bytes))];
+  for (size_t i = 0; i < n; i++) {
+    const auto &g = guesses[i];
+    ESP_LOGD(TAG, "  %-26s %3u%%  check %s  %s", g.protocol->name, g.confidence,
+             g.repaired == 0 ? "ok" : (g.repaired > 0 ? "repaired" : "FAILED"),
+             ir_common::format_hex_to(hex, sizeof(hex), g.bytes, g.length));
+  }
+  if (n > 0) {
+    // Graded against the best match's timings, which is what moving the receiver should improve
+    const ir_common::SignalQuality &quality = guesses[0].quality;
+    ESP_LOGD(TAG, "Signal quality %u%% (bit margin %uus, mark error %uus, header error %uus)", quality.score,
+             quality.bit_margin_us, quality.fixed_error_us, quality.header_error_us);
+  }
+  return n;
+}
 
-  const auto &bytes = decoded.value();
-  if (bytes.empty()) return false;
+// The protocol name only goes out when it changes: a text sensor publish
+// builds a std::string
+void RemoteReaderACClimate::publish_identity_(const ir_common::ProtocolGuess *guesses, size_t n) {
+  const char *name = n > 0 ? guesses[0].protocol->name : "unknown";
+  if (this->protocol_sensor_ != nullptr && this->protocol_sensor_->state != name)
+    this->protocol_sensor_->publish_state(name);
+  if (this->confidence_sensor_ != nullptr)
+    this->confidence_sensor_->publish_state(n > 0 ? guesses[0].confidence : 0);
+  if (n > 0 && this->signal_quality_sensor_ != nullptr)
+    this->signal_quality_sensor_->publish_state(guesses[0].quality.score);
+}
 
-  // Print the received bytes as HEX
-  std::ostringstream oss;
-  for (uint8_t b : bytes)
-    oss << std::hex << std::uppercase << std::setw(2) << std::setfill('0')
-        << static_cast<int>(b) << " ";
-  ESP_LOGI(TAG, "RX bytes (%d): %s", (int)bytes.size(), oss.str().c_str());
+// ================================================================
+// ===                   TIMING HISTOGRAM                        ===
+// ================================================================
+// Formatting and publishing allocate, so the text sensor follows the
+// histogram on an interval, only when new captures came in
+void RemoteReaderACClimate::publish_histogram_() {
+  if (this->histogram_sensor_ == nullptr || this->histogram_.frames() == this->histogram_published_frames_)
+    return;
+  this->histogram_published_frames_ = this->histogram_.frames();
+  char text[192];  // under Home Assistant's 255-character state limit
+  this->histogram_sensor_->publish_state(this->histogram_.format(text, sizeof(text)));
+}
+
+void RemoteReaderACClimate::dump_histogram() {
+  this->publish_histogram_();
+  ESP_LOGI(TAG, "Timing histogram over %u captures:", (unsigned) this->histogram_.frames());
+  for (size_t bin = 0; bin < ir_common::HISTOGRAM_BINS; bin++) {
+    uint16_t marks = this->histogram_.marks(bin);
+    uint16_t spaces = this->histogram_.spaces(bin);
+    if (marks == 0 && spaces == 0)
+      continue;
+    uint32_t start = ir_common::TimingHistogram::bin_start(bin);
+    if (bin + 1 < ir_common::HISTOGRAM_BINS) {
+      ESP_LOGI(TAG, "  %5u-%5u us  marks %5u  spaces %5u", (unsigned) start,
+               (unsigned) (start + ir_common::TimingHistogram::bin_width(bin) - 1), marks, spaces);
+    } else {
+      ESP_LOGI(TAG, "  %5u+      us  marks %5u  spaces %5u", (unsigned) start, marks, spaces);
+    }
+  }
+}
+
+void RemoteReaderACClimate::clear_histogram() {
+  this->histogram_.clear();
+  this->histogram_published_frames_ = 0;
+  ESP_LOGI(TAG, "Timing histogram cleared");
+  if (this->histogram_sensor_ != nullptr)
+    this->histogram_sensor_->publish_state("");
+}
+
+// ================================================================
+// ===                  RECEIVE FUNCTION                         ===
+// ================================================================
+bool RemoteReaderACClimate::on_receive(remote_base::RemoteReceiveData data) {
+  // Overruns on every frame: the retransmit below waits in delay()
+  ir_common::BudgetGuard budget_guard(RECEIVE_BUDGET);
+  uint8_t bytes[READER_MAX_BYTES];
+  ir_common::ProtocolGuess guesses[ir_common::PROTOCOL_ID_MAX_GUESSES];
+  size_t length, n = 0;
+  {
+    // Decoding and identification must not allocate; publishes and the
+    // retransmit (which waits in delay()) run after the guard
+    ir_common::AllocGuard alloc_guard(RECEIVE_SITE);
+    // Every capture counts, decodable or not
+    const auto &raw = data.get_raw_data();
+    this->histogram_.add(raw.data(), raw.size());
+
+    length = decode_to_bytes(data, bytes);
+    if (length != 0) {
+      // Print the received bytes as HEX
+      char hex[ir_common::hex_buffer_size(READER_MAX_BYTES)];
+      ESP_LOGI(TAG, "RX bytes (%d): %s", (int) length, ir_common::format_hex_to(hex, sizeof(hex), bytes, length));
+      // The byte dump above assumes Carrier timings; the fingerprint does not
+      n = this->identify_(raw, guesses);
+    }
+  }
+  if (length == 0) return false;
+  this->publish_identity_(guesses, n);
 
   // --- Wait 2 seconds before retransmitting ---
   ESP_LOGI(TAG, "Waiting 2 seconds before retransmit...");
   delay(2000);
 
   // --- Transmit the same code back out ---
-  this->transmit_hex(bytes);
-
-  // --- Optional simple mode preview (for log only) ---
-  if (bytes.size() >= 3) {
-    const uint8_t b1 = bytes[1];
-    const uint8_t b2 = bytes[2];
-
-    if (b1 == 0x00) {
-      this->mode = climate::CLIMATE_MODE_OFF;
-    } else {
-      this->mode = climate::CLIMATE_MODE_COOL;
-      this->target_temperature = 15.0f + ((b2 - 0x9E) / 2.0f);
-    }
-    this->publish_state();
-  }
+  this->transmit_hex(bytes, length);
 
   return true;
 }
@@ -4,10 +4,17 @@
 #include "esphome/components/remote_transmitter/remote_transmitter.h"
 #include "esphome/components/sensor/sensor.h"
 #include "esphome/components/remote_receiver/remote_receiver.h"
+#include "esphome/components/text_sensor/text_sensor.h"
+#include "esphome/components/ir_common/configured_traits.h"
+#include "esphome/components/ir_common/alloc_stats.h"
+#include "esphome/components/ir_common/hex_format.h"
+#include "esphome/components/ir_common/loop_budget.h"
+#include "esphome/components/ir_common/line_coding.h"
+#include "esphome/components/ir_common/protocol_id.h"
+#include "esphome/components/ir_common/state_store.h"
+#include "esphome/components/ir_common/signal_quality.h"
+#include "esphome/components/ir_common/timing_histogram.h"
 #include "esphome/core/log.h"
-#include <vector>
-#include <sstream>
-#include <iomanip>
 #include <optional>
 #include <cstdint>
 
@@ -16,12 +23,18 @@ namespace remote_reader_ac {
 
 class RemoteReaderACClimate : public climate::Climate,
                               public Component,
-                              public remote_base::RemoteReceiverListener {
+                              public remote_base::RemoteReceiverListener,
+                              public ir_common::ConfiguredTraits {
  public:
   void set_transmitter(remote_transmitter::RemoteTransmitterComponent *transmitter) {
     this->transmitter_ = transmitter;
   }
   void set_sensor(sensor::Sensor *sensor) { this->sensor_ = sensor; }
+  void set_flash_write_delay(uint32_t delay) { this->state_store_.set_flash_delay(delay); }
+  void set_signal_quality_sensor(sensor::Sensor *sensor) { this->signal_quality_sensor_ = sensor; }
+  void set_protocol_sensor(text_sensor::TextSensor *sensor) { this->protocol_sensor_ = sensor; }
+  void set_confidence_sensor(sensor::Sensor *sensor) { this->confidence_sensor_ = sensor; }
+  void set_histogram_sensor(text_sensor::TextSensor *sensor) { this->histogram_sensor_ = sensor; }
 
   climate::ClimateTraits traits() override;
   void control(const climate::ClimateCall &call) override;
@@ -29,13 +42,28 @@ class RemoteReaderACClimate : public climate::Climate,
   void dump_config() override;
   bool on_receive(remote_base::RemoteReceiveData data) override;
 
-  // transmit any-length vector of bytes
-  void transmit_hex(const std::vector<uint8_t> &bytes);
+  // transmit any number of bytes, Carrier timings
+  void transmit_hex(const uint8_t *bytes, size_t length);
+
+  // remote_reader.dump_histogram / remote_reader.clear_histogram
+  void dump_histogram();
+  void clear_histogram();
 
  protected:
   remote_transmitter::RemoteTransmitterComponent *transmitter_{nullptr};
+  // Logs the ranking into `guesses` (PROTOCOL_ID_MAX_GUESSES), returns how many matched
+  size_t identify_(const remote_base::RawTimings &raw, ir_common::ProtocolGuess *guesses);
+  void publish_identity_(const ir_common::ProtocolGuess *guesses, size_t n);
+  void publish_histogram_();
+
   sensor::Sensor *sensor_{nullptr};
-  int swing_level_{0};
+  sensor::Sensor *signal_quality_sensor_{nullptr};
+  ir_common::StateStore state_store_;
+  text_sensor::TextSensor *protocol_sensor_{nullptr};
+  sensor::Sensor *confidence_sensor_{nullptr};
+  text_sensor::TextSensor *histogram_sensor_{nullptr};
+  ir_common::TimingHistogram histogram_;
+  uint32_t histogram_published_frames_{0};
 };
 
 }  // namespace remote_reader_ac
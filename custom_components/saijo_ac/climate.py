@@ -1,6 +1,7 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components import climate, remote_transmitter, sensor, remote_receiver, remote_base
+from esphome.components import ir_common
 from esphome.const import (
     CONF_ID,
     CONF_SENSOR,
@@ -8,6 +9,8 @@ from esphome.const import (
 
 CONF_RECEIVER_ID = "receiver_id"
 
+AUTO_LOAD = ["ir_common", "sensor"]
+
 saijo_ac_ns = cg.esphome_ns.namespace("saijo_ac")
 
 SaijoACClimate = saijo_ac_ns.class_(
@@ -17,17 +20,28 @@ SaijoACClimate = saijo_ac_ns.class_(
     remote_base.RemoteReceiverListener # Correct inheritance
 )
 
-CONFIG_SCHEMA = climate.climate_schema(SaijoACClimate).extend(
-    {
-        cv.Required(remote_transmitter.CONF_TRANSMITTER_ID): cv.use_id(
-            remote_transmitter.RemoteTransmitterComponent
-        ),
-        cv.Optional(CONF_SENSOR): cv.use_id(sensor.Sensor),
-        cv.Optional(CONF_RECEIVER_ID): cv.use_id(
-            remote_receiver.RemoteReceiverComponent
-        ),
-    }
-).extend(cv.COMPONENT_SCHEMA)
+# What the protocol can send; YAML may narrow it to what the unit has
+TRAITS_SCHEMA = ir_common.traits_schema(
+    ["OFF", "COOL", "DRY", "FAN_ONLY"],
+    ["AUTO", "LOW", "MEDIUM", "HIGH"],
+    (22, 27),
+)
+
+CONFIG_SCHEMA = cv.All(
+    climate.climate_schema(SaijoACClimate).extend(
+        {
+            cv.Required(remote_transmitter.CONF_TRANSMITTER_ID): cv.use_id(
+                remote_transmitter.RemoteTransmitterComponent
+            ),
+            cv.Optional(CONF_SENSOR): cv.use_id(sensor.Sensor),
+            cv.Optional(CONF_RECEIVER_ID): cv.use_id(
+                remote_receiver.RemoteReceiverComponent
+            ),
+        }
+    ).extend(TRAITS_SCHEMA).extend(ir_common.STATE_STORE_SCHEMA)
+    .extend(ir_common.SIGNAL_QUALITY_SCHEMA).extend(cv.COMPONENT_SCHEMA),
+    ir_common.validate_temperature_range,
+)
 
 
 async def to_code(config):
@@ -35,6 +49,9 @@ async def to_code(config):
 
     await cg.register_component(var, config)
     await climate.register_climate(var, config)
+    await ir_common.traits_to_code(var, config)
+    await ir_common.state_store_to_code(var, config)
+    await ir_common.signal_quality_to_code(var, config)
 
     transmitter = await cg.get_variable(config[remote_transmitter.CONF_TRANSMITTER_ID])
     cg.add(var.set_transmitter(transmitter))
@@ -1,5 +1,6 @@
 
 #include "saijo_ac.h"
+#include <cstring>
 
 namespace esphome {
 namespace saijo_ac {
@@ -16,7 +17,10 @@ static const int32_t PULSE_DURATION_US = 650;
 static const int32_t SPACE_ZERO_US = -500;
 static const int32_t SPACE_ONE_US = -1600;
 static const int32_t FINAL_PULSE_US = 650;
-static const int32_t SPACE_ONE_MIN_US = 1300;
+// Sent with ir_common::encode_line; received frames are graded against it
+static const ir_common::LineCoding CODING = {ir_common::LINE_PULSE_DISTANCE, HEADER_PULSE_US, -HEADER_SPACE_US,
+                                             PULSE_DURATION_US, -SPACE_ZERO_US, -SPACE_ONE_US, FINAL_PULSE_US,
+                                             false, false};
 
 // ======================================================================
 // ===                9-BYTE CODEBOOK DEFINITIONS                     ===
@@ -57,42 +61,90 @@ static const std::array<uint8_t, 9> CODE_DRY_25_AUTO = { 0xA0, 0x90, 0xB2, 0x04,
 static const std::array<uint8_t, 9> CODE_DRY_26_AUTO = { 0xA0, 0x90, 0xB4, 0x03, 0x24, 0x0B, 0x64, 0x00, 0xEF };
 static const std::array<uint8_t, 9> CODE_DRY_27_AUTO = { 0xA0, 0x90, 0xB6, 0x03, 0x23, 0x0B, 0x63, 0x00, 0xAA };
 
+// Frame for each state the remote can send, keyed by packed state
+struct SaijoCode {
+  ir_common::AcState state;
+  const std::array<uint8_t, 9> *code;
+};
+
+// Short names for the table (LOW / HIGH are Arduino macros)
+static const uint8_t M_OFF = climate::CLIMATE_MODE_OFF;
+static const uint8_t M_COOL = climate::CLIMATE_MODE_COOL;
+static const uint8_t M_DRY = climate::CLIMATE_MODE_DRY;
+static const uint8_t M_FAN = climate::CLIMATE_MODE_FAN_ONLY;
+static const uint8_t F_AUTO = climate::CLIMATE_FAN_AUTO;
+static const uint8_t F_LOW = climate::CLIMATE_FAN_LOW;
+static const uint8_t F_MED = climate::CLIMATE_FAN_MEDIUM;
+static const uint8_t F_HIGH = climate::CLIMATE_FAN_HIGH;
+
+static const SaijoCode CODES[] = {
+    {{M_OFF, ir_common::CODEBOOK_ANY, 0}, &CODE_OFF},
+    {{M_COOL, F_AUTO, 22}, &CODE_COOL_22_AUTO},
+    {{M_COOL, F_AUTO, 23}, &CODE_COOL_23_AUTO},
+    {{M_COOL, F_AUTO, 24}, &CODE_COOL_24_AUTO},
+    {{M_COOL, F_AUTO, 25}, &CODE_COOL_25_AUTO},
+    {{M_COOL, F_AUTO, 26}, &CODE_COOL_26_AUTO},
+    {{M_COOL, F_AUTO, 27}, &CODE_COOL_27_AUTO},
+    {{M_COOL, F_LOW, 22}, &CODE_COOL_22_LOW},
+    {{M_COOL, F_LOW, 23}, &CODE_COOL_23_LOW},
+    {{M_COOL, F_LOW, 24}, &CODE_COOL_24_LOW},
+    {{M_COOL, F_LOW, 25}, &CODE_COOL_25_LOW},
+    {{M_COOL, F_LOW, 26}, &CODE_COOL_26_LOW},
+    {{M_COOL, F_LOW, 27}, &CODE_COOL_27_LOW},
+    {{M_COOL, F_MED, 22}, &CODE_COOL_22_MEDIUM},
+    {{M_COOL, F_MED, 23}, &CODE_COOL_23_MEDIUM},
+    {{M_COOL, F_MED, 24}, &CODE_COOL_24_MEDIUM},
+    {{M_COOL, F_MED, 25}, &CODE_COOL_25_MEDIUM},
+    {{M_COOL, F_MED, 26}, &CODE_COOL_26_MEDIUM},
+    {{M_COOL, F_MED, 27}, &CODE_COOL_27_MEDIUM},
+    {{M_COOL, F_HIGH, 22}, &CODE_COOL_22_HIGH},
+    {{M_COOL, F_HIGH, 23}, &CODE_COOL_23_HIGH},
+    {{M_COOL, F_HIGH, 24}, &CODE_COOL_24_HIGH},
+    {{M_COOL, F_HIGH, 25}, &CODE_COOL_25_HIGH},
+    {{M_COOL, F_HIGH, 26}, &CODE_COOL_26_HIGH},
+    {{M_COOL, F_HIGH, 27}, &CODE_COOL_27_HIGH},
+    {{M_DRY, F_AUTO, 22}, &CODE_DRY_22_AUTO},
+    {{M_DRY, F_AUTO, 23}, &CODE_DRY_23_AUTO},
+    {{M_DRY, F_AUTO, 24}, &CODE_DRY_24_AUTO},
+    {{M_DRY, F_AUTO, 25}, &CODE_DRY_25_AUTO},
+    {{M_DRY, F_AUTO, 26}, &CODE_DRY_26_AUTO},
+    {{M_DRY, F_AUTO, 27}, &CODE_DRY_27_AUTO},
+    {{M_FAN, F_AUTO, 0}, &CODE_FAN_ONLY_AUTO},
+    {{M_FAN, F_LOW, 0}, &CODE_FAN_ONLY_LOW},
+    {{M_FAN, F_MED, 0}, &CODE_FAN_ONLY_MEDIUM},
+    {{M_FAN, F_HIGH, 0}, &CODE_FAN_ONLY_HIGH},
+};
+
+static const std::array<uint8_t, 9> *find_code(ir_common::AcState state) {
+  for (const auto &entry : CODES) {
+    if (entry.state == state)
+      return entry.code;
+  }
+  return nullptr;
+}
+
 // ======================================================================
 // ===                  RAW ENCODE / DECODE HELPERS                   ===
 // ======================================================================
-static std::optional<std::array<uint8_t,9>> decode_to_bytes(remote_base::RemoteReceiveData data) {
+// Each space is read as the nearer of 0/1 rather than "1 above 1300 µs,
+// else 0". B8 is not a checksum we can compute, so uncertain bits cannot be
+// repaired; they are reported instead of silently accepted.
+static std::optional<std::array<uint8_t,9>> decode_to_bytes(remote_base::RemoteReceiveData data,
+                                                           ir_common::SignalQuality *quality) {
   if (data.size() < 147) return std::nullopt;
+  const auto &raw = data.get_raw_data();
+  ir_common::SoftBits soft;
+  if (ir_common::decode_soft_bits(raw.data(), raw.size(), 3, 72, -SPACE_ZERO_US, -SPACE_ONE_US, &soft) != 72)
+    return std::nullopt;
+  size_t weak = soft.weak_count();
+  if (weak != 0)
+    ESP_LOGW(TAG, "RX frame has %u uncertain bits (no checksum to verify them)", (unsigned) weak);
+  *quality = ir_common::measure_signal(CODING, raw.data(), raw.size(), 72);
   std::array<uint8_t,9> bytes{};
-  int bit_index = 0;
-
-  for (size_t i = 2; i + 1 < data.size() && bit_index < 72; i += 2) {
-    int32_t space_duration = std::abs(data[i + 1]);
-    bool bit = (space_duration >= SPACE_ONE_MIN_US);
-    size_t byte_index = bit_index / 8;
-    bytes[byte_index] <<= 1;
-    bytes[byte_index] |= bit ? 1 : 0;
-    bit_index++;
-  }
-  int remaining = 8 - (bit_index % 8);
-  if (remaining != 8) bytes[bit_index / 8] <<= remaining;
+  memcpy(bytes.data(), soft.bytes, bytes.size());
   return bytes;
 }
 
-static std::vector<int32_t> encode_bytes_to_raw(const std::array<uint8_t,9> &bytes) {
-  std::vector<int32_t> raw;
-  raw.reserve(147);
-  raw.push_back(HEADER_PULSE_US);
-  raw.push_back(HEADER_SPACE_US);
-  for (auto b : bytes) {
-    for (int i = 7; i >= 0; i--) {
-      raw.push_back(PULSE_DURATION_US);
-      raw.push_back(((b >> i) & 1) ? SPACE_ONE_US : SPACE_ZERO_US);
-    }
-  }
-  raw.push_back(FINAL_PULSE_US);
-  return raw;
-}
-
 // ======================================================================
 // ===                     TRANSMIT FUNCTIONS                         ===
 // ======================================================================
@@ -101,11 +153,9 @@ void SaijoACClimate::transmit_hex_9b(const std::array<uint8_t,9> &bytes) {
     ESP_LOGE(TAG, "Transmitter not configured!");
     return;
   }
-  std::vector<int32_t> raw = encode_bytes_to_raw(bytes);
   auto call = this->transmitter_->transmit();
-  auto *raw_obj = call.get_data();
-  raw_obj->set_carrier_frequency(IR_FREQUENCY);
-  raw_obj->set_data(raw);
+  call.get_data()->set_carrier_frequency(IR_FREQUENCY);
+  ir_common::encode_line(CODING, bytes.data(), bytes.size() * 8, call.get_data());
   call.perform();
 }
 
@@ -116,107 +166,58 @@ void SaijoACClimate::setup() {
   this->mode = climate::CLIMATE_MODE_OFF;
   this->target_temperature = 25.0f;
   this->fan_mode = climate::CLIMATE_FAN_AUTO;
+
+  // Last state from RTC (warm boot) or the delayed flash copy (cold boot)
+  this->state_store_.setup(this->get_object_id_hash() ^ ir_common::STATE_STORE_KEY);
+  ir_common::AcState restored;
+  if (this->state_store_.load(&restored))
+    restored.apply_to(this);
+  this->state_store_.attach(this);
+  this->set_interval("persist", this->state_store_.poll_interval(),
+                     [this]() { this->state_store_.commit_if_due(millis()); });
 }
 
 void SaijoACClimate::dump_config() {
   ESP_LOGCONFIG(TAG, "Saijo AC Climate:");
   LOG_CLIMATE("", "Saijo AC", this);
+  LOG_SENSOR("  ", "Signal Quality", this->signal_quality_sensor_);
 }
 
 climate::ClimateTraits SaijoACClimate::traits() {
-  climate::ClimateTraits traits;
-  traits.set_supports_current_temperature(false);
-  traits.set_supported_modes({
-    climate::CLIMATE_MODE_OFF,
-    climate::CLIMATE_MODE_COOL,
-    climate::CLIMATE_MODE_DRY,
-    climate::CLIMATE_MODE_FAN_ONLY,
-  });
-  traits.set_supported_fan_modes({
-    climate::CLIMATE_FAN_AUTO,
-    climate::CLIMATE_FAN_LOW,
-    climate::CLIMATE_FAN_MEDIUM,
-    climate::CLIMATE_FAN_HIGH,
-  });
-  traits.set_visual_min_temperature(22.0f);
-  traits.set_visual_max_temperature(27.0f);
-  traits.set_visual_temperature_step(1.0f);
-  return traits;
+  // Modes, fans and range come from YAML (supported_modes, ...); built once
+  return this->cached_traits_(false);
 }
 
+static ir_common::AllocSite CONTROL_SITE{"saijo_ac.control"};
+static ir_common::BudgetSite CONTROL_BUDGET{"saijo_ac.control"};
+static ir_common::AllocSite RECEIVE_SITE{"saijo_ac.on_receive"};
+static ir_common::BudgetSite RECEIVE_BUDGET{"saijo_ac.on_receive"};
+
 void SaijoACClimate::control(const climate::ClimateCall &call) {
+  ir_common::AllocGuard alloc_guard(CONTROL_SITE);
+  ir_common::BudgetGuard budget_guard(CONTROL_BUDGET);
   if (call.get_mode().has_value()) this->mode = *call.get_mode();
   if (call.get_target_temperature().has_value()) this->target_temperature = *call.get_target_temperature();
   if (call.get_fan_mode().has_value()) this->fan_mode = *call.get_fan_mode();
 
+  // OFF ignores fan and temperature, DRY always runs the fan on AUTO,
+  // FAN_ONLY ignores temperature.
+  auto state = ir_common::AcState::from_climate(*this);
   if (this->mode == climate::CLIMATE_MODE_OFF) {
-    this->transmit_hex_9b(CODE_OFF);
+    state = ir_common::AcState(climate::CLIMATE_MODE_OFF, ir_common::CODEBOOK_ANY, 0);
+  } else if (this->mode == climate::CLIMATE_MODE_DRY) {
+    state = state.with_fan(climate::CLIMATE_FAN_AUTO);
+  } else if (this->mode == climate::CLIMATE_MODE_FAN_ONLY) {
+    state = state.with_temperature(0);
   }
 
-  // === COOL MODE ===
-  else if (this->mode == climate::CLIMATE_MODE_COOL) {
-    float t = this->target_temperature;
-    if (!this->fan_mode.has_value()) {
-      ESP_LOGW(TAG, "Fan mode not set, skipping transmission.");
-      return;
-    }
-
-    switch (static_cast<int>(*this->fan_mode)) {  // ✅ dereferenced
-      case static_cast<int>(climate::CLIMATE_FAN_AUTO):
-        if (t == 22) this->transmit_hex_9b(CODE_COOL_22_AUTO);
-        else if (t == 23) this->transmit_hex_9b(CODE_COOL_23_AUTO);
-        else if (t == 24) this->transmit_hex_9b(CODE_COOL_24_AUTO);
-        else if (t == 25) this->transmit_hex_9b(CODE_COOL_25_AUTO);
-        else if (t == 26) this->transmit_hex_9b(CODE_COOL_26_AUTO);
-        else if (t == 27) this->transmit_hex_9b(CODE_COOL_27_AUTO);
-        break;
-      default:
-        ESP_LOGW(TAG, "Fan speed mode not mapped yet for COOL.");
-        break;
-    }
-  }
-
-  // === DRY MODE ===
-  else if (this->mode == climate::CLIMATE_MODE_DRY) {
-    float t = this->target_temperature;
-
-    // DRY mode typically uses AUTO fan only
-    if (t == 22) this->transmit_hex_9b(CODE_DRY_22_AUTO);
-    else if (t == 23) this->transmit_hex_9b(CODE_DRY_23_AUTO);
-    else if (t == 24) this->transmit_hex_9b(CODE_DRY_24_AUTO);
-    else if (t == 25) this->transmit_hex_9b(CODE_DRY_25_AUTO);
-    else if (t == 26) this->transmit_hex_9b(CODE_DRY_26_AUTO);
-    else if (t == 27) this->transmit_hex_9b(CODE_DRY_27_AUTO);
-    else {
-      ESP_LOGW(TAG, "Unsupported temperature %.1f for DRY mode", t);
-    }
-  }
-
-  // === FAN-ONLY MODE ===
-  else if (this->mode == climate::CLIMATE_MODE_FAN_ONLY) {
-    if (!this->fan_mode.has_value()) {
-      ESP_LOGW(TAG, "Fan mode not set, skipping transmission.");
-      return;
-    }
-
-    switch (static_cast<int>(*this->fan_mode)) {  // ✅ dereferenced
-      case static_cast<int>(climate::CLIMATE_FAN_LOW):
-        this->transmit_hex_9b(CODE_FAN_ONLY_LOW);
-        break;
-      case static_cast<int>(climate::CLIMATE_FAN_MEDIUM):
-        this->transmit_hex_9b(CODE_FAN_ONLY_MEDIUM);
-        break;
-      case static_cast<int>(climate::CLIMATE_FAN_HIGH):
-        this->transmit_hex_9b(CODE_FAN_ONLY_HIGH);
-        break;
-      default:
-        this->transmit_hex_9b(CODE_FAN_ONLY_AUTO);
-        break;
-    }
-  }
-
-  else {
-    ESP_LOGW(TAG, "No matching 9-byte code found for state.");
+  const auto *code = find_code(state);
+  if (code == nullptr && this->mode == climate::CLIMATE_MODE_FAN_ONLY)
+    code = find_code(state.with_fan(climate::CLIMATE_FAN_AUTO));
+  if (code != nullptr) {
+    this->transmit_hex_9b(*code);
+  } else {
+    ESP_LOGW(TAG, "No 9-byte code for mode %d, fan %d, temp %.1f", state.mode(), state.fan(), state.temperature());
   }
 
   this->publish_state();
@@ -227,9 +228,16 @@ void SaijoACClimate::control(const climate::ClimateCall &call) {
 // ======================================================================
 
 bool SaijoACClimate::on_receive(remote_base::RemoteReceiveData data) {
+  ir_common::AllocGuard alloc_guard(RECEIVE_SITE);
+  ir_common::BudgetGuard budget_guard(RECEIVE_BUDGET);
   // Decode 9 bytes instead of 8
-  auto decoded = decode_to_bytes(data);
+  ir_common::SignalQuality quality;
+  auto decoded = decode_to_bytes(data, &quality);
   if (!decoded.has_value()) return false;
+  ESP_LOGD(TAG, "Signal quality %u%% (bit margin %uus, mark error %uus, header error %uus)", quality.score,
+           quality.bit_margin_us, quality.fixed_error_us, quality.header_error_us);
+  if (this->signal_quality_sensor_ != nullptr)
+    this->signal_quality_sensor_->publish_state(quality.score);
 
   const auto &bytes = decoded.value();
   if (bytes.size() < 9) return false;
@@ -248,12 +256,12 @@ bool SaijoACClimate::on_receive(remote_base::RemoteReceiveData data) {
            b0,b1,b2,b3,b4,b5,b6,b7,b8);
 
   // --- OFF detection (observed OFF: A0 00 B2 01 09 09 09 00 ??, accept any with b1==00)
+  // Repeats of the current state are not published again
   if (b1 == 0x00) {
-    this->mode = climate::CLIMATE_MODE_OFF;
-    this->target_temperature = 15.0f + ((b2 - 0x9E) / 2.0f);
-    this->fan_mode = climate::CLIMATE_FAN_AUTO;
-    this->publish_state();
-    ESP_LOGI(TAG, "RX OFF: temp=%.1f", this->target_temperature);
+    float temperature = 15.0f + ((b2 - 0x9E) / 2.0f);
+    if (ir_common::AcState(climate::CLIMATE_MODE_OFF, climate::CLIMATE_FAN_AUTO, temperature).apply_to(this))
+      this->publish_state();
+    ESP_LOGI(TAG, "RX OFF: temp=%.1f", temperature);
     return true;
   }
 
@@ -261,31 +269,36 @@ bool SaijoACClimate::on_receive(remote_base::RemoteReceiveData data) {
   if (b1 != 0x90) return false;
 
   // --- Common temperature field ---
-  this->target_temperature = 15.0f + ((b2 - 0x9E) / 2.0f);
+  const float temperature = 15.0f + ((b2 - 0x9E) / 2.0f);
 
   // --- Robust mode resolution ---
   const bool b4_plus40 = (b4 & 0x40) != 0;
   const bool b6_plus40 = (b6 & 0x40) != 0;
 
-  if ( b4_plus40 && !b6_plus40)      this->mode = climate::CLIMATE_MODE_FAN_ONLY;
-  else if (!b4_plus40 &&  b6_plus40) this->mode = climate::CLIMATE_MODE_DRY;
-  else                                this->mode = climate::CLIMATE_MODE_COOL;  // default
+  uint8_t mode;
+  if ( b4_plus40 && !b6_plus40)      mode = climate::CLIMATE_MODE_FAN_ONLY;
+  else if (!b4_plus40 &&  b6_plus40) mode = climate::CLIMATE_MODE_DRY;
+  else                                mode = climate::CLIMATE_MODE_COOL;  // default
 
   // --- Fan speed decode (use B3 upper nibble) ---
   const uint8_t fan_code = (b3 >> 4) & 0x0F;
+  uint8_t fan;
   switch (fan_code) {
-    case 0x2: this->fan_mode = climate::CLIMATE_FAN_LOW;    break;
-    case 0x6: this->fan_mode = climate::CLIMATE_FAN_MEDIUM; break;
-    case 0x8: this->fan_mode = climate::CLIMATE_FAN_HIGH;   break;
-    default:  this->fan_mode = climate::CLIMATE_FAN_AUTO;   break;
+    case 0x2: fan = climate::CLIMATE_FAN_LOW;    break;
+    case 0x6: fan = climate::CLIMATE_FAN_MEDIUM; break;
+    case 0x8: fan = climate::CLIMATE_FAN_HIGH;   break;
+    default:  fan = climate::CLIMATE_FAN_AUTO;   break;
   }
 
   // --- Swing decode (vertical) from B5 high nibble ---
+  // 0 = swinging, 1-5 = fixed louvre position. Logged only: the traits
+  // declare no swing modes, so swing_mode is left alone.
   const uint8_t swing_high = (b5 >> 4) & 0x0F;
+  int swing_level = -1;
   if (swing_high == 0x0) {
-    this->swing_level_ = 0;  // swing on
+    swing_level = 0;
   } else if (swing_high >= 0x2 && swing_high <= 0xA && (swing_high % 2 == 0)) {
-    this->swing_level_ = static_cast<int>((swing_high - 0x2) / 2 + 1);
+    swing_level = (swing_high - 0x2) / 2 + 1;
   }
 
   // --- Optional: log 9th byte diagnostics ---
@@ -293,10 +306,10 @@ bool SaijoACClimate::on_receive(remote_base::RemoteReceiveData data) {
 
   ESP_LOGI(TAG,
            "RX ON: mode=%d, temp=%.1f, fan=%d, swing=%d (b4=0x%02X, b6=0x%02X, b3=0x%02X, b5=0x%02X, b8=0x%02X)",
-           this->mode, this->target_temperature, this->fan_mode, this->swing_level_,
-           b4, b6, b3, b5, b8);
+           mode, temperature, fan, swing_level, b4, b6, b3, b5, b8);
 
-  this->publish_state();
+  if (ir_common::AcState(mode, fan, temperature).apply_to(this))
+    this->publish_state();
   return true;
 }
 }  // namespace saijo_ac
@@ -6,6 +6,14 @@
 #include "esphome/components/sensor/sensor.h"
 #include "esphome/components/remote_receiver/remote_receiver.h"
 #include "esphome/core/log.h"
+#include "esphome/components/ir_common/configured_traits.h"
+#include "esphome/components/ir_common/ac_state.h"
+#include "esphome/components/ir_common/alloc_stats.h"
+#include "esphome/components/ir_common/loop_budget.h"
+#include "esphome/components/ir_common/line_coding.h"
+#include "esphome/components/ir_common/soft_bits.h"
+#include "esphome/components/ir_common/state_store.h"
+#include "esphome/components/ir_common/signal_quality.h"
 
 #include <array>
 #include <vector>
@@ -20,12 +28,15 @@ namespace saijo_ac {
 
 class SaijoACClimate : public climate::Climate,
                        public Component,
-                       public remote_base::RemoteReceiverListener {
+                       public remote_base::RemoteReceiverListener,
+                       public ir_common::ConfiguredTraits {
  public:
   void set_transmitter(remote_transmitter::RemoteTransmitterComponent *transmitter) {
     this->transmitter_ = transmitter;
   }
   void set_sensor(sensor::Sensor *sensor) { this->sensor_ = sensor; }
+  void set_flash_write_delay(uint32_t delay) { this->state_store_.set_flash_delay(delay); }
+  void set_signal_quality_sensor(sensor::Sensor *sensor) { this->signal_quality_sensor_ = sensor; }
 
   climate::ClimateTraits traits() override;
   void control(const climate::ClimateCall &call) override;
@@ -36,12 +47,12 @@ class SaijoACClimate : public climate::Climate,
  protected:
   // --- 9-byte helpers ---
   void transmit_hex_9b(const std::array<uint8_t, 9> &bytes);
-  void transmit_raw_code_(const int32_t *data, size_t len);
 
   // --- Members ---
   remote_transmitter::RemoteTransmitterComponent *transmitter_{nullptr};
   sensor::Sensor *sensor_{nullptr};
-  int swing_level_{0};
+  sensor::Sensor *signal_quality_sensor_{nullptr};
+  ir_common::StateStore state_store_;
 };
 
 }  // namespace saijo_ac
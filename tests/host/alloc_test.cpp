@@ -0,0 +1,187 @@
+// Steady-state heap test for every platform's hot paths.
+//
+// Each platform is driven through the same pass twice: control() for a
+// handful of states, the sent frame fed back into on_receive() of a second
+// instance (the receiver side), and a temperature sensor update. The first
+// pass may grow buffers; the second must not allocate at all, and no
+// AllocGuard may have counted a violation. Build and run with
+// `make -C tests/host`.
+#include <cstdio>
+#include <cstdlib>
+#include "esphome/components/carrier_ac/carrier_ac.h"
+#include "esphome/components/carrier_cartridge_rx/carrier_cartridge_climate.h"
+#include "esphome/components/carrier_cartridge_rx/carrier_cartridge_rx.h"
+#include "esphome/components/ir_capture/ir_capture.h"
+#include "esphome/components/ir_common/alloc_stats.h"
+#include "esphome/components/mitsubishi_ac/mitsubishi_ac.h"
+#include "esphome/components/raw_ac/raw_ac.h"
+#include "esphome/components/remote_reader/remote_reader_ac.h"
+#include "esphome/components/saijo_ac/saijo_ac.h"
+
+using namespace esphome;
+using climate::ClimateFanMode;
+using climate::ClimateMode;
+
+struct Step {
+  ClimateMode mode;
+  float temperature;
+  ClimateFanMode fan;
+};
+
+// Walks through on, a change of each setting, and off
+static const Step STEPS[] = {
+    {climate::CLIMATE_MODE_COOL, 24, climate::CLIMATE_FAN_AUTO},
+    {climate::CLIMATE_MODE_COOL, 26, climate::CLIMATE_FAN_HIGH},
+    {climate::CLIMATE_MODE_FAN_ONLY, 26, climate::CLIMATE_FAN_LOW},
+    {climate::CLIMATE_MODE_DRY, 25, climate::CLIMATE_FAN_AUTO},
+    {climate::CLIMATE_MODE_OFF, 25, climate::CLIMATE_FAN_AUTO},
+};
+
+static int failures = 0;
+
+/// One platform: `sender` transmits, `receiver` decodes what was sent.
+/// remote_reader cannot send, so it receives another platform's frames.
+template<typename Sender, typename Receiver = Sender> class PlatformTest {
+ public:
+  explicit PlatformTest(const char *name) : name_(name) {
+    this->sender_.set_transmitter(&this->transmitter_);
+    this->sender_.set_sensor(&this->temperature_);
+    this->receiver_.set_transmitter(&this->transmitter_);
+    this->receiver_.set_sensor(&this->temperature_);
+  }
+
+  Sender &sender() { return this->sender_; }
+  Receiver &receiver() { return this->receiver_; }
+
+  void setup() {
+    this->sender_.setup();
+    this->receiver_.setup();
+  }
+
+  /// Extra listener on the same receiver (carrier_cartridge_rx, ir_capture)
+  void listen(remote_base::RemoteReceiverListener *listener) { this->listener_ = listener; }
+
+  void pass() {
+    float temperature = 22.0f;
+    for (const Step &step : STEPS) {
+      uint32_t sent = this->transmitter_.send_count();
+      this->sender_.make_call().set_mode(step.mode).set_target_temperature(step.temperature).set_fan_mode(step.fan).perform();
+      // Copy the frame out first: a receiver may transmit (remote_reader echoes)
+      if (this->transmitter_.send_count() != sent) {
+        this->capture_ = this->transmitter_.last_sent();
+        if (this->receiver_.on_receive(remote_base::RemoteReceiveData(this->capture_, 25)))
+          this->decoded_++;
+        if (this->listener_ != nullptr)
+          this->listener_->on_receive(remote_base::RemoteReceiveData(this->capture_, 25));
+      }
+      this->temperature_.publish_state(temperature += 0.5f);
+      delay(1000);
+      this->sender_.run_scheduler(millis());
+      this->receiver_.run_scheduler(millis());
+    }
+  }
+
+  void run() {
+    this->setup();
+    this->pass();
+    uint32_t sent = this->transmitter_.send_count();
+    uint32_t decoded = this->decoded_;
+    ir_common::AllocStats before = ir_common::alloc_stats();
+    uint32_t violations = ir_common::alloc_violations();
+    this->pass();
+    ir_common::AllocStats after = ir_common::alloc_stats();
+    uint32_t allocations = after.count - before.count;
+    bool ok = allocations == 0 && ir_common::alloc_violations() == violations;
+    printf("%-22s %s  %u frames sent, %u decoded, %u allocations (%u bytes) after the first pass\n", this->name_,
+           ok ? "ok  " : "FAIL", this->transmitter_.send_count() - sent, this->decoded_ - decoded, allocations,
+           after.bytes - before.bytes);
+    if (this->decoded_ == decoded) {
+      printf("%-22s FAIL  no frame went through both paths\n", this->name_);
+      failures++;
+    }
+    if (!ok)
+      failures++;
+  }
+
+ protected:
+  const char *name_;
+  remote_transmitter::RemoteTransmitterComponent transmitter_;
+  sensor::Sensor temperature_;
+  Sender sender_;
+  Receiver receiver_;
+  remote_base::RemoteReceiverListener *listener_{nullptr};
+  remote_base::RawTimings capture_;
+  uint32_t decoded_{0};
+};
+
+int main() {
+  if (!ir_common::alloc_tracking_enabled()) {
+    printf("built without USE_IR_ALLOC_TRACKING, nothing to check\n");
+    return 1;
+  }
+  // The wrappers must see the test's own allocations, or every result below is vacuous
+  uint32_t count = ir_common::alloc_stats().count;
+  delete[] new char[64];
+  if (ir_common::alloc_stats().count == count) {
+    printf("malloc is not wrapped: link statically with -Wl,--wrap=malloc\n");
+    return 1;
+  }
+
+  PlatformTest<carrier_ac::CarrierACClimate> carrier("carrier_ac");
+  carrier.run();
+
+  PlatformTest<mitsubishi_ac::MitsubishiACClimate> mitsubishi("mitsubishi_ac");
+  mitsubishi.run();
+
+  PlatformTest<saijo_ac::SaijoACClimate> saijo("saijo_ac");
+  saijo.run();
+
+  // Without a receiver raw_ac builds no matcher and ignores captures
+  remote_receiver::RemoteReceiverComponent raw_receiver;
+  PlatformTest<raw_ac::RawACClimate> raw("raw_ac");
+  raw.receiver().set_receiver(&raw_receiver);
+  raw.run();
+
+  text_sensor::TextSensor protocol, histogram;
+  sensor::Sensor confidence, reader_quality;
+  PlatformTest<carrier_ac::CarrierACClimate, remote_reader_ac::RemoteReaderACClimate> reader("remote_reader");
+  reader.receiver().set_protocol_sensor(&protocol);
+  reader.receiver().set_histogram_sensor(&histogram);
+  reader.receiver().set_confidence_sensor(&confidence);
+  reader.receiver().set_signal_quality_sensor(&reader_quality);
+  reader.run();
+  // The histogram is left to its interval and dump_histogram, outside the per-capture path
+  reader.receiver().dump_histogram();
+  if (histogram.publish_count() != 1 || histogram.state.empty()) {
+    printf("%-22s FAIL  dump_histogram did not publish the histogram\n", "remote_reader");
+    failures++;
+  }
+
+  // The standalone decoder with its text sensors, listening next to the climate
+  text_sensor::TextSensor mode, fan, target, swing;
+  sensor::Sensor cartridge_quality;
+  carrier_cartridge_rx::CarrierCartridgeRx cartridge_rx;
+  cartridge_rx.set_mode_sensor(&mode);
+  cartridge_rx.set_fan_mode_sensor(&fan);
+  cartridge_rx.set_target_temperature_sensor(&target);
+  cartridge_rx.set_swing_mode_sensor(&swing);
+  cartridge_rx.setup();
+  PlatformTest<carrier_cartridge_rx::CarrierCartridgeClimate> cartridge("carrier_cartridge_rx");
+  cartridge.receiver().set_signal_quality_sensor(&cartridge_quality);
+  cartridge.listen(&cartridge_rx);
+  cartridge.run();
+  if (mode.publish_count() == 0) {
+    printf("%-22s FAIL  the text sensors were never published\n", "carrier_cartridge_rx");
+    failures++;
+  }
+
+  // ir_capture without stream_port, next to carrier_ac
+  ir_capture::IrCapture capture;
+  capture.setup();
+  PlatformTest<carrier_ac::CarrierACClimate> captured("ir_capture");
+  captured.listen(&capture);
+  captured.run();
+
+  printf("%s\n", failures == 0 ? "all platforms allocation-free in steady state" : "FAILED");
+  return failures == 0 ? 0 : 1;
+}
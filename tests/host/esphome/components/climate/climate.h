@@ -0,0 +1,141 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <set>
+#include <vector>
+#include "esphome/core/component.h"
+#include "esphome/core/optional.h"
+#include "esphome/core/preferences.h"
+
+namespace esphome {
+namespace climate {
+
+enum ClimateMode : uint8_t {
+  CLIMATE_MODE_OFF = 0,
+  CLIMATE_MODE_HEAT_COOL = 1,
+  CLIMATE_MODE_COOL = 2,
+  CLIMATE_MODE_HEAT = 3,
+  CLIMATE_MODE_FAN_ONLY = 4,
+  CLIMATE_MODE_DRY = 5,
+  CLIMATE_MODE_AUTO = 6,
+};
+enum ClimateFanMode : uint8_t {
+  CLIMATE_FAN_ON = 0,
+  CLIMATE_FAN_OFF = 1,
+  CLIMATE_FAN_AUTO = 2,
+  CLIMATE_FAN_LOW = 3,
+  CLIMATE_FAN_MEDIUM = 4,
+  CLIMATE_FAN_HIGH = 5,
+  CLIMATE_FAN_MIDDLE = 6,
+  CLIMATE_FAN_FOCUS = 7,
+  CLIMATE_FAN_DIFFUSE = 8,
+  CLIMATE_FAN_QUIET = 9,
+};
+enum ClimateSwingMode : uint8_t {
+  CLIMATE_SWING_OFF = 0,
+  CLIMATE_SWING_BOTH = 1,
+  CLIMATE_SWING_VERTICAL = 2,
+  CLIMATE_SWING_HORIZONTAL = 3,
+};
+enum ClimateAction : uint8_t {
+  CLIMATE_ACTION_OFF = 0,
+  CLIMATE_ACTION_COOLING = 2,
+  CLIMATE_ACTION_HEATING = 3,
+  CLIMATE_ACTION_IDLE = 4,
+  CLIMATE_ACTION_DRYING = 5,
+  CLIMATE_ACTION_FAN = 6,
+};
+
+const char *climate_mode_to_string(ClimateMode mode);
+const char *climate_fan_mode_to_string(ClimateFanMode fan_mode);
+const char *climate_swing_mode_to_string(ClimateSwingMode swing_mode);
+
+class ClimateTraits {
+ public:
+  void set_supports_current_temperature(bool supports) { this->current_temperature_ = supports; }
+  void add_supported_mode(ClimateMode mode) { this->modes_.insert(mode); }
+  void set_supported_modes(std::set<ClimateMode> modes) { this->modes_ = std::move(modes); }
+  void add_supported_fan_mode(ClimateFanMode fan_mode) { this->fan_modes_.insert(fan_mode); }
+  void set_supported_fan_modes(std::set<ClimateFanMode> fan_modes) { this->fan_modes_ = std::move(fan_modes); }
+  void add_supported_swing_mode(ClimateSwingMode swing_mode) { this->swing_modes_.insert(swing_mode); }
+  void set_supported_swing_modes(std::set<ClimateSwingMode> swing_modes) { this->swing_modes_ = std::move(swing_modes); }
+  bool supports_mode(ClimateMode mode) const { return this->modes_.count(mode) != 0; }
+  bool supports_fan_mode(ClimateFanMode fan_mode) const { return this->fan_modes_.count(fan_mode) != 0; }
+  bool supports_swing_mode(ClimateSwingMode swing_mode) const { return this->swing_modes_.count(swing_mode) != 0; }
+  void set_visual_min_temperature(float t) { this->min_ = t; }
+  void set_visual_max_temperature(float t) { this->max_ = t; }
+  void set_visual_temperature_step(float t) { this->step_ = t; }
+  float get_visual_min_temperature() const { return this->min_; }
+  float get_visual_max_temperature() const { return this->max_; }
+
+ protected:
+  bool current_temperature_{false};
+  std::set<ClimateMode> modes_;
+  std::set<ClimateFanMode> fan_modes_;
+  std::set<ClimateSwingMode> swing_modes_;
+  float min_{10}, max_{30}, step_{1};
+};
+
+class Climate;
+
+class ClimateCall {
+ public:
+  explicit ClimateCall(Climate *parent) : parent_(parent) {}
+  ClimateCall &set_mode(ClimateMode mode) { this->mode_ = mode; return *this; }
+  ClimateCall &set_target_temperature(float temperature) { this->target_temperature_ = temperature; return *this; }
+  ClimateCall &set_fan_mode(ClimateFanMode fan_mode) { this->fan_mode_ = fan_mode; return *this; }
+  ClimateCall &set_swing_mode(ClimateSwingMode swing_mode) { this->swing_mode_ = swing_mode; return *this; }
+  void perform();
+  const optional<ClimateMode> &get_mode() const { return this->mode_; }
+  const optional<float> &get_target_temperature() const { return this->target_temperature_; }
+  const optional<ClimateFanMode> &get_fan_mode() const { return this->fan_mode_; }
+  const optional<ClimateSwingMode> &get_swing_mode() const { return this->swing_mode_; }
+
+ protected:
+  Climate *parent_;
+  optional<ClimateMode> mode_;
+  optional<float> target_temperature_;
+  optional<ClimateFanMode> fan_mode_;
+  optional<ClimateSwingMode> swing_mode_;
+};
+
+struct ClimateDeviceRestoreState {
+  ClimateMode mode;
+  float target_temperature;
+  void apply(Climate *climate);
+};
+
+class Climate {
+  friend class ClimateCall;
+
+ public:
+  virtual ~Climate() = default;
+  ClimateMode mode{CLIMATE_MODE_OFF};
+  ClimateAction action{CLIMATE_ACTION_OFF};
+  float current_temperature{NAN};
+  float target_temperature{NAN};
+  optional<ClimateFanMode> fan_mode;
+  ClimateSwingMode swing_mode{CLIMATE_SWING_OFF};
+
+  ClimateCall make_call() { return ClimateCall(this); }
+  /// Runs the state callbacks, as ESPHome does before saving and sending to the API
+  void publish_state();
+  void add_on_state_callback(std::function<void(Climate &)> &&callback) {
+    this->state_callbacks_.push_back(std::move(callback));
+  }
+  uint32_t get_object_id_hash() { return uint32_t(reinterpret_cast<uintptr_t>(this)); }
+  ClimateTraits get_traits() { return this->traits(); }
+  /// Publishes since construction (host tests)
+  uint32_t publish_count() const { return this->publishes_; }
+
+ protected:
+  virtual void control(const ClimateCall &call) = 0;
+  virtual ClimateTraits traits() = 0;
+  optional<ClimateDeviceRestoreState> restore_state_() { return {}; }
+  std::vector<std::function<void(Climate &)>> state_callbacks_;
+  uint32_t publishes_{0};
+};
+
+}  // namespace climate
+}  // namespace esphome
@@ -0,0 +1,94 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "esphome/core/component.h"
+
+namespace esphome {
+namespace remote_base {
+
+using RawTimings = std::vector<int32_t>;
+
+class RemoteReceiveData {
+ public:
+  RemoteReceiveData(const RawTimings &data, uint32_t tolerance) : data_(data), tolerance_(tolerance) {}
+  const RawTimings &get_raw_data() const { return this->data_; }
+  uint32_t get_index() const { return this->index_; }
+  int32_t operator[](uint32_t index) const { return this->data_[this->index_ + index]; }
+  int32_t size() const { return this->data_.size() - this->index_; }
+  bool is_valid(uint32_t offset = 0) const { return this->index_ + offset < this->data_.size(); }
+  int32_t peek(uint32_t offset = 0) const { return this->data_[this->index_ + offset]; }
+  void advance(uint32_t amount = 1) { this->index_ += amount; }
+  void reset() { this->index_ = 0; }
+
+ protected:
+  const RawTimings &data_;
+  uint32_t index_{0};
+  uint32_t tolerance_;
+};
+
+class RemoteTransmitData {
+ public:
+  void mark(uint32_t length) { this->data_.push_back(length); }
+  void space(uint32_t length) { this->data_.push_back(-(int32_t) length); }
+  void item(uint32_t mark, uint32_t space) {
+    this->mark(mark);
+    this->space(space);
+  }
+  void reserve(uint32_t length) { this->data_.reserve(length); }
+  void set_carrier_frequency(uint32_t frequency) { this->carrier_frequency_ = frequency; }
+  uint32_t get_carrier_frequency() const { return this->carrier_frequency_; }
+  const RawTimings &get_data() const { return this->data_; }
+  void reset() {
+    this->data_.clear();
+    this->carrier_frequency_ = 0;
+  }
+
+ protected:
+  RawTimings data_;
+  uint32_t carrier_frequency_{0};
+};
+
+class RemoteReceiverListener {
+ public:
+  virtual bool on_receive(RemoteReceiveData data) = 0;
+};
+
+/// Like ESPHome, every transmit() hands out the same buffer, cleared, so
+/// its capacity carries over from one send to the next
+class RemoteTransmitterBase {
+ public:
+  class TransmitCall {
+   public:
+    explicit TransmitCall(RemoteTransmitterBase *parent) : parent_(parent) {}
+    RemoteTransmitData *get_data() { return &this->parent_->temp_; }
+    void set_send_times(uint32_t send_times) {}
+    void set_send_wait(uint32_t send_wait) {}
+    void perform() { this->parent_->sends_++; }
+
+   protected:
+    RemoteTransmitterBase *parent_;
+  };
+
+  TransmitCall transmit() {
+    this->temp_.reset();
+    return TransmitCall(this);
+  }
+  /// The last frame sent (host tests)
+  const RawTimings &last_sent() const { return this->temp_.get_data(); }
+  uint32_t send_count() const { return this->sends_; }
+
+ protected:
+  RemoteTransmitData temp_;
+  uint32_t sends_{0};
+};
+
+class RemoteReceiverBase {
+ public:
+  void register_listener(RemoteReceiverListener *listener) { this->listeners_.push_back(listener); }
+
+ protected:
+  std::vector<RemoteReceiverListener *> listeners_;
+};
+
+}  // namespace remote_base
+}  // namespace esphome
@@ -0,0 +1,10 @@
+#pragma once
+#include "esphome/components/remote_base/remote_base.h"
+
+namespace esphome {
+namespace remote_receiver {
+
+class RemoteReceiverComponent : public remote_base::RemoteReceiverBase, public Component {};
+
+}  // namespace remote_receiver
+}  // namespace esphome
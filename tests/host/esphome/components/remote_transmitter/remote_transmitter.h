@@ -0,0 +1,10 @@
+#pragma once
+#include "esphome/components/remote_base/remote_base.h"
+
+namespace esphome {
+namespace remote_transmitter {
+
+class RemoteTransmitterComponent : public remote_base::RemoteTransmitterBase, public Component {};
+
+}  // namespace remote_transmitter
+}  // namespace esphome
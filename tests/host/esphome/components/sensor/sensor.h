@@ -0,0 +1,30 @@
+#pragma once
+#include <cmath>
+#include <functional>
+#include <vector>
+#include "esphome/core/component.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace sensor {
+
+class Sensor {
+ public:
+  float state{NAN};
+  void publish_state(float state) {
+    this->state = state;
+    this->publishes_++;
+    for (auto &callback : this->callbacks_)
+      callback(state);
+  }
+  void add_on_state_callback(std::function<void(float)> &&callback) { this->callbacks_.push_back(std::move(callback)); }
+  bool has_state() const { return !std::isnan(this->state); }
+  uint32_t publish_count() const { return this->publishes_; }
+
+ protected:
+  std::vector<std::function<void(float)>> callbacks_;
+  uint32_t publishes_{0};
+};
+
+}  // namespace sensor
+}  // namespace esphome
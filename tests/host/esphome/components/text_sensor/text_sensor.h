@@ -0,0 +1,29 @@
+#pragma once
+#include <string>
+#include "esphome/core/component.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace text_sensor {
+
+/// publish_state() takes a std::string, as in ESPHome, so a call with a
+/// literal longer than the small-string buffer allocates
+class TextSensor {
+ public:
+  std::string state;
+  std::string raw_state;
+  void publish_state(const std::string &state) {
+    this->raw_state = state;
+    this->state = state;
+    this->publishes_++;
+  }
+  std::string get_state() const { return this->state; }
+  std::string get_raw_state() const { return this->raw_state; }
+  uint32_t publish_count() const { return this->publishes_; }
+
+ protected:
+  uint32_t publishes_{0};
+};
+
+}  // namespace text_sensor
+}  // namespace esphome
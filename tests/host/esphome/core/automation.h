@@ -0,0 +1,34 @@
+#pragma once
+#include <functional>
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+
+template<typename T, typename... X> class TemplatableValue {
+ public:
+  TemplatableValue() {}
+  TemplatableValue(T value) : value_(value) {}
+  bool has_value() const { return true; }
+  T value(X... x) { return this->value_; }
+
+ protected:
+  T value_{};
+};
+
+#define TEMPLATABLE_VALUE_(type, name) \
+ protected: \
+  TemplatableValue<type, Ts...> name##_{}; \
+\
+ public: \
+  template<typename V> void set_##name(V name) { this->name##_ = name; }
+#define TEMPLATABLE_VALUE(type, name) TEMPLATABLE_VALUE_(type, name)
+
+template<typename... Ts> class Action {
+ public:
+  virtual ~Action() = default;
+
+ protected:
+  virtual void play(Ts... x) = 0;
+};
+
+}  // namespace esphome
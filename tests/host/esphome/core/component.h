@@ -0,0 +1,55 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <string>
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/optional.h"
+
+namespace esphome {
+
+namespace setup_priority {
+const float HARDWARE = 800;
+const float DATA = 600;
+const float AFTER_WIFI = 200;
+const float LATE = -100;
+}  // namespace setup_priority
+
+/// Timeouts and intervals live in a fixed table per component and run from
+/// run_scheduler(). ESPHome's scheduler allocates an item per call;
+/// the components only schedule from setup() or when a publish is held back.
+class Component {
+ public:
+  virtual ~Component() = default;
+  virtual void setup() {}
+  virtual void loop() {}
+  virtual void dump_config() {}
+  virtual float get_setup_priority() const { return 0; }
+  void mark_failed() {}
+  /// Fires every due timeout and interval (host test driver)
+  void run_scheduler(uint32_t now);
+
+ protected:
+  void set_timeout(const std::string &name, uint32_t timeout, std::function<void()> &&f);
+  bool cancel_timeout(const std::string &name);
+  void set_interval(const std::string &name, uint32_t interval, std::function<void()> &&f);
+  bool cancel_interval(const std::string &name);
+
+  struct Scheduled {
+    char name[16];
+    uint32_t at;
+    uint32_t interval;  // 0 for a timeout
+    std::function<void()> f;
+  };
+  static const size_t MAX_SCHEDULED = 4;
+  void schedule_(const std::string &name, uint32_t delay, uint32_t interval, std::function<void()> &&f);
+  bool cancel_(const std::string &name);
+  Scheduled scheduled_[MAX_SCHEDULED]{};
+};
+
+class PollingComponent : public Component {
+ public:
+  virtual void update() = 0;
+};
+
+}  // namespace esphome
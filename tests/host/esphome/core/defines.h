@@ -0,0 +1,5 @@
+#pragma once
+// The host build is an ESP8266-like target: RTC state storage is compiled in
+#define USE_ESP8266
+#define USE_SENSOR
+#define USE_TEXT_SENSOR
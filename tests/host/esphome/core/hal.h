@@ -0,0 +1,12 @@
+#pragma once
+#include <cstdint>
+
+#define PROGMEM
+
+namespace esphome {
+/// Host clock: starts at 0 and only moves through delay()
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+inline uint8_t progmem_read_byte(const uint8_t *addr) { return *addr; }
+}  // namespace esphome
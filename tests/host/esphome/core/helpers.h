@@ -0,0 +1,24 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "esphome/core/optional.h"
+
+namespace esphome {
+using std::clamp;
+
+template<typename T> class Parented {
+ public:
+  Parented() {}
+  Parented(T *parent) : parent_(parent) {}
+  T *get_parent() const { return this->parent_; }
+  void set_parent(T *parent) { this->parent_ = parent; }
+
+ protected:
+  T *parent_{nullptr};
+};
+
+bool str_equals_case_insensitive(const std::string &a, const std::string &b);
+}  // namespace esphome
@@ -0,0 +1,20 @@
+#pragma once
+#include <cstdio>
+
+namespace esphome {
+/// Formats into a static buffer, like the logger; printed only with IR_TEST_VERBOSE set
+void shim_log(const char *tag, const char *format, ...) __attribute__((format(printf, 2, 3)));
+}  // namespace esphome
+
+#define ESP_LOGE(tag, ...) ::esphome::shim_log(tag, __VA_ARGS__)
+#define ESP_LOGW(tag, ...) ::esphome::shim_log(tag, __VA_ARGS__)
+#define ESP_LOGI(tag, ...) ::esphome::shim_log(tag, __VA_ARGS__)
+#define ESP_LOGD(tag, ...) ::esphome::shim_log(tag, __VA_ARGS__)
+#define ESP_LOGV(tag, ...) ::esphome::shim_log(tag, __VA_ARGS__)
+#define ESP_LOGVV(tag, ...) ::esphome::shim_log(tag, __VA_ARGS__)
+#define ESP_LOGCONFIG(tag, ...) ::esphome::shim_log(tag, __VA_ARGS__)
+#define LOG_SENSOR(prefix, type, obj) (void) (obj)
+#define LOG_TEXT_SENSOR(prefix, type, obj) (void) (obj)
+#define LOG_CLIMATE(prefix, type, obj) (void) (obj)
+#define LOG_UPDATE_INTERVAL(obj)
+#define YESNO(b) ((b) ? "YES" : "NO")
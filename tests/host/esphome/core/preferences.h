@@ -0,0 +1,48 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace esphome {
+
+/// One fixed slot per preference, so save/load never touch the heap
+static const size_t PREFERENCE_SLOT_SIZE = 1024;
+
+class ESPPreferenceObject {
+ public:
+  ESPPreferenceObject() = default;
+  explicit ESPPreferenceObject(uint8_t *slot) : slot_(slot) {}
+  template<typename T> bool save(const T *src) {
+    static_assert(sizeof(T) < PREFERENCE_SLOT_SIZE, "preference too large for the shim");
+    if (this->slot_ == nullptr)
+      return false;
+    memcpy(this->slot_ + 1, src, sizeof(T));
+    this->slot_[0] = 1;
+    return true;
+  }
+  template<typename T> bool load(T *dest) {
+    if (this->slot_ == nullptr || this->slot_[0] == 0)
+      return false;
+    memcpy(dest, this->slot_ + 1, sizeof(T));
+    return true;
+  }
+
+ protected:
+  uint8_t *slot_{nullptr};
+};
+
+class ESPPreferences {
+ public:
+  template<typename T> ESPPreferenceObject make_preference(uint32_t type, bool in_flash) {
+    return ESPPreferenceObject(this->slot_(type));
+  }
+  template<typename T> ESPPreferenceObject make_preference(uint32_t type) { return this->make_preference<T>(type, false); }
+  bool sync() { return true; }
+
+ protected:
+  uint8_t *slot_(uint32_t type);
+};
+
+extern ESPPreferences *global_preferences;
+
+}  // namespace esphome
@@ -0,0 +1,187 @@
+// Definitions behind the host shim headers: a clock that only moves when
+// told to, a logger, in-memory preferences and a fixed-size scheduler.
+#include <cstdarg>
+#include <cstdlib>
+#include <cstring>
+#include "esphome/components/climate/climate.h"
+#include "esphome/core/component.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+#include "esphome/core/preferences.h"
+
+namespace esphome {
+
+static uint32_t now_ms = 0;
+
+uint32_t millis() { return now_ms; }
+uint32_t micros() { return now_ms * 1000; }
+void delay(uint32_t ms) { now_ms += ms; }
+
+void shim_log(const char *tag, const char *format, ...) {
+  static char buffer[512];
+  static const bool verbose = getenv("IR_TEST_VERBOSE") != nullptr;
+  va_list args;
+  va_start(args, format);
+  vsnprintf(buffer, sizeof(buffer), format, args);
+  va_end(args);
+  if (verbose)
+    printf("[%s] %s\n", tag, buffer);
+}
+
+bool str_equals_case_insensitive(const std::string &a, const std::string &b) {
+  return a.size() == b.size() && strncasecmp(a.c_str(), b.c_str(), a.size()) == 0;
+}
+
+// ============================================================
+// PREFERENCES
+// ============================================================
+static const size_t PREFERENCE_SLOTS = 32;
+static uint32_t slot_types[PREFERENCE_SLOTS];
+static uint8_t slots[PREFERENCE_SLOTS][PREFERENCE_SLOT_SIZE];
+static size_t slots_used = 0;
+
+uint8_t *ESPPreferences::slot_(uint32_t type) {
+  for (size_t i = 0; i < slots_used; i++) {
+    if (slot_types[i] == type)
+      return slots[i];
+  }
+  if (slots_used == PREFERENCE_SLOTS)
+    return nullptr;
+  slot_types[slots_used] = type;
+  return slots[slots_used++];
+}
+
+static ESPPreferences preferences;
+ESPPreferences *global_preferences = &preferences;
+
+// ============================================================
+// SCHEDULER
+// ============================================================
+void Component::set_timeout(const std::string &name, uint32_t timeout, std::function<void()> &&f) {
+  this->schedule_(name, timeout, 0, std::move(f));
+}
+bool Component::cancel_timeout(const std::string &name) { return this->cancel_(name); }
+void Component::set_interval(const std::string &name, uint32_t interval, std::function<void()> &&f) {
+  this->schedule_(name, interval, interval, std::move(f));
+}
+bool Component::cancel_interval(const std::string &name) { return this->cancel_(name); }
+
+void Component::schedule_(const std::string &name, uint32_t delay, uint32_t interval, std::function<void()> &&f) {
+  this->cancel_(name);
+  for (Scheduled &item : this->scheduled_) {
+    if (item.f)
+      continue;
+    snprintf(item.name, sizeof(item.name), "%s", name.c_str());
+    item.at = millis() + delay;
+    item.interval = interval;
+    item.f = std::move(f);
+    return;
+  }
+  fprintf(stderr, "shim: more than %zu timers on one component\n", MAX_SCHEDULED);
+  abort();
+}
+
+bool Component::cancel_(const std::string &name) {
+  for (Scheduled &item : this->scheduled_) {
+    if (item.f && name == item.name) {
+      item.f = nullptr;
+      return true;
+    }
+  }
+  return false;
+}
+
+void Component::run_scheduler(uint32_t now) {
+  for (Scheduled &item : this->scheduled_) {
+    if (!item.f || int32_t(now - item.at) < 0)
+      continue;
+    if (item.interval == 0) {
+      // The callback may schedule again under the same name
+      std::function<void()> f = std::move(item.f);
+      item.f = nullptr;
+      f();
+    } else {
+      item.at = now + item.interval;
+      item.f();
+    }
+  }
+}
+
+namespace climate {
+
+void ClimateCall::perform() { this->parent_->control(*this); }
+
+void ClimateDeviceRestoreState::apply(Climate *climate) {
+  climate->mode = this->mode;
+  climate->target_temperature = this->target_temperature;
+  climate->publish_state();
+}
+
+void Climate::publish_state() {
+  this->publishes_++;
+  for (auto &callback : this->state_callbacks_)
+    callback(*this);
+}
+
+const char *climate_mode_to_string(ClimateMode mode) {
+  switch (mode) {
+    case CLIMATE_MODE_OFF:
+      return "OFF";
+    case CLIMATE_MODE_HEAT_COOL:
+      return "HEAT_COOL";
+    case CLIMATE_MODE_COOL:
+      return "COOL";
+    case CLIMATE_MODE_HEAT:
+      return "HEAT";
+    case CLIMATE_MODE_FAN_ONLY:
+      return "FAN_ONLY";
+    case CLIMATE_MODE_DRY:
+      return "DRY";
+    case CLIMATE_MODE_AUTO:
+      return "AUTO";
+  }
+  return "UNKNOWN";
+}
+
+const char *climate_fan_mode_to_string(ClimateFanMode fan_mode) {
+  switch (fan_mode) {
+    case CLIMATE_FAN_ON:
+      return "ON";
+    case CLIMATE_FAN_OFF:
+      return "OFF";
+    case CLIMATE_FAN_AUTO:
+      return "AUTO";
+    case CLIMATE_FAN_LOW:
+      return "LOW";
+    case CLIMATE_FAN_MEDIUM:
+      return "MEDIUM";
+    case CLIMATE_FAN_HIGH:
+      return "HIGH";
+    case CLIMATE_FAN_MIDDLE:
+      return "MIDDLE";
+    case CLIMATE_FAN_FOCUS:
+      return "FOCUS";
+    case CLIMATE_FAN_DIFFUSE:
+      return "DIFFUSE";
+    case CLIMATE_FAN_QUIET:
+      return "QUIET";
+  }
+  return "UNKNOWN";
+}
+
+const char *climate_swing_mode_to_string(ClimateSwingMode swing_mode) {
+  switch (swing_mode) {
+    case CLIMATE_SWING_OFF:
+      return "OFF";
+    case CLIMATE_SWING_BOTH:
+      return "BOTH";
+    case CLIMATE_SWING_VERTICAL:
+      return "VERTICAL";
+    case CLIMATE_SWING_HORIZONTAL:
+      return "HORIZONTAL";
+  }
+  return "UNKNOWN";
+}
+
+}  // namespace climate
+}  // namespace esphome
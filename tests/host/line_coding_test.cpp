@@ -0,0 +1,117 @@
+// Round trip of every line coding: encode_line() a frame, drop what a
+// receiver cannot see (the trailing space, adjacent equal levels merge),
+// and decode_line() must give the same bytes back. Build and run with
+// `make -C tests/host`.
+#include <cstdio>
+#include <cstring>
+#include "esphome/components/ir_common/line_coding.h"
+
+using namespace esphome;
+using ir_common::LineCoding;
+
+struct Case {
+  const char *name;
+  LineCoding coding;
+};
+
+static const Case CASES[] = {
+    {"pulse distance", {ir_common::LINE_PULSE_DISTANCE, 9000, 4500, 650, 500, 1600, 650, false, false}},
+    {"pulse distance, LSB first", {ir_common::LINE_PULSE_DISTANCE, 3400, 1700, 450, 420, 1270, 450, true, false}},
+    {"pulse width", {ir_common::LINE_PULSE_WIDTH, 2400, 600, 600, 600, 1200, 0, true, false}},
+    {"pulse width, no header", {ir_common::LINE_PULSE_WIDTH, 0, 0, 600, 600, 1200, 0, false, false}},
+    {"manchester", {ir_common::LINE_MANCHESTER, 2600, 900, 889, 0, 0, 0, false, false}},
+    {"manchester, footer", {ir_common::LINE_MANCHESTER, 2600, 900, 889, 0, 0, 3000, false, false}},
+    {"manchester, inverted, LSB first", {ir_common::LINE_MANCHESTER, 2600, 900, 444, 0, 0, 0, true, true}},
+    {"manchester, no header", {ir_common::LINE_MANCHESTER, 0, 0, 889, 0, 0, 0, false, false}},
+    {"manchester, no header, footer", {ir_common::LINE_MANCHESTER, 0, 0, 889, 0, 0, 2000, false, true}},
+};
+
+// Both first-bit levels, equal neighbours and alternating runs
+static const uint8_t FRAMES[][4] = {
+    {0x00, 0x00, 0x00, 0x00}, {0xFF, 0xFF, 0xFF, 0xFF}, {0x55, 0xAA, 0x0F, 0xF0},
+    {0xA5, 0x3C, 0x81, 0x7E}, {0x12, 0x34, 0x56, 0x79}, {0xC8, 0x01, 0x80, 0x13},
+};
+static const size_t BITS[] = {32, 27, 1};
+
+static int failures = 0;
+
+/// What a receiver records: same-level timings merge, the trailing space is idle line
+static remote_base::RawTimings received(const remote_base::RawTimings &sent) {
+  remote_base::RawTimings out;
+  for (int32_t t : sent) {
+    if (!out.empty() && (out.back() > 0) == (t > 0)) {
+      std::printf("  two %s in a row\n", t > 0 ? "marks" : "spaces");
+      failures++;
+      out.back() += t;
+    } else {
+      out.push_back(t);
+    }
+  }
+  if (!out.empty() && out.back() < 0)
+    out.pop_back();
+  return out;
+}
+
+/// The first bit as sent, which decides whether a Manchester bit starts with a space
+static bool starts_with_space(const LineCoding &c, const uint8_t *frame) {
+  bool first = (frame[0] & (c.lsb_first ? 0x01 : 0x80)) != 0;
+  return c.kind == ir_common::LINE_MANCHESTER && c.header_mark_us == 0 && first != c.inverted;
+}
+
+static void round_trip(const Case &test, const uint8_t *frame, size_t bits) {
+  const LineCoding &c = test.coding;
+  remote_base::RemoteTransmitData sent;
+  bool ok = ir_common::encode_line(c, frame, bits, &sent);
+  if (starts_with_space(c, frame)) {
+    if (ok || !sent.get_data().empty()) {
+      std::printf("FAIL %s: sent a frame that starts with a space half\n", test.name);
+      failures++;
+    }
+    return;
+  }
+  if (!ok) {
+    std::printf("FAIL %s: refused %02X%02X%02X%02X/%u\n", test.name, frame[0], frame[1], frame[2], frame[3],
+                (unsigned) bits);
+    failures++;
+    return;
+  }
+  if (sent.get_data().size() > ir_common::line_timing_count(c, bits)) {
+    std::printf("FAIL %s: %u timings, line_timing_count says at most %u\n", test.name,
+                (unsigned) sent.get_data().size(), (unsigned) ir_common::line_timing_count(c, bits));
+    failures++;
+  }
+
+  remote_base::RawTimings line = received(sent.get_data());
+  ir_common::SoftBits soft;
+  size_t got = ir_common::decode_line(c, line.data(), line.size(), bits, &soft);
+  // Bits past `bits` in the last byte are not sent
+  uint8_t expected[4];
+  memcpy(expected, frame, sizeof(expected));
+  if (bits % 8 != 0) {
+    uint8_t keep = c.lsb_first ? (1 << (bits % 8)) - 1 : 0xFF << (8 - bits % 8);
+    expected[bits / 8] &= keep;
+  }
+  if (got != bits || memcmp(soft.bytes, expected, (bits + 7) / 8) != 0) {
+    std::printf("FAIL %s: %02X%02X%02X%02X/%u decoded as %02X%02X%02X%02X/%u\n", test.name, expected[0],
+                expected[1], expected[2], expected[3], (unsigned) bits, soft.bytes[0], soft.bytes[1], soft.bytes[2],
+                soft.bytes[3], (unsigned) got);
+    failures++;
+  }
+}
+
+int main() {
+  for (const Case &test : CASES) {
+    int before = failures;
+    for (const auto &frame : FRAMES) {
+      for (size_t bits : BITS)
+        round_trip(test, frame, bits);
+    }
+    std::printf("%s %s\n", failures == before ? "ok  " : "FAIL", test.name);
+  }
+  if (failures != 0) {
+    std::printf("%d failures\n", failures);
+    return 1;
+  }
+  std::printf("every line coding decodes what it encodes\n");
+  return 0;
+}
@@ -0,0 +1,45 @@
+#!/usr/bin/env python3
+"""
+Regression runs of tools/infer_protocol.py on the codebooks in the repo.
+
+    python3 tests/tools/test_infer_protocol.py
+"""
+import os
+import subprocess
+import sys
+import tempfile
+import unittest
+
+ROOT = os.path.dirname(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+TOOLS = os.path.join(ROOT, "tools")
+
+
+def run(*args: str) -> str:
+    result = subprocess.run([sys.executable, *args], cwd=TOOLS, capture_output=True, text=True, check=True)
+    return result.stdout
+
+
+class RawAcTest(unittest.TestCase):
+    # raw_ac is the Mitsubishi 112-bit frame: LSB first, byte 13 the plain sum
+    def check_report(self, report: str):
+        self.assertIn("Bit order: LSB first (the checksum fits every capture only LSB first)", report)
+        self.assertIn("Checksum: byte 13 = sum of bytes 0-12, 28/28 captures", report)
+        self.assertNotIn("Checksum fails", report)
+
+    def test_codebook(self):
+        self.check_report(run("infer_protocol.py", os.path.join(ROOT, "codebooks", "raw_ac.json")))
+
+    def test_archive(self):
+        with tempfile.TemporaryDirectory() as tmp:
+            archive = os.path.join(tmp, "raw_ac.irca")
+            run("capture_archive.py", "pack", os.path.join(ROOT, "codebooks", "raw_ac.json"), archive)
+            self.check_report(run("infer_protocol.py", archive))
+
+    def test_shared_mode_value_is_not_separable(self):
+        report = run("infer_protocol.py", os.path.join(ROOT, "codebooks", "raw_ac.json"))
+        self.assertIn("not separable: COOL, FAN_ONLY", report)
+        self.assertNotIn("MODE_RULES", report)
+
+
+if __name__ == "__main__":
+    unittest.main()
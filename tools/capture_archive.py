@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+"""
+Read and write columnar capture archives (.irca, see
+custom_components/ir_common/capture_archive.h) from Python tools.
+
+Usage:
+    tools/capture_archive.py pack codebooks/raw_ac.json raw_ac.irca
+    tools/capture_archive.py list captures.irca [--raw]
+
+`pack` stores a codebook's raw captures with their labelled states, so
+tools/infer_protocol.py can read them from an archive. `list` prints one
+line per capture. tools/ir_convert.cpp writes archives from logs and
+stream dumps (--archive).
+
+The archive is memory-mapped. Labels, timestamps and node names come
+straight from the metadata column, and a capture's timings are only
+decoded when they are asked for.
+"""
+import argparse
+import json
+import mmap
+import struct
+import sys
+
+from gen_codebook import ANY, FANS, MODES, SWINGS, codebook_key
+from ir_stream import decode_capture
+
+# ============================================================
+# FILE LAYOUT (must match capture_archive.h)
+# ============================================================
+MAGIC = b"IRCA"
+VERSION = 1
+HEADER = struct.Struct("<4sI9Q")  # magic, version, frame count, then section offsets and sizes
+FRAME = struct.Struct("<QII")     # offset into the timings column, encoded bytes, timings
+META = struct.Struct("<QIHBB")    # timestamp_ms, state, node, protocol, confidence
+NO_STATE = 0xFFFFFFFF
+NO_PROTOCOL = 0xFF
+CAPTURE_FIRST_IS_SPACE = 0x01
+
+
+def label(state: int) -> dict | None:
+    """Codebook-style labels of an AcState word, None for an unlabelled capture."""
+    if state == NO_STATE:
+        return None
+    names = {"mode": next(k for k, v in MODES.items() if v == state & 0xFF)}
+    fan, half_degrees, swing = (state >> 8) & 0xFF, (state >> 16) & 0xFF, state >> 24
+    if fan != ANY:
+        names["fan"] = next(k for k, v in FANS.items() if v == fan)
+    if half_degrees:
+        names["temp"] = half_degrees // 2 if half_degrees % 2 == 0 else half_degrees / 2
+    if swing != ANY:
+        names["swing"] = next(k for k, v in SWINGS.items() if v == swing)
+    return names
+
+
+class Archive:
+    def __init__(self, path: str):
+        with open(path, "rb") as f:
+            self.data = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+        if len(self.data) < HEADER.size:
+            raise ValueError(f"{path}: not a capture archive")
+        (magic, version, self.count, self.timings_offset, _, self.index_offset, self.meta_offset,
+         nodes_offset, nodes_size, protocols_offset, protocols_size) = HEADER.unpack_from(self.data)
+        if magic != MAGIC or version != VERSION:
+            raise ValueError(f"{path}: not a version {VERSION} capture archive")
+        self.nodes = self.data[nodes_offset:nodes_offset + nodes_size].decode("utf-8").split("\n")[:-1]
+        self.protocols = self.data[protocols_offset:protocols_offset + protocols_size].decode("utf-8").split("\n")[:-1]
+
+    def __len__(self) -> int:
+        return self.count
+
+    def meta(self, i: int) -> dict:
+        timestamp, state, node, protocol, confidence = META.unpack_from(self.data, self.meta_offset + i * META.size)
+        return {"timestamp_ms": timestamp, "state": state,
+                "node": self.nodes[node] if node < len(self.nodes) else None,
+                "protocol": self.protocols[protocol] if protocol < len(self.protocols) else None,
+                "confidence": confidence}
+
+    def timings(self, i: int) -> list[int]:
+        offset, length, _ = FRAME.unpack_from(self.data, self.index_offset + i * FRAME.size)
+        start = self.timings_offset + offset
+        return decode_capture(self.data[start:start + length])
+
+
+def write_varint(value: int, out: bytearray):
+    while True:
+        b = value & 0x7F
+        value >>= 7
+        out.append(b | 0x80 if value else b)
+        if not value:
+            return
+
+
+def encode_capture(timings: list[int], quantum: int = 1) -> bytes:
+    """Same bytes as ir_common::encode_capture()."""
+    first_is_space = bool(timings) and timings[0] < 0
+    out = bytearray([quantum, CAPTURE_FIRST_IS_SPACE if first_is_space else 0])
+    write_varint(len(timings), out)
+    last = [0, 0]
+    for i, t in enumerate(timings):
+        space = t < 0
+        if space != (first_is_space != (i % 2 == 1)):
+            raise ValueError(f"timing {i} ({t}) does not alternate")
+        q = (abs(t) + quantum // 2) // quantum
+        delta = q - last[space]
+        write_varint(((delta << 1) ^ (delta >> 31)) & 0xFFFFFFFF, out)
+        last[space] = q
+    return bytes(out)
+
+
+def write_archive(path: str, captures: list[tuple[list[int], int]], node: str, quantum: int = 1):
+    """captures: (timings, state) pairs, all from one node."""
+    timings_column = bytearray()
+    frames = bytearray()
+    metas = bytearray()
+    for timings, state in captures:
+        encoded = encode_capture(timings, quantum)
+        frames += FRAME.pack(len(timings_column), len(encoded), len(timings))
+        metas += META.pack(0, state, 0, NO_PROTOCOL, 0)
+        timings_column += encoded
+    timings_column += bytes(-(HEADER.size + len(timings_column)) % 8)
+    nodes = (node + "\n").encode("utf-8")
+    index_offset = HEADER.size + len(timings_column)
+    meta_offset = index_offset + len(frames)
+    nodes_offset = meta_offset + len(metas)
+    header = HEADER.pack(MAGIC, VERSION, len(captures), HEADER.size, len(timings_column), index_offset,
+                         meta_offset, nodes_offset, len(nodes), nodes_offset + len(nodes), 0)
+    with open(path, "wb") as f:
+        f.write(header + timings_column + frames + metas + nodes)
+
+# ============================================================
+# MAIN
+# ============================================================
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    commands = parser.add_subparsers(dest="command", required=True)
+    pack = commands.add_parser("pack", help="archive a codebook's labelled raw captures")
+    pack.add_argument("codebook")
+    pack.add_argument("archive")
+    listing = commands.add_parser("list", help="print one line per capture")
+    listing.add_argument("archive")
+    listing.add_argument("--raw", action="store_true", help="print the timings of each capture")
+    args = parser.parse_args()
+
+    if args.command == "pack":
+        with open(args.codebook) as f:
+            book = json.load(f)
+        captures = [(c["raw"], codebook_key(c)) for c in book["codes"] if "raw" in c]
+        if not captures:
+            print("error: the codebook has no raw captures", file=sys.stderr)
+            return 1
+        write_archive(args.archive, captures, book.get("namespace", args.codebook))
+        print(f"{len(captures)} captures archived to {args.archive}", file=sys.stderr)
+        return 0
+
+    archive = Archive(args.archive)
+    for i in range(len(archive)):
+        meta = archive.meta(i)
+        labels = label(meta["state"])
+        state = " ".join(f"{k}={v}" for k, v in labels.items()) if labels else "-"
+        print(f"#{i} {meta['node']} t={meta['timestamp_ms']} {meta['protocol'] or '-'} ({meta['confidence']}%) "
+              f"{state}")
+        if args.raw:
+            print("  " + ", ".join(str(t) for t in archive.timings(i)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,517 @@
+// ======================================================================
+// ===             CHECKSUM SCHEME SEARCH OVER A FRAME CORPUS         ===
+// ======================================================================
+// Tries every common checksum scheme against a set of decoded frames and
+// prints the ones that hold for all of them:
+//
+//   sum / negated sum    8-bit, plus a constant
+//   xor                  8-bit, xor a constant
+//   nibble sum           into the high or low nibble of the check byte,
+//                        with or without the check byte's other nibble
+//   complement           one byte is ~ another
+//   crc8                 every polynomial, init, input/output reflection
+//   crc16                every polynomial, reflection, both byte orders,
+//                        init 0000 and FFFF
+//
+// Sums and XORs are tried on the bytes as received and bit-reversed (LSB
+// first protocols such as Mitsubishi). The check sits at a fixed distance
+// from the end of the frame (L-1 is the last byte) and covers bytes
+// `start` up to it, so frames of different lengths can share a scheme.
+// Constants (sum offset, xorout) are solved from the first frame, not
+// searched. When every frame has the same length, a CRC's init only
+// changes the xorout, so init is searched only for mixed lengths.
+// Check bytes that never change are skipped, since any scheme fits them.
+//
+// The CRC searches are split across all cores. Identical frames are
+// counted once. A scheme is only evidence if it is not expected by
+// chance: the report gives that estimate per family from the number of
+// distinct frames.
+//
+// Input, one frame per line: a codebook JSON ("hex": "..."), ir_convert
+// output (the hex column) or plain hex. The longest run of hex digits on
+// a line is taken as the frame. Built with a host compiler and -pthread;
+// README.md has the command.
+//
+// Usage:
+//   checksum_search [--length N] [--threads N] [--all] [--no-crc16] [FILE...]
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct Options {
+  size_t length{0};  // 0: every length
+  unsigned threads{0};
+  bool all{false};
+  bool crc16{true};
+};
+
+static Options options;
+static const size_t REPORT_LIMIT = 40;
+
+using Frame = std::vector<uint8_t>;
+static std::vector<Frame> frames;
+static std::vector<Frame> reversed;  // every byte bit-reversed
+static size_t min_length = SIZE_MAX;
+static bool mixed_lengths = false;
+
+static uint8_t reverse8(uint8_t b) {
+  b = (b & 0xF0) >> 4 | (b & 0x0F) << 4;
+  b = (b & 0xCC) >> 2 | (b & 0x33) << 2;
+  b = (b & 0xAA) >> 1 | (b & 0x55) << 1;
+  return b;
+}
+
+// Whether byte `index` (from the start) or L-`tail` changes across the corpus
+static bool head_varies(size_t index) {
+  return std::any_of(frames.begin(), frames.end(), [&](const Frame &f) { return f[index] != frames[0][index]; });
+}
+static bool tail_varies(size_t tail, uint8_t mask = 0xFF) {
+  const Frame &first = frames[0];
+  return std::any_of(frames.begin(), frames.end(), [&](const Frame &f) {
+    return ((f[f.size() - tail] ^ first[first.size() - tail]) & mask) != 0;
+  });
+}
+// A check that never changes fits any scheme. Leading bytes that never
+// change only shift the constant, so the range that includes them is the
+// one reported.
+static bool redundant_start(size_t start) { return start > 0 && !head_varies(start - 1); }
+
+static uint16_t reverse16(uint16_t v) { return uint16_t(reverse8(v & 0xFF)) << 8 | reverse8(v >> 8); }
+
+// "bytes 0..L-2": the last byte covered is written from the end of the frame
+static std::string range_text(size_t start, size_t last_from_end) {
+  char buf[48];
+  snprintf(buf, sizeof(buf), "bytes %zu..L-%zu", start, last_from_end);
+  return buf;
+}
+
+// ----------------------------------------------------------------------
+// Results, collected per family and per job so output order is stable
+// ----------------------------------------------------------------------
+struct Family {
+  explicit Family(const char *name) : name(name) {}
+  const char *name;
+  double candidates{0};
+  unsigned check_bits{8};
+  bool solved{true};  // a constant is solved from the first frame
+  std::vector<std::vector<std::string>> jobs;
+  size_t count() const {
+    size_t n = 0;
+    for (const auto &j : this->jobs)
+      n += j.size();
+    return n;
+  }
+};
+
+static void report(const Family &family) {
+  size_t total = family.count();
+  // Chance that a wrong scheme fits every frame after the constant is solved from the first
+  double fitted = double(frames.size() - (family.solved ? 1 : 0));
+  double chance = family.candidates * std::pow(2.0, -double(family.check_bits) * fitted);
+  printf("%s: %zu match%s", family.name, total, total == 1 ? "" : "es");
+  if (chance >= 0.01)
+    printf(" (about %.3g expected by chance from %zu frames; add more)", chance, frames.size());
+  printf("\n");
+  size_t shown = 0;
+  for (const auto &job : family.jobs) {
+    for (const auto &line : job) {
+      if (!options.all && shown == REPORT_LIMIT) {
+        printf("  ... %zu more (--all)\n", total - shown);
+        return;
+      }
+      printf("  %s\n", line.c_str());
+      shown++;
+    }
+  }
+}
+
+template<typename F> static void parallel_for(size_t jobs, F fn) {
+  unsigned n = options.threads != 0 ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+  std::atomic<size_t> next{0};
+  std::vector<std::thread> pool;
+  for (unsigned t = 0; t < n; t++) {
+    pool.emplace_back([&]() {
+      for (size_t job = next++; job < jobs; job = next++)
+        fn(job);
+    });
+  }
+  for (auto &thread : pool)
+    thread.join();
+}
+
+// ----------------------------------------------------------------------
+// Sums, XOR, nibble sums
+// ----------------------------------------------------------------------
+enum ArithKind { ARITH_SUM, ARITH_NEG_SUM, ARITH_XOR };
+static const char *const ARITH_NAMES[] = {"sum", "-sum", "xor"};
+
+static uint8_t arith(ArithKind kind, const Frame &f, size_t start, size_t end) {
+  uint8_t v = 0;
+  for (size_t i = start; i < end; i++)
+    v = kind == ARITH_XOR ? v ^ f[i] : v + f[i];
+  return v;
+}
+
+// Residual that must be the same for every frame
+static uint8_t arith_residual(ArithKind kind, const Frame &f, size_t start, size_t tail) {
+  size_t p = f.size() - tail;
+  uint8_t a = arith(kind, f, start, p);
+  switch (kind) {
+    case ARITH_SUM:
+      return f[p] - a;
+    case ARITH_NEG_SUM:
+      return f[p] + a;
+    default:
+      return f[p] ^ a;
+  }
+}
+
+// high: check in the high nibble; other: the check byte's other nibble is summed too
+static uint8_t nibble_residual(bool negate, bool high, bool other, const Frame &f, size_t start, size_t tail) {
+  size_t p = f.size() - tail;
+  uint8_t s = 0;
+  for (size_t i = start; i < p; i++)
+    s += (f[i] >> 4) + (f[i] & 0x0F);
+  if (other)
+    s += high ? f[p] & 0x0F : f[p] >> 4;
+  uint8_t check = high ? f[p] >> 4 : f[p] & 0x0F;
+  return (negate ? check + s : check - s) & 0x0F;
+}
+
+template<typename R> static bool holds(const std::vector<Frame> &corpus, R residual, uint8_t *constant) {
+  uint8_t first = residual(corpus[0]);
+  for (size_t i = 1; i < corpus.size(); i++) {
+    if (residual(corpus[i]) != first)
+      return false;
+  }
+  *constant = first;
+  return true;
+}
+
+static void search_arith(Family *sums, Family *nibbles) {
+  sums->jobs.resize(1);
+  nibbles->jobs.resize(1);
+  char line[160];
+  for (int rev = 0; rev < 2; rev++) {
+    const auto &corpus = rev ? reversed : frames;
+    const char *order = rev ? ", bit-reversed bytes" : "";
+    for (size_t tail = 1; tail <= min_length - 1; tail++) {
+      for (size_t start = 0; start + tail < min_length; start++) {
+        if (redundant_start(start))
+          continue;
+        for (int k = 0; k < 3 && tail_varies(tail); k++) {
+          auto kind = ArithKind(k);
+          sums->candidates++;
+          uint8_t c;
+          if (holds(corpus, [&](const Frame &f) { return arith_residual(kind, f, start, tail); }, &c)) {
+            snprintf(line, sizeof(line), "byte L-%zu = %s(%s) %s 0x%02X%s", tail, ARITH_NAMES[k],
+                     range_text(start, tail + 1).c_str(), kind == ARITH_XOR ? "^" : "+", c, order);
+            sums->jobs[0].push_back(line);
+          }
+        }
+        for (int variant = 0; variant < 8; variant++) {
+          bool negate = variant & 1, high = variant & 2, other = variant & 4;
+          if (!tail_varies(tail, high ? 0xF0 : 0x0F))
+            continue;
+          nibbles->candidates++;
+          uint8_t c;
+          if (holds(corpus, [&](const Frame &f) { return nibble_residual(negate, high, other, f, start, tail); },
+                    &c)) {
+            snprintf(line, sizeof(line), "%s nibble of byte L-%zu = %snibble sum(%s%s) + 0x%X%s",
+                     high ? "high" : "low", tail, negate ? "-" : "", range_text(start, tail + 1).c_str(),
+                     other ? ", other nibble" : "", c, order);
+            nibbles->jobs[0].push_back(line);
+          }
+        }
+      }
+    }
+  }
+}
+
+static void search_complement(Family *family) {
+  family->jobs.resize(1);
+  char line[96];
+  for (size_t p = 0; p < min_length; p++) {
+    for (size_t q = p + 1; q < min_length; q++) {
+      family->candidates++;
+      bool ok = std::all_of(frames.begin(), frames.end(), [&](const Frame &f) { return (f[p] ^ f[q]) == 0xFF; });
+      if (ok) {
+        snprintf(line, sizeof(line), "byte %zu = ~byte %zu%s", q, p, head_varies(p) ? "" : " (both constant)");
+        family->jobs[0].push_back(line);
+      }
+    }
+  }
+}
+
+// ----------------------------------------------------------------------
+// CRC-8 / CRC-16, table driven, one job per polynomial and reflection
+// ----------------------------------------------------------------------
+struct Crc16Table {
+  uint16_t entry[256];
+  bool reflected;
+
+  void build(uint16_t poly, bool reflect, unsigned width) {
+    this->reflected = reflect;
+    uint16_t top = 1u << (width - 1);
+    uint16_t mask = width == 16 ? 0xFFFF : 0xFF;
+    uint16_t rpoly = width == 16 ? reverse16(poly) : reverse8(poly);
+    for (unsigned i = 0; i < 256; i++) {
+      uint16_t crc;
+      if (reflect) {
+        crc = i;
+        for (int b = 0; b < 8; b++)
+          crc = crc & 1 ? (crc >> 1) ^ rpoly : crc >> 1;
+      } else {
+        crc = width == 16 ? i << 8 : i;
+        for (int b = 0; b < 8; b++)
+          crc = crc & top ? ((crc << 1) ^ poly) & mask : (crc << 1) & mask;
+      }
+      this->entry[i] = crc;
+    }
+  }
+
+  uint8_t crc8(const Frame &f, size_t start, size_t end, uint8_t init) const {
+    uint8_t crc = init;
+    for (size_t i = start; i < end; i++)
+      crc = this->entry[crc ^ f[i]];
+    return crc;
+  }
+
+  uint16_t crc16(const Frame &f, size_t start, size_t end, uint16_t init) const {
+    uint16_t crc = init;
+    for (size_t i = start; i < end; i++) {
+      if (this->reflected)
+        crc = (crc >> 8) ^ this->entry[(crc ^ f[i]) & 0xFF];
+      else
+        crc = (crc << 8) ^ this->entry[(crc >> 8) ^ f[i]];
+    }
+    return crc;
+  }
+};
+
+static void search_crc8(Family *family) {
+  // Job: poly (1-255) x refin x refout
+  const size_t jobs = 255 * 4;
+  family->jobs.assign(jobs, {});
+  unsigned inits = mixed_lengths ? 256 : 1;
+  size_t ranges = 0;
+  for (size_t tail = 1; tail < min_length; tail++)
+    ranges += min_length - tail;
+  family->candidates = double(jobs) * inits * ranges;
+
+  parallel_for(jobs, [&](size_t job) {
+    uint8_t poly = job / 4 + 1;
+    bool refin = job & 1, refout = job & 2;
+    Crc16Table table;
+    table.build(poly, refin, 8);
+    char line[160];
+    for (size_t tail = 1; tail < min_length; tail++) {
+      if (!tail_varies(tail))
+        continue;
+      for (size_t start = 0; start + tail < min_length; start++) {
+        if (redundant_start(start))
+          continue;
+        for (unsigned init = 0; init < inits; init++) {
+          uint8_t xorout;
+          auto residual = [&](const Frame &f) {
+            size_t p = f.size() - tail;
+            uint8_t crc = table.crc8(f, start, p, refin ? reverse8(init) : init);
+            // The reflected table yields the reflected register
+            if (refin != refout)
+              crc = reverse8(crc);
+            return uint8_t(crc ^ f[p]);
+          };
+          if (!holds(frames, residual, &xorout))
+            continue;
+          snprintf(line, sizeof(line), "byte L-%zu = crc8(%s) poly 0x%02X init 0x%02X refin %d refout %d xorout 0x%02X",
+                   tail, range_text(start, tail + 1).c_str(), poly, init, refin, refout, xorout);
+          family->jobs[job].push_back(line);
+        }
+      }
+    }
+  });
+}
+
+static void search_crc16(Family *family) {
+  // Job: poly (1-65535) x reflection
+  const size_t jobs = 65535 * 2;
+  family->jobs.assign(jobs, {});
+  family->check_bits = 16;
+  static const uint16_t INITS[] = {0x0000, 0xFFFF};
+  size_t inits = mixed_lengths ? 2 : 1;
+  size_t ranges = 0;
+  for (size_t tail = 2; tail < min_length; tail++)
+    ranges += min_length - tail;
+  family->candidates = double(jobs) * inits * ranges * 2;
+
+  parallel_for(jobs, [&](size_t job) {
+    uint16_t poly = job / 2 + 1;
+    bool reflect = job & 1;
+    Crc16Table table;
+    table.build(poly, reflect, 16);
+    char line[160];
+    // The check is bytes L-tail and L-tail+1
+    for (size_t tail = 2; tail < min_length; tail++) {
+      if (!tail_varies(tail) && !tail_varies(tail - 1))
+        continue;
+      for (size_t start = 0; start + tail < min_length; start++) {
+        if (redundant_start(start))
+          continue;
+        for (size_t i = 0; i < inits; i++) {
+          for (int little = 0; little < 2; little++) {
+            auto check_of = [&](const Frame &f) {
+              size_t p = f.size() - tail;
+              return little ? uint16_t(f[p] | f[p + 1] << 8) : uint16_t(f[p] << 8 | f[p + 1]);
+            };
+            uint16_t first = table.crc16(frames[0], start, frames[0].size() - tail, INITS[i]) ^ check_of(frames[0]);
+            bool ok = true;
+            for (size_t n = 1; n < frames.size() && ok; n++)
+              ok = (table.crc16(frames[n], start, frames[n].size() - tail, INITS[i]) ^ check_of(frames[n])) == first;
+            if (!ok)
+              continue;
+            snprintf(line, sizeof(line),
+                     "bytes L-%zu..L-%zu = crc16(%s) poly 0x%04X init 0x%04X reflect %d xorout 0x%04X %s", tail,
+                     tail - 1, range_text(start, tail + 1).c_str(), poly, INITS[i], reflect, first,
+                     little ? "little endian" : "big endian");
+            family->jobs[job].push_back(line);
+          }
+        }
+      }
+    }
+  });
+}
+
+// ----------------------------------------------------------------------
+// Input
+// ----------------------------------------------------------------------
+static int hex_value(char c) {
+  if (c >= '0' && c <= '9')
+    return c - '0';
+  if (c >= 'a' && c <= 'f')
+    return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F')
+    return c - 'A' + 10;
+  return -1;
+}
+
+// The longest even run of hex digits on the line, at least two bytes
+static bool parse_frame(const char *line, Frame *out) {
+  const char *best = nullptr;
+  size_t best_len = 0;
+  for (const char *p = line; *p != '\0';) {
+    if (hex_value(*p) < 0) {
+      p++;
+      continue;
+    }
+    const char *q = p;
+    while (hex_value(*q) >= 0)
+      q++;
+    size_t len = (q - p) & ~size_t(1);
+    if (len > best_len) {
+      best = p;
+      best_len = len;
+    }
+    p = q;
+  }
+  if (best_len < 4)
+    return false;
+  out->clear();
+  for (size_t i = 0; i < best_len; i += 2)
+    out->push_back(hex_value(best[i]) << 4 | hex_value(best[i + 1]));
+  return true;
+}
+
+static bool read_file(const char *path, std::set<Frame> *seen) {
+  bool is_stdin = strcmp(path, "-") == 0;
+  FILE *file = is_stdin ? stdin : fopen(path, "r");
+  if (file == nullptr) {
+    perror(path);
+    return false;
+  }
+  char *line = nullptr;
+  size_t capacity = 0;
+  Frame frame;
+  while (getline(&line, &capacity, file) != -1) {
+    // A codebook entry: take its "hex" value, not some other field
+    const char *hex = strstr(line, "\"hex\"");
+    if (!parse_frame(hex != nullptr ? hex + 5 : line, &frame))
+      continue;
+    if (options.length != 0 && frame.size() != options.length)
+      continue;
+    seen->insert(frame);
+  }
+  free(line);
+  if (!is_stdin)
+    fclose(file);
+  return true;
+}
+
+int main(int argc, char **argv) {
+  std::vector<const char *> paths;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--length") == 0 && i + 1 < argc) {
+      options.length = strtoul(argv[++i], nullptr, 10);
+    } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+      options.threads = strtoul(argv[++i], nullptr, 10);
+    } else if (strcmp(argv[i], "--all") == 0) {
+      options.all = true;
+    } else if (strcmp(argv[i], "--no-crc16") == 0) {
+      options.crc16 = false;
+    } else if (argv[i][0] == '-' && argv[i][1] != '\0') {
+      fprintf(stderr, "usage: %s [--length N] [--threads N] [--all] [--no-crc16] [FILE...]\n", argv[0]);
+      return 2;
+    } else {
+      paths.push_back(argv[i]);
+    }
+  }
+  if (paths.empty())
+    paths.push_back("-");
+
+  std::set<Frame> seen;
+  for (const char *path : paths) {
+    if (!read_file(path, &seen))
+      return 1;
+  }
+  frames.assign(seen.begin(), seen.end());
+  if (frames.size() < 2) {
+    fprintf(stderr, "need at least two distinct frames, got %zu\n", frames.size());
+    return 1;
+  }
+  size_t max_length = 0;
+  for (const auto &f : frames) {
+    min_length = std::min(min_length, f.size());
+    max_length = std::max(max_length, f.size());
+    Frame r(f.size());
+    std::transform(f.begin(), f.end(), r.begin(), reverse8);
+    reversed.push_back(r);
+  }
+  mixed_lengths = min_length != max_length;
+  printf("%zu distinct frames, %zu-%zu bytes\n", frames.size(), min_length, max_length);
+  if (!mixed_lengths)
+    printf("All frames are the same length, so a CRC's init is folded into its xorout\n");
+
+  Family sums{"sum/xor"}, nibbles{"nibble sum"}, complements{"complement"}, crc8{"crc8"}, crc16{"crc16"};
+  nibbles.check_bits = 4;
+  complements.solved = false;
+  search_arith(&sums, &nibbles);
+  search_complement(&complements);
+  search_crc8(&crc8);
+  report(sums);
+  report(nibbles);
+  report(complements);
+  report(crc8);
+  if (options.crc16 && min_length >= 3) {
+    search_crc16(&crc16);
+    report(crc16);
+  }
+  return 0;
+}
@@ -0,0 +1,214 @@
+#!/usr/bin/env python3
+"""
+Generate a packed IR codebook blob (see custom_components/ir_common/codebook.h)
+from a JSON code list.
+
+Usage:
+    tools/gen_codebook.py codebooks/raw_ac.json custom_components/raw_ac/raw_ac_codebook
+
+writes <out>.h (extern declarations) and <out>.cpp (the PROGMEM blob). Only the
+.cpp changes when codes are added, so the component logic is not recompiled.
+
+JSON layout:
+    {
+      "namespace": "raw_ac",
+      "symbol": "RAW_AC_CODEBOOK",
+      "format": "raw16" | "bytes",
+      "carrier_khz": 38,
+      "codes": [
+        {"mode": "COOL", "fan": "AUTO", "temp": 22, "raw": [3437, -1727, ...]},
+        {"mode": "OFF", "hex": "2049000000090700"}
+      ]
+    }
+"fan", "temp" and "swing" may be omitted when the code does not depend on them.
+Hex frames for a namespace in FRAME_CHECKS must pass that protocol's check.
+"""
+import json
+import math
+import struct
+import sys
+
+# ============================================================
+# KEY LAYOUT (must match codebook_key() in codebook.h)
+# ============================================================
+
+# Values of esphome::climate::ClimateMode / ClimateFanMode / ClimateSwingMode
+MODES = {"OFF": 0, "HEAT_COOL": 1, "COOL": 2, "HEAT": 3, "FAN_ONLY": 4, "DRY": 5, "AUTO": 6}
+FANS = {"ON": 0, "OFF": 1, "AUTO": 2, "LOW": 3, "MEDIUM": 4, "HIGH": 5, "MIDDLE": 6,
+        "FOCUS": 7, "DIFFUSE": 8, "QUIET": 9}
+SWINGS = {"OFF": 0, "BOTH": 1, "VERTICAL": 2, "HORIZONTAL": 3}
+ANY = 0xFF
+
+MAGIC = 0x42435249  # "IRCB"
+VERSION = 1
+FORMATS = {"raw16": 0, "bytes": 1}
+HEADER_SIZE = 16
+RECORD_HEADER_SIZE = 8
+MASK32 = 0xFFFFFFFF
+
+
+def codebook_key(code: dict) -> int:
+    mode = MODES[code["mode"]]
+    fan = FANS[code["fan"]] if code.get("fan") else ANY
+    temp = code.get("temp")
+    half_degrees = min(int(temp * 2 + 0.5), 0xFF) if temp else 0
+    swing = SWINGS[code["swing"]] if code.get("swing") else ANY
+    return mode | (fan << 8) | (half_degrees << 16) | (swing << 24)
+
+
+def codebook_hash(key: int, seed: int) -> int:
+    h = key ^ ((seed * 0x9E3779B9) & MASK32)
+    h ^= h >> 16
+    h = (h * 0x85EBCA6B) & MASK32
+    h ^= h >> 13
+    h = (h * 0xC2B2AE35) & MASK32
+    h ^= h >> 16
+    return h
+
+# ============================================================
+# MINIMAL PERFECT HASH (hash and displace)
+# ============================================================
+
+
+def build_mphf(keys: list[int], n_buckets: int) -> tuple[list[int], list[int]] | None:
+    """
+    Returns (displacements, slot_of_key) or None if some bucket finds no seed.
+    Buckets are placed largest first; each gets the first seed that lands all
+    its keys in distinct free slots.
+    """
+    n = len(keys)
+    buckets: list[list[int]] = [[] for _ in range(n_buckets)]
+    for idx, key in enumerate(keys):
+        buckets[codebook_hash(key, 0) % n_buckets].append(idx)
+
+    disp = [0] * n_buckets
+    slot_of = [-1] * n
+    taken = [False] * n
+    for b in sorted(range(n_buckets), key=lambda i: -len(buckets[i])):
+        members = buckets[b]
+        if not members:
+            continue
+        for seed in range(1, 0x10000):
+            slots = [codebook_hash(keys[i], seed) % n for i in members]
+            if len(set(slots)) == len(slots) and not any(taken[s] for s in slots):
+                disp[b] = seed
+                for i, s in zip(members, slots):
+                    slot_of[i] = s
+                    taken[s] = True
+                break
+        else:
+            return None
+    return disp, slot_of
+
+
+# ============================================================
+# FRAME CHECKS (must match the decoders; see ir_common/protocol_id.cpp)
+# ============================================================
+
+
+def reverse_bits(b: int) -> int:
+    return int(f"{b:08b}"[::-1], 2)
+
+
+def carrier_64_ok(frame: bytes) -> bool:
+    """The 16 nibbles sum to 0xF (mod 16)."""
+    return sum((b >> 4) + (b & 0x0F) for b in frame) & 0x0F == 0x0F
+
+
+def mitsubishi_112_ok(frame: bytes) -> bool:
+    """C4 D3 header; byte 13 = sum of bytes 0..12, taken LSB first."""
+    return (len(frame) == 14 and frame[:2] == b"\xC4\xD3"
+            and sum(reverse_bits(b) for b in frame[:-1]) & 0xFF == reverse_bits(frame[-1]))
+
+
+# Namespaces whose receivers reject frames that fail a check. A frame the
+# node's own decoder would reject is never worth transmitting.
+FRAME_CHECKS = {"carrier_ac": carrier_64_ok, "mitsubishi_ac": mitsubishi_112_ok}
+
+
+def describe(code: dict) -> str:
+    return "/".join(str(code[k]) for k in ("mode", "fan", "temp", "swing") if code.get(k) is not None)
+
+
+def payload_of(code: dict, fmt: str) -> bytes:
+    if fmt == "raw16":
+        raw = code["raw"]
+        for v in raw:
+            if not -32768 <= v <= 32767:
+                raise ValueError(f"timing {v} does not fit in int16")
+        return struct.pack(f"<{len(raw)}h", *raw)
+    return bytes.fromhex(code["hex"].replace(" ", "").replace("0x", ""))
+
+
+def build_blob(book: dict) -> bytes:
+    fmt = book["format"]
+    codes = book["codes"]
+    keys = [codebook_key(c) for c in codes]
+    if len(set(keys)) != len(keys):
+        dupes = sorted({k for k in keys if keys.count(k) > 1})
+        raise ValueError(f"duplicate states in codebook: {[hex(k) for k in dupes]}")
+
+    payloads = [payload_of(c, fmt) for c in codes]
+    check = FRAME_CHECKS.get(book["namespace"]) if fmt == "bytes" else None
+    if check:
+        failed = [describe(c) for c, p in zip(codes, payloads) if not check(p)]
+        if failed:
+            raise ValueError(f"frames fail the {book['namespace']} check: {', '.join(failed)}")
+    lengths = [len(p) // 2 if fmt == "raw16" else len(p) for p in payloads]
+    max_payload = max(len(p) for p in payloads)
+    stride = RECORD_HEADER_SIZE + ((max_payload + 3) & ~3)
+
+    n_buckets = max(1, math.ceil(len(keys) / 4))
+    while (result := build_mphf(keys, n_buckets)) is None:
+        n_buckets += 1
+    disp, slot_of = result
+
+    records = [b""] * len(keys)
+    for i, p in enumerate(payloads):
+        rec = struct.pack("<IHH", keys[i], lengths[i], 0) + p
+        records[slot_of[i]] = rec.ljust(stride, b"\x00")
+
+    header = struct.pack("<IBBHHHBBH", MAGIC, VERSION, FORMATS[fmt], len(keys), n_buckets,
+                         stride, book.get("carrier_khz", 38), 0, max(lengths))
+    return header + struct.pack(f"<{n_buckets}H", *disp) + b"".join(records)
+
+# ============================================================
+# C++ OUTPUT
+# ============================================================
+
+
+def write_sources(book: dict, blob: bytes, src: str, out: str):
+    ns = book["namespace"]
+    sym = book["symbol"]
+    base = out.rsplit("/", 1)[-1]
+    banner = f"// Generated by tools/gen_codebook.py from {src} -- do not edit.\n"
+
+    with open(out + ".h", "w") as f:
+        f.write("#pragma once\n\n" + banner + "\n")
+        f.write("#include <cstddef>\n#include <cstdint>\n\n")
+        f.write(f"namespace esphome {{\nnamespace {ns} {{\n\n")
+        f.write(f"extern const uint8_t {sym}[];\nextern const size_t {sym}_SIZE;\n\n")
+        f.write(f"}}  // namespace {ns}\n}}  // namespace esphome\n")
+
+    rows = []
+    for i in range(0, len(blob), 16):
+        rows.append("    " + ", ".join(f"0x{b:02X}" for b in blob[i:i + 16]) + ",")
+    with open(out + ".cpp", "w") as f:
+        f.write(banner + f"// {len(book['codes'])} codes, {len(blob)} bytes.\n")
+        f.write(f'#include "{base}.h"\n#include "esphome/core/hal.h"\n\n')
+        f.write(f"namespace esphome {{\nnamespace {ns} {{\n\n")
+        f.write(f"const uint8_t {sym}[] PROGMEM = {{\n" + "\n".join(rows) + "\n};\n")
+        f.write(f"const size_t {sym}_SIZE = sizeof({sym});\n\n")
+        f.write(f"}}  // namespace {ns}\n}}  // namespace esphome\n")
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        print(__doc__)
+        sys.exit(1)
+    src, out = sys.argv[1], sys.argv[2]
+    with open(src) as f:
+        book = json.load(f)
+    blob = build_blob(book)
+    write_sources(book, blob, src, out)
+    print(f"{out}.cpp: {len(book['codes'])} codes, {len(blob)} bytes")
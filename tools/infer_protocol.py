@@ -0,0 +1,530 @@
+#!/usr/bin/env python3
+"""
+Infer an A/C remote's IR protocol from labelled captures: timing profile,
+frame length, bit order, constant bytes, which bits follow mode / fan /
+temperature / swing, and the checksum if it is one of the common forms.
+Prints a report and C++ tables in the style of cartridge_protocol.cpp.
+
+Usage:
+    tools/infer_protocol.py codebooks/raw_ac.json [--name raw_ac] [--gap 5000]
+
+Input is the codebook layout of tools/gen_codebook.py: one entry per state,
+with raw timings ("raw", as logged by `dump: raw`) or decoded bytes ("hex").
+A capture archive (tools/capture_archive.py) works too; its labelled
+captures are used and the rest are skipped.
+Timings give the line coding as well; hex skips straight to the fields.
+More states give sharper answers: vary one setting at a time and include
+every mode, fan speed and at least three temperatures. A few mislabelled
+captures are tolerated and listed.
+"""
+import argparse
+import json
+import statistics
+import sys
+
+import capture_archive
+
+VARIABLES = ("mode", "fan", "temp", "swing")
+ENUM_PREFIX = {"mode": "climate::CLIMATE_MODE_", "fan": "climate::CLIMATE_FAN_", "swing": "climate::CLIMATE_SWING_"}
+RULE_TYPE = {"mode": ("ModeRule", "climate::ClimateMode", "mode"),
+             "fan": ("FanRule", "climate::ClimateFanMode", "fan_mode"),
+             "swing": ("SwingRule", "climate::ClimateSwingMode", "swing_mode")}
+
+CLUSTER_RATIO = 1.4       # a duration this much longer than the previous one starts a new cluster
+CLUSTER_MIN_SHARE = 0.02  # clusters with fewer of the durations are noise
+HEADER_RATIO = 2.0        # a first mark this much longer than the data marks is a header
+MIN_AGREEMENT = 0.9       # share of captures a rule must explain; the rest are reported as mislabelled
+
+
+def fail(message: str):
+    print(f"error: {message}", file=sys.stderr)
+    sys.exit(1)
+
+# ============================================================
+# TIMING PROFILE
+# ============================================================
+
+
+def segment(raw: list[int], gap: int) -> list[list[int]]:
+    """Splits a capture on spaces of at least `gap` µs; drops stray fragments."""
+    frames, current = [], []
+    for t in raw:
+        if t < 0 and -t >= gap:
+            frames.append(current)
+            current = []
+        elif current or t > 0:
+            current.append(t)
+    frames.append(current)
+    return [f for f in frames if len(f) >= 16]
+
+
+def clusters(values: list[int]) -> list[list[int]]:
+    values = sorted(values)
+    groups = [[values[0]]]
+    for v in values[1:]:
+        if v > groups[-1][-1] * CLUSTER_RATIO:
+            groups.append([])
+        groups[-1].append(v)
+    return [g for g in groups if len(g) >= CLUSTER_MIN_SHARE * len(values)]
+
+
+def nominal(values: list[int]) -> int:
+    return int(round(statistics.median(values) / 10.0)) * 10
+
+
+class Coding:
+    """The LineCoding fields, plus what the report shows about them."""
+
+    def __init__(self):
+        self.kind = None
+        self.header = (0, 0)
+        self.fixed = self.zero = self.one = self.footer = 0
+        self.spread = {}
+
+    def data_range(self, frame: list[int]) -> tuple[int, int]:
+        start = 2 if self.header[0] else 0
+        end = len(frame) - 1 if self.footer else len(frame)
+        return start, end
+
+    def bits(self, frame: list[int]) -> list[int]:
+        start, end = self.data_range(frame)
+        mid = (self.zero + self.one) / 2
+        if self.kind == "LINE_PULSE_DISTANCE":
+            return [int(-frame[i + 1] > mid) for i in range(start, end - 1, 2)]
+        return [int(frame[i] > mid) for i in range(start, end, 2)]
+
+
+def infer_coding(frames: list[list[int]]) -> Coding:
+    c = Coding()
+    marks = [t for f in frames for t in f[2:] if t > 0]
+    first_marks = [f[0] for f in frames]
+    if statistics.median(first_marks) > HEADER_RATIO * statistics.median(marks):
+        c.header = (nominal(first_marks), nominal([-f[1] for f in frames]))
+    start = 2 if c.header[0] else 0
+    # An odd number of data timings ends on a lone mark
+    if (len(frames[0]) - start) % 2 == 1:
+        c.footer = nominal([f[-1] for f in frames])
+
+    data = [f[start:len(f) - 1 if c.footer else len(f)] for f in frames]
+    mark_groups = clusters([t for f in data for t in f if t > 0])
+    space_groups = clusters([-t for f in data for t in f if t < 0])
+    c.spread = {"mark": [(min(g), max(g)) for g in mark_groups],
+                "space": [(min(g), max(g)) for g in space_groups]}
+    if len(mark_groups) == 1 and len(space_groups) == 2:
+        c.kind = "LINE_PULSE_DISTANCE"
+        c.fixed = nominal(mark_groups[0])
+        c.zero, c.one = nominal(space_groups[0]), nominal(space_groups[1])
+    elif len(mark_groups) == 2 and len(space_groups) <= 1:
+        # The last bit's mark is followed by the idle line, not a footer
+        c.kind = "LINE_PULSE_WIDTH"
+        c.footer = 0
+        space_groups = space_groups or [[0]]
+        c.fixed = nominal(space_groups[0])
+        c.zero, c.one = nominal(mark_groups[0]), nominal(mark_groups[1])
+    elif len(mark_groups) == 2 and len(space_groups) == 2:
+        c.kind = "LINE_MANCHESTER"
+        c.fixed = nominal(mark_groups[0] + space_groups[0])
+    return c
+
+# ============================================================
+# CAPTURES
+# ============================================================
+
+
+class Capture:
+    def __init__(self, code: dict, bits: list[int]):
+        self.labels = {v: code.get(v) for v in VARIABLES}
+        self.bits = bits
+
+    def label(self) -> str:
+        return "/".join(str(self.labels[v]) for v in VARIABLES if self.labels[v] is not None)
+
+
+def hex_bits(text: str) -> list[int]:
+    data = bytes.fromhex(text.replace(" ", "").replace("0x", ""))
+    return [(b >> (7 - k)) & 1 for b in data for k in range(8)]
+
+
+def natural_bytes(bits: list[int], lsb_first: bool) -> list[int]:
+    """Frames that end mid-byte are padded with zero bits."""
+    out = []
+    for i in range(0, len(bits), 8):
+        chunk = bits[i:i + 8]
+        out.append(sum(b << (k if lsb_first else 7 - k) for k, b in enumerate(chunk)))
+    return out
+
+
+def position(bit: int, lsb_first: bool) -> tuple[int, int]:
+    """(byte, mask) of a received bit in the bytes as the protocol stores them."""
+    k = bit % 8
+    return bit // 8, (1 << k) if lsb_first else (0x80 >> k)
+
+# ============================================================
+# FIELD ANALYSIS
+# ============================================================
+
+
+def agreement(captures: list[Capture], bit: int, var: str) -> float:
+    """Share of captures whose bit matches the majority among captures with the same label."""
+    groups: dict = {}
+    for c in captures:
+        groups.setdefault(c.labels[var], [0, 0])[c.bits[bit]] += 1
+    return sum(max(g) for g in groups.values()) / len(captures)
+
+
+def field_value(c: Capture, bits: list[int], lsb_first: bool) -> int:
+    # Most significant first: earlier bytes, then higher masks
+    ordered = sorted(bits, key=lambda b: (position(b, lsb_first)[0], -position(b, lsb_first)[1]))
+    value = 0
+    for b in ordered:
+        value = value << 1 | c.bits[b]
+    return value
+
+
+def linear_fit(pairs: list[tuple[float, int]]) -> tuple[int, int] | None:
+    """(scale, offset) with value = scale * temp + offset for most pairs."""
+    for scale in (1, -1, 2, -2):
+        offsets = [v - scale * t for t, v in pairs if float(scale * t).is_integer()]
+        if not offsets:
+            continue
+        offset = statistics.mode(offsets)
+        if sum(1 for t, v in pairs if v == scale * t + offset) >= MIN_AGREEMENT * len(pairs):
+            return scale, int(offset)
+    return None
+
+
+def temp_formula(scale: int, offset: int) -> str:
+    term = {1: "T", -1: "-T"}.get(scale, f"{scale} * T")
+    return term if offset == 0 else f"{term} {'+' if offset > 0 else '-'} {abs(offset)}"
+
+
+def value_table(captures: list[Capture], var: str, bits: list[int], lsb_first: bool):
+    """Majority field value per label value, and the captures that disagree."""
+    seen: dict = {}
+    for c in captures:
+        seen.setdefault(c.labels[var], []).append(field_value(c, bits, lsb_first))
+    table = {k: statistics.mode(v) for k, v in seen.items()}
+    outliers = [c for c in captures if field_value(c, bits, lsb_first) != table[c.labels[var]]]
+    return table, outliers
+
+
+def collisions(table: dict) -> dict[int, list]:
+    """Field values that stand for more than one label."""
+    labels: dict[int, list] = {}
+    for key, value in table.items():
+        if key is not None:
+            labels.setdefault(value, []).append(key)
+    return {value: sorted(keys, key=str) for value, keys in labels.items() if len(keys) > 1}
+
+
+def find_checksum(frames: list[list[int]]):
+    """
+    Tries a sum, an XOR and a nibble total over bytes start..end, for every
+    start, allowing a constant. Returns the best as (hits, description,
+    check byte or None, indices of the frames that fail), or None.
+    """
+    n = len(frames[0])
+    best = None
+    for start in range(n - 1):
+        # A range that never changes fits every form trivially
+        if len({tuple(f[start:]) for f in frames}) < 2:
+            break
+        last = f"{start}-{n - 2}" if start < n - 2 else f"{start}"
+        forms = (
+            (f"byte {n - 1} = sum of bytes {last} + 0x{{:02X}}", n - 1,
+             [(f[-1] - sum(f[start:-1])) & 0xFF for f in frames]),
+            (f"byte {n - 1} = XOR of bytes {last} ^ 0x{{:02X}}", n - 1,
+             [f[-1] ^ _xor(f[start:-1]) for f in frames]),
+            (f"the nibbles of bytes {start}-{n - 1} sum to 0x{{:X}} (mod 16)", None,
+             [sum((b >> 4) + (b & 0x0F) for b in f[start:]) & 0x0F for f in frames]),
+        )
+        for text, byte, residuals in forms:
+            const = statistics.mode(residuals)
+            failing = [i for i, r in enumerate(residuals) if r != const]
+            hits = len(frames) - len(failing)
+            if best is None or hits > best[0]:
+                best = (hits, text.format(const).replace(" + 0x00", "").replace(" ^ 0x00", ""), byte, failing)
+    return best
+
+
+def _xor(data: list[int]) -> int:
+    x = 0
+    for b in data:
+        x ^= b
+    return x
+
+
+# ============================================================
+# REPORT
+# ============================================================
+
+
+def analyse(captures: list[Capture], coding: Coding | None, name: str, source: str):
+    nbits = len(captures[0].bits)
+    padded = f" (last byte padded with {8 - nbits % 8} zero bits)" if nbits % 8 else ""
+    print(f"== {len(captures)} captures of {nbits} bits{padded}")
+    constant = [b for b in range(nbits) if len(set(c.bits[b] for c in captures)) == 1]
+
+    # Each varying bit goes to the variable that explains it best
+    owner: dict[int, str] = {}
+    unexplained = []
+    for b in range(nbits):
+        if b in constant:
+            continue
+        scored = []
+        for var in VARIABLES:
+            if len(set(c.labels[var] for c in captures)) < 2:
+                continue
+            scored.append((agreement(captures, b, var), -len(set(c.labels[var] for c in captures)), var))
+        scored.sort(reverse=True)
+        if scored and scored[0][0] >= MIN_AGREEMENT:
+            owner[b] = scored[0][2]
+        else:
+            unexplained.append(b)
+
+    fields = {var: [b for b in sorted(owner) if owner[b] == var] for var in VARIABLES}
+    fields = {k: v for k, v in fields.items() if v}
+    # A field bit that happened not to change in these captures (bit 1 of
+    # a temperature that was never 2, 3, 6 or 7) still belongs to the field
+    for bits in fields.values():
+        for byte in {b // 8 for b in bits}:
+            inside = [b for b in bits if b // 8 == byte]
+            bits.extend(b for b in range(min(inside), max(inside)) if b in constant and b not in bits)
+        bits.sort()
+
+    # Bit order: the checksum byte comes out of the fields first (it follows
+    # every setting at once), then the temperature is linear in at most one
+    # order. Failing that, a checksum that fits only one order decides.
+    temps = [c for c in captures if isinstance(c.labels["temp"], (int, float))]
+    checks, fits = {}, {}
+    for lsb in (False, True):
+        check = find_checksum([natural_bytes(c.bits, lsb) for c in captures]) if nbits >= 16 else None
+        checked = check is not None and check[0] >= MIN_AGREEMENT * len(captures)
+        checks[lsb] = check if checked else None
+        temp_bits = [b for b in fields.get("temp", []) if not checked or b // 8 != check[2]]
+        fits[lsb] = linear_fit([(c.labels["temp"], field_value(c, temp_bits, lsb)) for c in temps]) \
+            if temp_bits and temps else None
+    # Checksum hits per order; one that fits every capture beats a near miss
+    hits = {lsb: checks[lsb][0] if checks[lsb] else 0 for lsb in (False, True)}
+    full = {lsb: hits[lsb] == len(captures) for lsb in (False, True)}
+    order = {False: "MSB", True: "LSB"}
+    lsb_first = False
+    if fits[True] and not fits[False]:
+        lsb_first, order_note = True, "LSB first (temperature is linear only LSB first)"
+    elif fits[False] and not fits[True]:
+        order_note = "MSB first (temperature is linear only MSB first)"
+    elif full[True] != full[False]:
+        lsb_first = full[True]
+        order_note = f"{order[lsb_first]} first (the checksum fits every capture only {order[lsb_first]} first)"
+    elif hits[True] != hits[False]:
+        lsb_first = hits[True] > hits[False]
+        order_note = (f"{order[lsb_first]} first (the checksum fits {hits[lsb_first]}/{len(captures)} captures "
+                      f"{order[lsb_first]} first, {hits[not lsb_first]} {order[not lsb_first]} first)")
+    elif fits[False]:
+        order_note = "MSB first (temperature is linear either way)"
+    elif "temp" in fields:
+        order_note = "MSB first (temperature is not linear either way; check the table)"
+    else:
+        order_note = "MSB first (default; nothing in these captures tells)"
+    print(f"Bit order: {order_note}")
+
+    frames = [natural_bytes(c.bits, lsb_first) for c in captures]
+    nbytes = len(frames[0])
+    check = find_checksum(frames) if nbits >= 16 else None
+    checked = checks[lsb_first] is not None
+    if checked and check[2] is not None:
+        for b in range(check[2] * 8, check[2] * 8 + 8):
+            owner.pop(b, None)
+            if b in unexplained:
+                unexplained.remove(b)
+        fields = {k: [b for b in v if b // 8 != check[2]] for k, v in fields.items()}
+        fields = {k: v for k, v in fields.items() if v}
+    field_bits = {b for bits in fields.values() for b in bits}
+    if checked and check[2] is not None:
+        field_bits |= set(range(check[2] * 8, check[2] * 8 + 8))
+    constant = [b for b in constant if b not in field_bits]
+
+    print("Bytes:   " + " ".join(f"{i:>2}" for i in range(nbytes)))
+    print("Const:   " + " ".join(
+        f"{frames[0][i]:02X}" if all(b in constant for b in range(i * 8, i * 8 + 8)) else "--"
+        for i in range(nbytes)))
+    tags = {"mode": "M", "fan": "F", "temp": "T", "swing": "S"}
+    row = []
+    for i in range(nbytes):
+        kinds = {tags[owner[b]] for b in range(i * 8, i * 8 + 8) if b in owner}
+        kinds |= {"?"} if any(b in unexplained for b in range(i * 8, i * 8 + 8)) else set()
+        if checked and check[2] == i:
+            kinds = {"C"}
+        row.append("".join(sorted(kinds)).rjust(2) if kinds else " .")
+    print("Varies:  " + " ".join(row) + "   (M mode, F fan, T temp, S swing, C checksum, ? several)")
+
+    suspects: dict[str, set] = {}
+    tables = {}
+    for var, bits in fields.items():
+        locations = {}
+        for b in bits:
+            byte, mask = position(b, lsb_first)
+            locations[byte] = locations.get(byte, 0) | mask
+        where = ", ".join(f"byte {byte} mask 0x{mask:02X}" for byte, mask in sorted(locations.items()))
+        table, outliers = value_table(captures, var, bits, lsb_first)
+        clash = collisions(table)
+        tables[var] = (where, table, clash)
+        print(f"{var}: {where}")
+        for key, value in sorted(table.items(), key=lambda kv: str(kv[0])):
+            print(f"    {str(key):>10} -> 0x{value:X}")
+        for value, keys in clash.items():
+            print(f"    not separable: {', '.join(map(str, keys))} all give 0x{value:X}; "
+                  "capture them again or add a capture that sets them apart")
+        for c in outliers:
+            suspects.setdefault(c.label(), set()).add(var)
+
+    temp_fit = None
+    if "temp" in fields and temps:
+        temp_fit = linear_fit([(c.labels["temp"], field_value(c, fields["temp"], lsb_first)) for c in temps])
+        if temp_fit:
+            print(f"temp: value = {temp_formula(*temp_fit)}")
+
+    if checked:
+        hits, text, _, failing = check
+        print(f"Checksum: {text}, {hits}/{len(frames)} captures")
+        if failing:
+            print("Checksum fails: " + "; ".join(captures[i].label() for i in failing))
+    elif check is not None and check[0] * 2 > len(frames):
+        hits, text, _, failing = check
+        print(f"Checksum: no common form fits; closest is {text}, {hits}/{len(frames)} captures. "
+              "Fails: " + "; ".join(captures[i].label() for i in failing))
+    elif unexplained:
+        print(f"Checksum: not a sum, XOR or nibble sum; {len(unexplained)} bits follow no single setting")
+    pairs = [i for i in range(nbytes - 1) if all(f[i] ^ f[i + 1] == 0xFF for f in frames)]
+    if pairs:
+        print("Complement pairs: " + ", ".join(f"B{i + 1} = ~B{i}" for i in pairs))
+    if suspects:
+        print("Possibly mislabelled: " + "; ".join(f"{k} ({', '.join(sorted(v))})" for k, v in suspects.items()))
+
+    emit_cpp(name, source, coding, nbits, lsb_first, frames, constant, tables, temp_fit, checked)
+
+
+def emit_cpp(name, source, coding, nbits, lsb_first, frames, constant, tables, temp_fit, checked):
+    upper = name.upper()
+    nbytes = len(frames[0])
+    mask = [0] * nbytes
+    for b in constant:
+        byte, m = position(b, lsb_first)
+        mask[byte] |= m
+    print()
+    print(f"// ---- Inferred by tools/infer_protocol.py from {source} ----")
+    if coding is not None and coding.kind:
+        print("// kind, header mark/space, fixed, zero, one, footer, lsb_first, inverted")
+        print(f"static const LineCoding {upper}_CODING = {{{coding.kind}, {coding.header[0]}, {coding.header[1]}, "
+              f"{coding.fixed}, {coding.zero}, {coding.one}, {coding.footer}, {str(lsb_first).lower()}, false}};")
+        print(f'//   {{"{name} ({nbits}-bit)", {upper}_CODING, {nbits}, {name}_ok, '
+              f'{"true" if checked else "false"}}},  // protocol_id.cpp')
+    print(f"static const size_t {upper}_FRAME_BYTES = {nbytes};")
+    print("// Bits that never changed, and their values")
+    print(f"static const uint8_t {upper}_CONSTANT_MASK[] = {{{', '.join(f'0x{m:02X}' for m in mask)}}};")
+    print(f"static const uint8_t {upper}_CONSTANT_BITS[] = "
+          f"{{{', '.join(f'0x{frames[0][i] & mask[i]:02X}' for i in range(nbytes))}}};")
+    declared = set()
+    for var, (where, table, clash) in tables.items():
+        if clash and not (var == "temp" and temp_fit):
+            print(f"// {var}: {where} is not separable, no table:")
+            for value, keys in clash.items():
+                print(f"//   0x{value:X}: {', '.join(map(str, keys))}")
+            continue
+        if var == "temp" and temp_fit:
+            scale, offset = temp_fit
+            print(f"// Temperature: {where}, value = {temp_formula(scale, offset)}")
+            continue
+        if var not in RULE_TYPE:
+            print(f"// {var}: {where}")
+            for key, value in sorted(table.items(), key=lambda kv: str(kv[0])):
+                print(f"//   {key}: 0x{value:X}")
+            continue
+        struct, enum, member = RULE_TYPE[var]
+        if struct not in declared:
+            print(f"struct {struct} {{\n  uint8_t value;\n  {enum} {member};\n}};")
+            declared.add(struct)
+        print(f"// {where}, bits gathered most significant first")
+        rows = []
+        for key, value in sorted(table.items(), key=lambda kv: kv[1]):
+            if key is None:
+                continue
+            rows.append(f"    {{0x{value:X}, {ENUM_PREFIX[var]}{key}}},")
+        print(f"static const {struct} {var.upper()}_RULES[] = {{\n" + "\n".join(rows) + "\n};")
+
+# ============================================================
+# MAIN
+# ============================================================
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("codebook", help="JSON in the tools/gen_codebook.py layout, or a capture archive")
+    parser.add_argument("--name", help="prefix for the C++ names (default: the JSON namespace)")
+    parser.add_argument("--gap", type=int, default=5000, help="spaces this long (µs) end a frame")
+    args = parser.parse_args()
+
+    with open(args.codebook, "rb") as f:
+        is_archive = f.read(len(capture_archive.MAGIC)) == capture_archive.MAGIC
+    if is_archive:
+        archive = capture_archive.Archive(args.codebook)
+        codes = []
+        for i in range(len(archive)):
+            meta = archive.meta(i)
+            labels = capture_archive.label(meta["state"])
+            if labels:
+                codes.append({**labels, "raw": archive.timings(i)})
+        book = {"namespace": archive.nodes[0] if archive.nodes else "inferred", "codes": codes}
+    else:
+        with open(args.codebook) as f:
+            book = json.load(f)
+    name = args.name or book.get("namespace", "inferred")
+    codes = book["codes"]
+    if not codes:
+        fail("no codes")
+
+    coding = None
+    captures = []
+    if all("raw" in c for c in codes):
+        per_code = [segment(c["raw"], args.gap) for c in codes]
+        if not all(per_code):
+            fail("a capture has no frame; check --gap")
+        # Repeats of the same frame count once; different parts stay in order
+        deduped = [[f for i, f in enumerate(frames) if i == 0 or frames[i - 1] != f] for frames in per_code]
+        firsts = [frames[0] for frames in per_code]
+        coding = infer_coding(firsts)
+        repeats = {len(frames) for frames in per_code}
+        print(f"Timing (µs) from {len(codes)} captures, {'/'.join(map(str, sorted(repeats)))} frame(s) each:")
+        if coding.header[0]:
+            print(f"  header  {coding.header[0]} / {coding.header[1]}")
+        for kind, ranges in coding.spread.items():
+            print(f"  {kind}s   " + ", ".join(f"{lo}-{hi}" for lo, hi in ranges))
+        if coding.footer:
+            print(f"  footer  {coding.footer}")
+        if coding.kind is None:
+            fail("marks and spaces do not fit a pulse-distance, pulse-width or Manchester coding")
+        if coding.kind == "LINE_MANCHESTER":
+            print(f"Coding: Manchester, unit {coding.fixed} µs. Decode the captures with ir_convert and "
+                  "rerun on hex to infer the fields.")
+            return 0
+        print(f"Coding: {coding.kind}, fixed {coding.fixed}, 0 = {coding.zero}, 1 = {coding.one}")
+        for code, frames in zip(codes, deduped):
+            captures.append(Capture(code, coding.bits(frames[0])))
+    elif all("hex" in c for c in codes):
+        captures = [Capture(c, hex_bits(c["hex"])) for c in codes]
+    else:
+        fail('every code needs "raw" timings, or every code "hex"')
+
+    by_length: dict[int, list[Capture]] = {}
+    for c in captures:
+        by_length.setdefault(len(c.bits), []).append(c)
+    for length, group in sorted(by_length.items(), key=lambda kv: -len(kv[1])):
+        if len(group) < 2:
+            print(f"== skipping {group[0].label()}: the only capture of {length} bits")
+            continue
+        analyse(group, coding, name, args.codebook)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
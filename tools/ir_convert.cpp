@@ -0,0 +1,462 @@
+// ======================================================================
+// ===        IR CAPTURE CONVERTER (ESPHome logs, stream dumps)       ===
+// ======================================================================
+// Decodes every capture in ESPHome logs or binary stream dumps with the
+// firmware's own decoders (ir_common's identify_protocol), so thresholds
+// and checksums are the ones the node uses. It prints one row per
+// protocol whose frame length fits, in a single streaming pass; files of
+// any size are read line by line or record by record.
+//
+// Input, detected per file:
+//   - logs with `dump: raw` lines ("Received Raw: ..." and continuations),
+//     `ir_capture.dump` output ("raw ..."), or bare pasted timings
+//   - binary records from `tools/ir_stream.py HOST --save FILE`
+//   - capture archives (capture_archive.h), memory-mapped and read in place
+//
+// --archive OUT also writes every capture it prints into an archive, with
+// the input file as the node name and the best guess as the protocol, so
+// later runs over the same corpus skip the log parsing. Timings are kept
+// exact unless --quantum rounds them.
+//
+// Built with a host compiler and the ir_common decoder sources, with
+// IR_COMMON_HOST_TOOL defined; README.md has the command.
+//
+// Usage:
+//   ir_convert [--bits] [--matched] [--archive OUT [--quantum US]] [FILE...]
+//   no FILE or "-": stdin (logs and stream dumps only)
+//
+// Output is tab separated, one header line, then per row:
+//   source  timings  protocol  confidence  check  hex  [bits]
+// source is FILE:LINE for logs, FILE:#SEQUENCE for stream dumps and
+// FILE:#INDEX for archives. A capture no protocol fits gets one
+// `unknown` row, read as pulse distance with the capture's own 0/1 split
+// and no check, or `-` columns when its spaces do not split in two.
+
+#include "../custom_components/ir_common/capture_archive.h"
+#include "../custom_components/ir_common/capture_codec.h"
+#include "../custom_components/ir_common/capture_stream.h"
+#include "../custom_components/ir_common/protocol_id.h"
+#include "../custom_components/ir_common/timing_histogram.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+using namespace esphome::ir_common;
+
+struct Options {
+  bool bits{false};
+  bool matched{false};
+  const char *archive{nullptr};
+  uint8_t quantum_us{1};
+};
+
+struct Totals {
+  size_t captures{0};
+  size_t matched{0};
+  size_t rows{0};
+};
+
+static Options options;
+static Totals totals;
+static CaptureArchiveWriter archive;
+
+// ----------------------------------------------------------------------
+// Output
+// ----------------------------------------------------------------------
+static void print_row(const char *source, size_t timings, const char *protocol, unsigned confidence,
+                      const char *check, const uint8_t *bytes, size_t bits) {
+  char hex[SOFT_MAX_BITS / 8 * 2 + 1];
+  size_t length = bits / 8;
+  for (size_t i = 0; i < length; i++)
+    snprintf(hex + i * 2, 3, "%02X", bytes[i]);
+  hex[length * 2] = '\0';
+
+  printf("%s\t%zu\t%s\t%u\t%s\t%s", source, timings, protocol, confidence, check, length != 0 ? hex : "-");
+  if (options.bits) {
+    // Bytes as received, one space between bytes; a partial last byte shows its bits
+    char bits_text[SOFT_MAX_BITS / 8 * 9 + 1];
+    size_t pos = 0;
+    for (size_t i = 0; i < bits; i++) {
+      if (i != 0 && i % 8 == 0)
+        bits_text[pos++] = ' ';
+      bits_text[pos++] = (bytes[i / 8] >> (7 - i % 8)) & 1 ? '1' : '0';
+    }
+    bits_text[pos] = '\0';
+    printf("\t%s", pos != 0 ? bits_text : "-");
+  }
+  putchar('\n');
+  totals.rows++;
+}
+
+// Fallback for captures no known protocol fits, as clean_ir.py did for one
+// remote: reads any pulse-distance frame with the 0/1 split taken from the
+// capture's own spaces. The two most frequent space clusters are the bit
+// spaces, the shorter one 0; longer spaces (headers, gaps) are skipped.
+// Bits are packed MSB first in the order received. Returns the bit count,
+// 0 if the spaces do not form two clusters.
+static size_t decode_unknown(const std::vector<int32_t> &timings, uint8_t *bytes) {
+  TimingHistogram histogram;
+  histogram.add(timings.data(), timings.size());
+  TimingCluster clusters[2];
+  if (histogram.clusters(false, clusters, 2) < 2 || clusters[1].count < 2)
+    return 0;
+  uint32_t zero = std::min(clusters[0].duration_us, clusters[1].duration_us);
+  uint32_t one = std::max(clusters[0].duration_us, clusters[1].duration_us);
+  uint32_t split = (zero + one) / 2;
+  uint32_t limit = one + (one - zero) / 2;
+
+  size_t bits = 0;
+  memset(bytes, 0, SOFT_MAX_BITS / 8);
+  for (size_t i = 1; i < timings.size() && bits < SOFT_MAX_BITS; i++) {
+    if (timings[i] >= 0 || timings[i - 1] <= 0)
+      continue;
+    uint32_t space = -timings[i];
+    if (space > limit)
+      continue;
+    if (space > split)
+      bytes[bits / 8] |= 0x80 >> (bits % 8);
+    bits++;
+  }
+  return bits >= 8 ? bits : 0;
+}
+
+// `meta` carries the node and timestamp; protocol and confidence are filled here
+static void print_capture(const char *source, const std::vector<int32_t> &timings, ArchiveMeta meta) {
+  if (timings.empty())
+    return;
+  totals.captures++;
+
+  size_t count;
+  known_protocols(&count);
+  ProtocolGuess guesses[8];
+  size_t n = identify_protocol(timings.data(), timings.size(), guesses, count < 8 ? count : 8);
+  if (n != 0)
+    totals.matched++;
+  else if (options.matched)
+    return;
+
+  if (options.archive != nullptr) {
+    meta.protocol = n != 0 ? archive.protocol(guesses[0].protocol->name) : ARCHIVE_NO_PROTOCOL;
+    meta.confidence = n != 0 ? guesses[0].confidence : 0;
+    if (!archive.add(timings.data(), timings.size(), options.quantum_us, meta))
+      fprintf(stderr, "%s: not archived (timings do not alternate, or a write failed)\n", source);
+  }
+
+  if (n == 0) {
+    uint8_t bytes[SOFT_MAX_BITS / 8];
+    size_t bits = decode_unknown(timings, bytes);
+    print_row(source, timings.size(), bits != 0 ? "unknown" : "-", 0, "-", bytes, bits);
+    return;
+  }
+  for (size_t g = 0; g < n; g++) {
+    const ProtocolGuess &guess = guesses[g];
+    char check[16];
+    if (guess.repaired == 0)
+      strcpy(check, "ok");
+    else if (guess.repaired > 0)
+      snprintf(check, sizeof(check), "repaired %d", guess.repaired);
+    else
+      strcpy(check, "fail");
+    print_row(source, timings.size(), guess.protocol->name, guess.confidence, check, guess.bytes, guess.length * 8);
+  }
+}
+
+// ----------------------------------------------------------------------
+// Log input
+// ----------------------------------------------------------------------
+enum LogCapture { LOG_NONE, LOG_REMOTE_RAW, LOG_IR_CAPTURE, LOG_BARE };
+
+// Removes ANSI colour sequences in place; their digits would parse as timings
+static void strip_ansi(char *line) {
+  char *out = line;
+  for (char *in = line; *in != '\0'; in++) {
+    if (*in == '\033' && in[1] == '[') {
+      in += 2;
+      while (*in != '\0' && !(*in >= '@' && *in <= '~'))
+        in++;
+      if (*in == '\0')
+        break;
+      continue;
+    }
+    *out++ = *in;
+  }
+  *out = '\0';
+}
+
+static void parse_timings(const char *text, std::vector<int32_t> *timings) {
+  const char *p = text;
+  while (*p != '\0') {
+    bool negative = *p == '-' && p[1] >= '0' && p[1] <= '9';
+    if (!negative && !(*p >= '0' && *p <= '9')) {
+      p++;
+      continue;
+    }
+    if (negative)
+      p++;
+    int32_t value = 0;
+    while (*p >= '0' && *p <= '9')
+      value = value * 10 + (*p++ - '0');
+    timings->push_back(negative ? -value : value);
+  }
+}
+
+// Pasted timings: only digits, signs, separators and brackets
+static bool is_bare_timings(const char *line) {
+  bool digit = false;
+  for (const char *p = line; *p != '\0'; p++) {
+    if (*p >= '0' && *p <= '9')
+      digit = true;
+    else if (strchr(" \t,-[]\r\n", *p) == nullptr)
+      return false;
+  }
+  return digit;
+}
+
+// True if the log prefix (before `message`) names `tag`
+static bool prefix_has(const char *line, const char *message, const char *tag) {
+  const char *found = strstr(line, tag);
+  return found != nullptr && found < message;
+}
+
+static void convert_log(FILE *file, const char *name) {
+  std::vector<int32_t> timings;
+  timings.reserve(1024);
+  char source[512];
+  LogCapture open = LOG_NONE;
+  char *line = nullptr;
+  size_t capacity = 0;
+  size_t number = 0;
+
+  ArchiveMeta meta{0, ARCHIVE_NO_STATE, archive.node(name), ARCHIVE_NO_PROTOCOL, 0};
+  auto flush = [&]() {
+    if (open != LOG_NONE)
+      print_capture(source, timings, meta);
+    timings.clear();
+    open = LOG_NONE;
+  };
+  auto start = [&](LogCapture kind) {
+    flush();
+    open = kind;
+    snprintf(source, sizeof(source), "%s:%zu", name, number);
+  };
+
+  while (getline(&line, &capacity, file) != -1) {
+    number++;
+    strip_ansi(line);
+
+    // "[12:00:00][I][remote.raw:041]: Received Raw: 9000, -4500, ..."
+    const char *message = line;
+    if (line[0] == '[') {
+      for (const char *p = strstr(line, "]:"); p != nullptr; p = strstr(p + 2, "]:"))
+        message = p + 2;
+    }
+
+    const char *raw = strstr(message, "Received Raw:");
+    if (raw != nullptr) {
+      start(LOG_REMOTE_RAW);
+      parse_timings(raw + 13, &timings);
+      continue;
+    }
+    if (message != line) {
+      const char *text = message + strspn(message, " ");
+      if (open == LOG_REMOTE_RAW && prefix_has(line, message, "remote.raw")) {
+        parse_timings(text, &timings);
+        continue;
+      }
+      if (prefix_has(line, message, "ir_capture") && strncmp(text, "raw ", 4) == 0) {
+        if (open != LOG_IR_CAPTURE)
+          start(LOG_IR_CAPTURE);
+        parse_timings(text + 4, &timings);
+        continue;
+      }
+      flush();
+      continue;
+    }
+    if (is_bare_timings(line)) {
+      if (open != LOG_BARE)
+        start(LOG_BARE);
+      parse_timings(line, &timings);
+      continue;
+    }
+    flush();
+  }
+  flush();
+  free(line);
+}
+
+// ----------------------------------------------------------------------
+// Binary stream input
+// ----------------------------------------------------------------------
+static bool convert_stream(FILE *file, const char *name) {
+  std::vector<int32_t> timings;
+  timings.reserve(1024);
+  std::vector<uint8_t> payload(UINT16_MAX);
+  uint8_t raw[STREAM_HEADER_SIZE];
+  char source[512];
+  long offset = 0;
+  uint16_t node = archive.node(name);
+
+  for (;;) {
+    size_t got = fread(raw, 1, sizeof(raw), file);
+    if (got == 0)
+      return true;
+    StreamHeader header;
+    if (got != sizeof(raw) || !read_stream_header(raw, &header)) {
+      fprintf(stderr, "%s: lost record framing at byte %ld\n", name, offset);
+      return false;
+    }
+    if (fread(payload.data(), 1, header.length, file) != header.length) {
+      fprintf(stderr, "%s: truncated record at byte %ld\n", name, offset);
+      return false;
+    }
+    offset += sizeof(raw) + header.length;
+    if (header.type != STREAM_CAPTURE)
+      continue;
+
+    CaptureReader reader;
+    if (!reader.begin(payload.data(), header.length)) {
+      fprintf(stderr, "%s: bad capture #%u\n", name, (unsigned) header.sequence);
+      continue;
+    }
+    timings.clear();
+    int32_t timing;
+    while (reader.next(&timing))
+      timings.push_back(timing);
+    snprintf(source, sizeof(source), "%s:#%u", name, (unsigned) header.sequence);
+    print_capture(source, timings, ArchiveMeta{header.timestamp_ms, ARCHIVE_NO_STATE, node, ARCHIVE_NO_PROTOCOL, 0});
+  }
+}
+
+// ----------------------------------------------------------------------
+// Archive input
+// ----------------------------------------------------------------------
+static bool convert_archive(const char *path) {
+  int fd = ::open(path, O_RDONLY);
+  struct stat st;
+  if (fd < 0 || fstat(fd, &st) != 0) {
+    perror(path);
+    if (fd >= 0)
+      close(fd);
+    return false;
+  }
+  size_t size = st.st_size;
+  void *map = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED) {
+    perror(path);
+    return false;
+  }
+  madvise(map, size, MADV_SEQUENTIAL);
+
+  CaptureArchive input;
+  bool ok = input.open(static_cast<const uint8_t *>(map), size);
+  if (!ok)
+    fprintf(stderr, "%s: not a version %u capture archive, or truncated\n", path, (unsigned) ARCHIVE_VERSION);
+  std::vector<int32_t> timings;
+  timings.reserve(1024);
+  char source[512];
+  for (size_t i = 0; ok && i < input.size(); i++) {
+    CaptureReader reader;
+    if (!input.capture(i, &reader)) {
+      fprintf(stderr, "%s: capture #%zu is out of bounds\n", path, i);
+      continue;
+    }
+    timings.clear();
+    int32_t timing;
+    while (reader.next(&timing))
+      timings.push_back(timing);
+
+    // Node names carry over when archiving again; labels stay attached
+    ArchiveMeta meta = input.meta(i);
+    size_t length;
+    const char *node = input.node_name(meta.node, &length);
+    std::string node_name = node != nullptr ? std::string(node, length) : path;
+    meta.node = archive.node(node_name.c_str());
+    snprintf(source, sizeof(source), "%s:#%zu", path, i);
+    print_capture(source, timings, meta);
+  }
+  munmap(map, size);
+  return ok;
+}
+
+static bool convert_file(const char *path) {
+  bool is_stdin = strcmp(path, "-") == 0;
+  FILE *file = is_stdin ? stdin : fopen(path, "rb");
+  if (file == nullptr) {
+    perror(path);
+    return false;
+  }
+  const char *name = is_stdin ? "stdin" : path;
+
+  // A stream dump or an archive starts with its magic; a log never does
+  int c0 = getc(file);
+  int c1 = c0 == EOF ? EOF : getc(file);
+  bool binary = c0 == STREAM_MAGIC_0 && c1 == STREAM_MAGIC_1;
+  if (binary && !is_stdin && getc(file) == ARCHIVE_MAGIC[2] && getc(file) == ARCHIVE_MAGIC[3]) {
+    fclose(file);
+    return convert_archive(path);
+  }
+  // Pipes cannot seek; glibc takes back both bytes
+  if (fseek(file, 0, SEEK_SET) != 0) {
+    if (c1 != EOF)
+      ungetc(c1, file);
+    if (c0 != EOF)
+      ungetc(c0, file);
+  }
+  bool ok = binary ? convert_stream(file, name) : (convert_log(file, name), true);
+  if (!is_stdin)
+    fclose(file);
+  return ok;
+}
+
+int main(int argc, char **argv) {
+  static char out_buffer[1 << 16];
+  setvbuf(stdout, out_buffer, _IOFBF, sizeof(out_buffer));
+
+  std::vector<const char *> paths;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--bits") == 0) {
+      options.bits = true;
+    } else if (strcmp(argv[i], "--matched") == 0) {
+      options.matched = true;
+    } else if (strcmp(argv[i], "--archive") == 0 && i + 1 < argc) {
+      options.archive = argv[++i];
+    } else if (strcmp(argv[i], "--quantum") == 0 && i + 1 < argc && atoi(argv[i + 1]) >= 1 &&
+               atoi(argv[i + 1]) <= 255) {
+      options.quantum_us = atoi(argv[++i]);
+    } else if (argv[i][0] == '-' && argv[i][1] != '\0') {
+      fprintf(stderr, "usage: %s [--bits] [--matched] [--archive OUT [--quantum US]] [FILE...]\n", argv[0]);
+      return 2;
+    } else {
+      paths.push_back(argv[i]);
+    }
+  }
+  if (paths.empty())
+    paths.push_back("-");
+  if (options.archive != nullptr && !archive.open(options.archive)) {
+    perror(options.archive);
+    return 1;
+  }
+
+  printf("source\ttimings\tprotocol\tconfidence\tcheck\thex%s\n", options.bits ? "\tbits" : "");
+  bool ok = true;
+  for (const char *path : paths)
+    ok &= convert_file(path);
+  fflush(stdout);
+  fprintf(stderr, "%zu captures, %zu matched a protocol, %zu rows\n", totals.captures, totals.matched, totals.rows);
+  if (options.archive != nullptr) {
+    size_t archived = archive.size();
+    if (!archive.finish()) {
+      perror(options.archive);
+      return 1;
+    }
+    fprintf(stderr, "%zu captures archived to %s\n", archived, options.archive);
+  }
+  return ok ? 0 : 1;
+}
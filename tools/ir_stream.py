@@ -0,0 +1,133 @@
+#!/usr/bin/env python3
+"""
+Read the binary capture stream of an ir_capture node (stream_port) and print
+or save every capture. The stream replaces scraping `dump: raw` log lines:
+records are length-prefixed, lossless at the configured resolution, and
+numbered, so dropped captures are reported instead of silently missing.
+
+Usage:
+    tools/ir_stream.py HOST [--port 6638] [--jsonl captures.jsonl] [--save captures.bin] [--raw]
+
+Record layout and timing encoding: custom_components/ir_common/capture_stream.h
+and capture_codec.h. --raw prints timings in the `dump: raw` layout. --save
+appends the records unchanged, for tools/ir_convert.cpp to decode later.
+"""
+import argparse
+import json
+import socket
+import struct
+import sys
+
+# ============================================================
+# RECORD FORMAT (must match capture_stream.h / capture_codec.h)
+# ============================================================
+MAGIC = b"IR"
+HEADER = struct.Struct("<2sBBBBIIH")  # magic, type, protocol, confidence, reserved, sequence, timestamp, length
+STREAM_HELLO = 1
+STREAM_CAPTURE = 2
+NO_PROTOCOL = 0xFF
+CAPTURE_FIRST_IS_SPACE = 0x01
+
+
+def read_varint(data: bytes, pos: int) -> tuple[int, int]:
+    value = 0
+    for shift in range(0, 35, 7):
+        b = data[pos]
+        pos += 1
+        value |= (b & 0x7F) << shift
+        if not b & 0x80:
+            return value, pos
+    raise ValueError("varint too long")
+
+
+def decode_capture(data: bytes) -> list[int]:
+    """Inverse of ir_common::encode_capture()."""
+    quantum, flags = data[0], data[1]
+    count, pos = read_varint(data, 2)
+    first_is_space = bool(flags & CAPTURE_FIRST_IS_SPACE)
+    last = [0, 0]
+    timings = []
+    for i in range(count):
+        zz, pos = read_varint(data, pos)
+        space = first_is_space != (i % 2 == 1)
+        last[space] += (zz >> 1) ^ -(zz & 1)
+        duration = last[space] * quantum
+        timings.append(-duration if space else duration)
+    return timings
+
+
+def read_exactly(sock: socket.socket, n: int) -> bytes:
+    buf = bytearray()
+    while len(buf) < n:
+        chunk = sock.recv(n - len(buf))
+        if not chunk:
+            raise EOFError
+        buf += chunk
+    return bytes(buf)
+
+
+def records(sock: socket.socket):
+    while True:
+        header = read_exactly(sock, HEADER.size)
+        magic, kind, protocol, confidence, _, sequence, timestamp, length = HEADER.unpack(header)
+        if magic != MAGIC:
+            raise ValueError("lost record framing")
+        payload = read_exactly(sock, length)
+        yield kind, protocol, confidence, sequence, timestamp, payload, header + payload
+
+
+# ============================================================
+# MAIN
+# ============================================================
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("host")
+    parser.add_argument("--port", type=int, default=6638)
+    parser.add_argument("--jsonl", help="append every capture to this file, one JSON object per line")
+    parser.add_argument("--save", help="append the binary records to this file (input for tools/ir_convert.cpp)")
+    parser.add_argument("--raw", action="store_true", help="print the timings of each capture")
+    args = parser.parse_args()
+
+    out = open(args.jsonl, "a", encoding="utf-8") if args.jsonl else None
+    save = open(args.save, "ab") if args.save else None
+    protocols: list[str] = []
+    expected = None
+    received = dropped = 0
+    with socket.create_connection((args.host, args.port)) as sock:
+        try:
+            for kind, protocol, confidence, sequence, timestamp, payload, record in records(sock):
+                if save:
+                    save.write(record)
+                    save.flush()
+                if kind == STREAM_HELLO:
+                    protocols = payload.decode("utf-8").split("\n")[:-1]
+                    expected = sequence
+                    print(f"Connected, device knows {len(protocols)} protocols", file=sys.stderr)
+                    continue
+                if kind != STREAM_CAPTURE:
+                    continue
+                if expected is not None and sequence != expected:
+                    dropped += (sequence - expected) & 0xFFFFFFFF
+                    print(f"!! {(sequence - expected) & 0xFFFFFFFF} captures dropped before #{sequence}",
+                          file=sys.stderr)
+                expected = (sequence + 1) & 0xFFFFFFFF
+                received += 1
+
+                timings = decode_capture(payload)
+                name = protocols[protocol] if protocol < len(protocols) else "unknown"
+                print(f"#{sequence} t={timestamp / 1000:.3f}s {len(timings)} timings, {len(payload)} bytes, "
+                      f"{name} ({confidence}%)")
+                if args.raw:
+                    print("  " + ", ".join(str(t) for t in timings))
+                if out:
+                    out.write(json.dumps({"sequence": sequence, "timestamp_ms": timestamp, "protocol": name,
+                                          "confidence": confidence, "raw": timings}) + "\n")
+                    out.flush()
+        except (EOFError, KeyboardInterrupt):
+            pass
+    print(f"{received} captures received, {dropped} dropped", file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())